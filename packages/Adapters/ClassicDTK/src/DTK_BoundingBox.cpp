@@ -41,6 +41,9 @@
 #include "DTK_BoundingBox.hpp"
 #include "DTK_DBC.hpp"
 
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_ScalarTraits.hpp>
+
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
@@ -290,6 +293,55 @@ bool BoundingBox::intersectBoxes( const BoundingBox &box_A,
     return true;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Static function for the union of the local bounds over a
+ * communicator. The maxima are negated so that all six bounds are reduced
+ * with a single minimum reduction.
+ *
+ * \param comm The communicator over which to compute the union.
+ *
+ * \param bounds The local bounds on this process. Processes with nothing to
+ * bound should provide emptyBounds().
+ *
+ * \return The bounding box of the union of the local bounds.
+ */
+BoundingBox
+BoundingBox::globalUnion( const Teuchos::Comm<int> &comm,
+                          const Teuchos::Tuple<double, 6> &bounds )
+{
+    Teuchos::Tuple<double, 6> local_bounds = bounds;
+    for ( int d = 3; d < 6; ++d )
+    {
+        local_bounds[d] = -local_bounds[d];
+    }
+
+    Teuchos::Tuple<double, 6> global_bounds;
+    Teuchos::reduceAll<int, double>( comm, Teuchos::REDUCE_MIN, 6,
+                                     &local_bounds[0], &global_bounds[0] );
+
+    for ( int d = 3; d < 6; ++d )
+    {
+        global_bounds[d] = -global_bounds[d];
+    }
+
+    return BoundingBox( global_bounds );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Bounds that are the identity of a box union.
+ *
+ * \return Maximum values for the minima and minimum values for the maxima.
+ */
+Teuchos::Tuple<double, 6> BoundingBox::emptyBounds()
+{
+    double rmax = Teuchos::ScalarTraits<double>::rmax();
+    return Teuchos::tuple( rmax, rmax, rmax, -rmax, -rmax, -rmax );
+}
+
+//---------------------------------------------------------------------------//
+
 } // end namespace DataTransferKit
 
 //---------------------------------------------------------------------------//
@@ -42,6 +42,7 @@
 #define DTK_BOUNDINGBOX_HPP
 
 #include <Teuchos_Array.hpp>
+#include <Teuchos_Comm.hpp>
 #include <Teuchos_SerializationTraits.hpp>
 #include <Teuchos_Tuple.hpp>
 
@@ -93,6 +94,15 @@ class BoundingBox
                                 const BoundingBox &box_B,
                                 BoundingBox &intersection );
 
+    // Static function for the union of the local bounds over a communicator
+    // computed with a single collective.
+    static BoundingBox globalUnion( const Teuchos::Comm<int> &comm,
+                                    const Teuchos::Tuple<double, 6> &bounds );
+
+    // Bounds that are the identity of a box union. Ranks with nothing to
+    // bound contribute these to the global union.
+    static Teuchos::Tuple<double, 6> emptyBounds();
+
   private:
     // X min.
     double d_x_min;
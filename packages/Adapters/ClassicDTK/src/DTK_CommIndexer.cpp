@@ -38,20 +38,47 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "DTK_CommIndexer.hpp"
 #include "DTK_DBC.hpp"
 
-#include <Teuchos_Array.hpp>
 #include <Teuchos_CommHelpers.hpp>
-#include <Teuchos_as.hpp>
+#include <Teuchos_OpaqueWrapper.hpp>
+#include <Teuchos_Ptr.hpp>
+
+#ifdef HAVE_MPI
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <mpi.h>
+#endif
 
 namespace DataTransferKit
 {
+//---------------------------------------------------------------------------//
+#ifdef HAVE_MPI
+namespace
+{
+// Get the group of an MPI communicator.
+MPI_Group mpiGroup( const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
+{
+    Teuchos::RCP<const Teuchos::MpiComm<int>> mpi_comm =
+        Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>( comm );
+    DTK_REQUIRE( Teuchos::nonnull( mpi_comm ) );
+    MPI_Group group;
+    MPI_Comm_group( ( *mpi_comm->getRawMpiComm() )(), &group );
+    return group;
+}
+} // end anonymous namespace
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Default constructor.
  */
-CommIndexer::CommIndexer() { /* ... */}
+CommIndexer::CommIndexer()
+    : d_is_valid( false )
+{ /* ... */
+}
 
 //---------------------------------------------------------------------------//
 /*!
@@ -69,22 +96,52 @@ CommIndexer::CommIndexer( Teuchos::RCP<const Teuchos::Comm<int>> global_comm,
     // Set whether or not the indexer will be valid on this rank.
     d_is_valid = Teuchos::nonnull( local_comm );
 
-    // Get my rank in the local communicator.
-    int local_rank = d_is_valid ? local_comm->getRank() : -1;
-
-    // Gather everyone's rank in the local communicator.
-    int global_size = global_comm->getSize();
-    Teuchos::Array<int> local_ids( global_size, 0 );
-    Teuchos::gatherAll<int, int>( *global_comm, 1, &local_rank,
-                                  local_ids.size(), local_ids.getRawPtr() );
-
-    // Map the local communicator to the global communicator.
-    for ( int i = 0; i < global_size; ++i )
+    // Translate the local communicator ranks into the global communicator
+    // on the processes that have the local communicator.
+    int local_size = 0;
+    if ( d_is_valid )
     {
-        if ( local_ids[i] >= 0 )
+        local_size = local_comm->getSize();
+        d_l2g.resize( local_size );
+#ifdef HAVE_MPI
+        Teuchos::Array<int> local_ids( local_size );
+        for ( int i = 0; i < local_size; ++i )
         {
-            d_l2gmap[local_ids[i]] = i;
+            local_ids[i] = i;
         }
+        MPI_Group local_group = mpiGroup( local_comm );
+        MPI_Group global_group = mpiGroup( global_comm );
+        MPI_Group_translate_ranks( local_group, local_size,
+                                   local_ids.getRawPtr(), global_group,
+                                   d_l2g.getRawPtr() );
+        MPI_Group_free( &local_group );
+        MPI_Group_free( &global_group );
+#else
+        DTK_CHECK( 1 == local_size );
+        d_l2g[0] = global_comm->getRank();
+#endif
+        DTK_ENSURE( std::find( d_l2g.begin(), d_l2g.end(),
+                               global_comm->getRank() ) != d_l2g.end() );
+    }
+
+    // Find the global rank of the first process in the local communicator.
+    int local_root = ( d_is_valid && 0 == local_comm->getRank() )
+                         ? global_comm->getRank()
+                         : -1;
+    int global_root = -1;
+    Teuchos::reduceAll<int, int>( *global_comm, Teuchos::REDUCE_MAX,
+                                  local_root,
+                                  Teuchos::Ptr<int>( &global_root ) );
+
+    // Send the map from that process to the processes outside of the local
+    // communicator. The data volume is the size of the local communicator.
+    if ( global_root >= 0 )
+    {
+        Teuchos::broadcast<int, int>( *global_comm, global_root,
+                                      Teuchos::Ptr<int>( &local_size ) );
+        d_l2g.resize( local_size );
+        Teuchos::broadcast<int, int>( *global_comm, global_root, local_size,
+                                      d_l2g.getRawPtr() );
     }
 }
 
@@ -106,14 +163,13 @@ CommIndexer::~CommIndexer() { /* ... */}
  */
 int CommIndexer::l2g( const int local_id ) const
 {
-    std::unordered_map<int, int>::const_iterator l2g_pair =
-        d_l2gmap.find( local_id );
-    return ( l2g_pair != d_l2gmap.end() ) ? l2g_pair->second : -1;
+    return ( 0 <= local_id && local_id < d_l2g.size() ) ? d_l2g[local_id]
+                                                        : -1;
 }
 
 //---------------------------------------------------------------------------//
 //! Return the size of the local to global map.
-int CommIndexer::size() const { return d_l2gmap.size(); }
+int CommIndexer::size() const { return d_l2g.size(); }
 
 //---------------------------------------------------------------------------//
 // Return true if the indexer is valid on this process (local_comm is
@@ -41,8 +41,7 @@
 #ifndef DTK_COMMINDEXER_HPP
 #define DTK_COMMINDEXER_HPP
 
-#include <unordered_map>
-
+#include <Teuchos_Array.hpp>
 #include <Teuchos_Comm.hpp>
 #include <Teuchos_RCP.hpp>
 
@@ -85,8 +84,8 @@ class CommIndexer
     // nonnull).
     bool d_is_valid;
 
-    // Local to global process id map.
-    std::unordered_map<int, int> d_l2gmap;
+    // Local to global process id map indexed by local process id.
+    Teuchos::Array<int> d_l2g;
 };
 
 } // end namespace DataTransferKit
@@ -38,12 +38,9 @@
  */
 //---------------------------------------------------------------------------//
 
-#include <algorithm>
-
 #include "DTK_CommTools.hpp"
 #include "DTK_DBC.hpp"
 
-#include <Teuchos_Array.hpp>
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_DefaultComm.hpp>
 #include <Teuchos_OpaqueWrapper.hpp>
@@ -146,39 +143,11 @@ void CommTools::unite( const RCP_Comm &comm_A, const RCP_Comm &comm_B,
         getCommWorld( comm_world );
     }
 
-    Teuchos::Array<int> existence( comm_world->getSize(), 0 );
-    Teuchos::Array<int> existence_copy( comm_world->getSize(), 0 );
-
-    if ( !comm_A.is_null() )
-    {
-        existence[comm_world->getRank()] += 1;
-    }
-
-    if ( !comm_B.is_null() )
-    {
-        existence[comm_world->getRank()] += 1;
-    }
-    comm_world->barrier();
-
-    Teuchos::reduceAll<int, int>( *comm_world, Teuchos::REDUCE_SUM,
-                                  (int)existence.size(), &existence[0],
-                                  &existence_copy[0] );
-
-    int subrank;
-    Teuchos::Array<int> subranks;
-    Teuchos::Array<int>::const_iterator exist_begin = existence_copy.begin();
-    Teuchos::Array<int>::const_iterator exist_iterator;
-    for ( exist_iterator = existence_copy.begin();
-          exist_iterator != existence_copy.end(); ++exist_iterator )
-    {
-        if ( *exist_iterator > 0 )
-        {
-            subrank = std::distance( exist_begin, exist_iterator );
-            subranks.push_back( subrank );
-        }
-    }
-
-    comm_union = comm_world->createSubcommunicator( subranks() );
+    // Split off the processes that are in either communicator. This is a
+    // single split of the global communicator, keyed by global rank, so no
+    // global arrays are formed.
+    int color = ( !comm_A.is_null() || !comm_B.is_null() ) ? 0 : -1;
+    comm_union = comm_world->split( color, comm_world->getRank() );
 }
 
 //---------------------------------------------------------------------------//
@@ -208,38 +177,11 @@ void CommTools::intersect( const RCP_Comm &comm_A, const RCP_Comm &comm_B,
         getCommWorld( comm_world );
     }
 
-    Teuchos::Array<int> existence( comm_world->getSize(), 0 );
-    Teuchos::Array<int> existence_copy( comm_world->getSize(), 0 );
-
-    if ( !comm_A.is_null() )
-    {
-        existence[comm_world->getRank()] += 1;
-    }
-
-    if ( !comm_B.is_null() )
-    {
-        existence[comm_world->getRank()] += 1;
-    }
-
-    Teuchos::reduceAll<int, int>( *comm_world, Teuchos::REDUCE_SUM,
-                                  (int)existence.size(), &existence[0],
-                                  &existence_copy[0] );
-
-    int subrank;
-    Teuchos::Array<int> subranks;
-    Teuchos::Array<int>::const_iterator exist_begin = existence_copy.begin();
-    Teuchos::Array<int>::const_iterator exist_iterator;
-    for ( exist_iterator = existence_copy.begin();
-          exist_iterator != existence_copy.end(); ++exist_iterator )
-    {
-        if ( *exist_iterator == 2 )
-        {
-            subrank = std::distance( exist_begin, exist_iterator );
-            subranks.push_back( subrank );
-        }
-    }
-
-    comm_intersection = comm_world->createSubcommunicator( subranks() );
+    // Split off the processes that are in both communicators. This is a
+    // single split of the global communicator, keyed by global rank, so no
+    // global arrays are formed.
+    int color = ( !comm_A.is_null() && !comm_B.is_null() ) ? 0 : -1;
+    comm_intersection = comm_world->split( color, comm_world->getRank() );
 }
 
 //---------------------------------------------------------------------------//
@@ -45,6 +45,7 @@
 #include "DTK_MeshTraits.hpp"
 
 #include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_ArrayView.hpp>
 
 namespace DataTransferKit
 {
@@ -126,12 +127,64 @@ class FieldEvaluator
     virtual FieldType
     evaluate( const Teuchos::ArrayRCP<GlobalOrdinal> &elements,
               const Teuchos::ArrayRCP<double> &coords ) = 0;
+
+    /*!
+     * \brief Get the dimension of the fields this evaluator returns.
+     *
+     * Maps use this on processes without target data to size the buffer
+     * passed to evaluateInto(). The default returns 0, meaning the dimension
+     * is not known before evaluation, and those processes call evaluate()
+     * instead.
+     *
+     * \return The field dimension or 0 if it is not known.
+     */
+    virtual int fieldDimension() const { return 0; }
+
+    /*!
+     * \brief Evaluate the function in the given geometric objects at the
+     * given coordinates and write the evaluations into a caller-provided
+     * buffer.
+     *
+     * Maps call this on every apply with the same buffer so an evaluator that
+     * overrides it can evaluate without allocating. The default
+     * implementation calls evaluate() and copies the result into the buffer.
+     *
+     * \param elements an array of valid geometric object global ordinals in
+     * which to evaluate the field. Coordinates in the same geometric object
+     * are given in a contiguous block and the blocks are sorted by global
+     * ordinal.
+     *
+     * \param coords an array of blocked coordinates
+     * { x0, x1, x2, ... , xN, y0, y1, y2, ... , yN, z0, z1, z2, ... , zN }
+     * at which to evaluate the field. Coordinates { xN, yN, zN } should be
+     * evaluated in the Nth element in the elements vector.
+     *
+     * \param field_dim The dimension of the field to evaluate.
+     *
+     * \param values The evaluated function values blocked by field dimension
+     * { f0_0, f0_1, ... , f0_N, f1_0, ... , f1_N, ... }. This buffer is of
+     * length field_dim times the length of the elements input vector. For
+     * those coordinates that can't be evaluated in the given element, write
+     * 0 in their position.
+     */
+    virtual void evaluateInto( const Teuchos::ArrayRCP<GlobalOrdinal> &elements,
+                               const Teuchos::ArrayRCP<double> &coords,
+                               const int field_dim,
+                               const Teuchos::ArrayView<value_type> &values );
 };
 
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
 
+//---------------------------------------------------------------------------//
+// Template includes.
+//---------------------------------------------------------------------------//
+
+#include "DTK_FieldEvaluator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
 #endif // end DTK_FIELDEVALUATOR_HPP
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_FieldEvaluator_def.hpp
+ * \author Stuart R. Slattery
+ * \brief Field evaluator definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_FIELDEVALUATOR_DEF_HPP
+#define DTK_FIELDEVALUATOR_DEF_HPP
+
+#include <algorithm>
+#include <iterator>
+
+#include "DTK_DBC.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the function into a caller-provided buffer. The default
+ * implementation evaluates into a new field and copies it into the buffer.
+ */
+template <class GlobalOrdinal, class FieldType>
+void FieldEvaluator<GlobalOrdinal, FieldType>::evaluateInto(
+    const Teuchos::ArrayRCP<GlobalOrdinal> &elements,
+    const Teuchos::ArrayRCP<double> &coords, const int field_dim,
+    const Teuchos::ArrayView<value_type> &values )
+{
+    FieldType evaluations = this->evaluate( elements, coords );
+    DTK_INSIST( FT::dim( evaluations ) == field_dim );
+    DTK_INSIST( std::distance( FT::begin( evaluations ),
+                               FT::end( evaluations ) ) == values.size() );
+    std::copy( FT::begin( evaluations ), FT::end( evaluations ),
+               values.begin() );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+#endif // end DTK_FIELDEVALUATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_FieldEvaluator_def.hpp
+//---------------------------------------------------------------------------//
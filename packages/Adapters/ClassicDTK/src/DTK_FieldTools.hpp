@@ -47,6 +47,7 @@
 #include <Teuchos_Array.hpp>
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_Comm.hpp>
+#include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_RCP.hpp>
 
 namespace DataTransferKit
@@ -172,6 +173,13 @@ class FieldTools
     static BoundingBox coordGlobalBoundingBox( const FieldType &field,
                                                const RCP_Comm &comm );
     //@}
+
+  private:
+    // Reduce a set of per-dimension values with a single collective.
+    static void reduceDims( const Teuchos::Comm<int> &comm,
+                            const Teuchos::EReductionType reduct_type,
+                            const Teuchos::Array<value_type> &local_values,
+                            Teuchos::Array<value_type> &global_values );
 };
 
 } // end namepsace DataTransferKit
@@ -378,24 +378,27 @@ void FieldTools<FieldType>::normInf( const FieldType &field,
                                      const RCP_Comm &comm,
                                      Teuchos::Array<value_type> &norms )
 {
-    norms.resize( FT::dim( field ) );
-    value_type local_max, local_min, local_norm;
-    for ( int d = 0; d < FT::dim( field ); ++d )
+    int dim = FT::dim( field );
+    Teuchos::Array<value_type> local_norms( dim, 0.0 );
+    if ( !FT::empty( field ) )
     {
-        norms[d] = 0.0;
-
-        local_max =
-            *std::max_element( dimBegin( field, d ), dimEnd( field, d ) );
-
-        local_min =
-            *std::min_element( dimBegin( field, d ), dimEnd( field, d ) );
+        value_type local_max, local_min;
+        for ( int d = 0; d < dim; ++d )
+        {
+            local_max =
+                *std::max_element( dimBegin( field, d ), dimEnd( field, d ) );
 
-        local_norm = std::max( std::abs( local_max ), std::abs( local_min ) );
+            local_min =
+                *std::min_element( dimBegin( field, d ), dimEnd( field, d ) );
 
-        Teuchos::reduceAll<int, value_type>(
-            *comm, Teuchos::REDUCE_MAX, local_norm,
-            Teuchos::Ptr<value_type>( &norms[d] ) );
+            local_norms[d] =
+                std::max( std::abs( local_max ), std::abs( local_min ) );
+        }
     }
+
+    // Reduce all dimensions at once.
+    norms.resize( dim );
+    reduceDims( *comm, Teuchos::REDUCE_MAX, local_norms, norms );
 }
 
 //---------------------------------------------------------------------------//
@@ -413,24 +416,21 @@ template <class FieldType>
 void FieldTools<FieldType>::norm1( const FieldType &field, const RCP_Comm &comm,
                                    Teuchos::Array<value_type> &norms )
 {
-    norms.resize( FT::dim( field ) );
+    int dim = FT::dim( field );
+    Teuchos::Array<value_type> local_norms( dim, 0.0 );
     const_iterator dim_iterator;
-    value_type local_norm;
-    for ( int d = 0; d < FT::dim( field ); ++d )
+    for ( int d = 0; d < dim; ++d )
     {
-        norms[d] = 0.0;
-        local_norm = 0.0;
-
         for ( dim_iterator = dimBegin( field, d );
               dim_iterator != dimEnd( field, d ); ++dim_iterator )
         {
-            local_norm += std::abs( *dim_iterator );
+            local_norms[d] += std::abs( *dim_iterator );
         }
-
-        Teuchos::reduceAll<int, value_type>(
-            *comm, Teuchos::REDUCE_SUM, local_norm,
-            Teuchos::Ptr<value_type>( &norms[d] ) );
     }
+
+    // Reduce all dimensions at once.
+    norms.resize( dim );
+    reduceDims( *comm, Teuchos::REDUCE_SUM, local_norms, norms );
 }
 
 //---------------------------------------------------------------------------//
@@ -448,24 +448,24 @@ template <class FieldType>
 void FieldTools<FieldType>::norm2( const FieldType &field, const RCP_Comm &comm,
                                    Teuchos::Array<value_type> &norms )
 {
-    norms.resize( FT::dim( field ) );
+    int dim = FT::dim( field );
+    Teuchos::Array<value_type> local_norms( dim, 0.0 );
     const_iterator dim_iterator;
-    value_type local_norm;
-    for ( int d = 0; d < FT::dim( field ); ++d )
+    for ( int d = 0; d < dim; ++d )
     {
-        norms[d] = 0.0;
-        local_norm = 0.0;
-
         for ( dim_iterator = dimBegin( field, d );
               dim_iterator != dimEnd( field, d ); ++dim_iterator )
         {
-            local_norm += std::abs( ( *dim_iterator ) * ( *dim_iterator ) );
+            local_norms[d] +=
+                std::abs( ( *dim_iterator ) * ( *dim_iterator ) );
         }
+    }
 
-        Teuchos::reduceAll<int, value_type>(
-            *comm, Teuchos::REDUCE_SUM, local_norm,
-            Teuchos::Ptr<value_type>( &norms[d] ) );
-
+    // Reduce all dimensions at once.
+    norms.resize( dim );
+    reduceDims( *comm, Teuchos::REDUCE_SUM, local_norms, norms );
+    for ( int d = 0; d < dim; ++d )
+    {
         norms[d] = std::pow( norms[d], 1.0 / 2.0 );
     }
 }
@@ -489,14 +489,12 @@ void FieldTools<FieldType>::normQ( const FieldType &field, const RCP_Comm &comm,
                                    Teuchos::Array<value_type> &norms )
 {
     DTK_REQUIRE( q > 0 );
-    norms.resize( FT::dim( field ) );
+    int dim = FT::dim( field );
+    Teuchos::Array<value_type> local_norms( dim, 0.0 );
     const_iterator dim_iterator;
-    value_type local_norm, element_product;
-    for ( int d = 0; d < FT::dim( field ); ++d )
+    value_type element_product;
+    for ( int d = 0; d < dim; ++d )
     {
-        norms[d] = 0.0;
-        local_norm = 0.0;
-
         for ( dim_iterator = dimBegin( field, d );
               dim_iterator != dimEnd( field, d ); ++dim_iterator )
         {
@@ -506,13 +504,15 @@ void FieldTools<FieldType>::normQ( const FieldType &field, const RCP_Comm &comm,
                 element_product *= std::abs( *dim_iterator );
             }
 
-            local_norm += element_product;
+            local_norms[d] += element_product;
         }
+    }
 
-        Teuchos::reduceAll<int, value_type>(
-            *comm, Teuchos::REDUCE_SUM, local_norm,
-            Teuchos::Ptr<value_type>( &norms[d] ) );
-
+    // Reduce all dimensions at once.
+    norms.resize( dim );
+    reduceDims( *comm, Teuchos::REDUCE_SUM, local_norms, norms );
+    for ( int d = 0; d < dim; ++d )
+    {
         norms[d] = std::pow( norms[d], 1.0 / q );
     }
 }
@@ -533,29 +533,32 @@ void FieldTools<FieldType>::average( const FieldType &field,
                                      const RCP_Comm &comm,
                                      Teuchos::Array<value_type> &averages )
 {
-    size_type global_length = FieldTools<FieldType>::globalSize( field, comm );
-    DTK_REQUIRE( global_length > 0 );
-
-    averages.resize( FT::dim( field ) );
-    size_type dim_length = global_length / FT::dim( field );
+    // The local field size is reduced along with the sums so the average
+    // needs a single collective.
+    int dim = FT::dim( field );
+    Teuchos::Array<value_type> local_sums( dim + 1, 0.0 );
     const_iterator dim_iterator;
-    value_type local_sum;
-    for ( int d = 0; d < FT::dim( field ); ++d )
+    for ( int d = 0; d < dim; ++d )
     {
-        averages[d] = 0.0;
-        local_sum = 0.0;
-
         for ( dim_iterator = dimBegin( field, d );
               dim_iterator != dimEnd( field, d ); ++dim_iterator )
         {
-            local_sum += *dim_iterator;
+            local_sums[d] += *dim_iterator;
         }
+    }
+    local_sums[dim] = Teuchos::as<value_type>( FT::size( field ) );
 
-        Teuchos::reduceAll<int, value_type>(
-            *comm, Teuchos::REDUCE_SUM, local_sum,
-            Teuchos::Ptr<value_type>( &averages[d] ) );
+    Teuchos::Array<value_type> global_sums( dim + 1 );
+    reduceDims( *comm, Teuchos::REDUCE_SUM, local_sums, global_sums );
+
+    size_type global_length = Teuchos::as<size_type>( global_sums[dim] );
+    DTK_REQUIRE( global_length > 0 );
+    size_type dim_length = global_length / dim;
 
-        averages[d] /= dim_length;
+    averages.resize( dim );
+    for ( int d = 0; d < dim; ++d )
+    {
+        averages[d] = global_sums[d] / dim_length;
     }
 }
 
@@ -646,48 +649,40 @@ BoundingBox
 FieldTools<FieldType>::coordGlobalBoundingBox( const FieldType &field,
                                                const RCP_Comm &comm )
 {
-    Teuchos::Tuple<double, 6> local_bounds =
-        Teuchos::tuple( Teuchos::ScalarTraits<double>::rmax(),
-                        Teuchos::ScalarTraits<double>::rmax(),
-                        Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax() );
+    Teuchos::Tuple<double, 6> local_bounds = BoundingBox::emptyBounds();
     if ( !FT::empty( field ) )
     {
-        BoundingBox local_box = coordLocalBoundingBox( field );
-        local_bounds = local_box.getBounds();
+        local_bounds = coordLocalBoundingBox( field ).getBounds();
     }
+    return BoundingBox::globalUnion( *comm, local_bounds );
+}
 
-    double global_x_min, global_y_min, global_z_min;
-    double global_x_max, global_y_max, global_z_max;
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN,
-                                     local_bounds[0],
-                                     Teuchos::Ptr<double>( &global_x_min ) );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN,
-                                     local_bounds[1],
-                                     Teuchos::Ptr<double>( &global_y_min ) );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN,
-                                     local_bounds[2],
-                                     Teuchos::Ptr<double>( &global_z_min ) );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX,
-                                     local_bounds[3],
-                                     Teuchos::Ptr<double>( &global_x_max ) );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX,
-                                     local_bounds[4],
-                                     Teuchos::Ptr<double>( &global_y_max ) );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX,
-                                     local_bounds[5],
-                                     Teuchos::Ptr<double>( &global_z_max ) );
-
-    return BoundingBox( global_x_min, global_y_min, global_z_min, global_x_max,
-                        global_y_max, global_z_max );
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Reduce a set of per-dimension values with a single collective.
+ *
+ * \param comm The communicator over which to reduce.
+ *
+ * \param reduct_type The reduction to apply to each value.
+ *
+ * \param local_values The local values.
+ *
+ * \param global_values The reduced values. Must be the same length as the
+ * local values.
+ */
+template <class FieldType>
+void FieldTools<FieldType>::reduceDims(
+    const Teuchos::Comm<int> &comm, const Teuchos::EReductionType reduct_type,
+    const Teuchos::Array<value_type> &local_values,
+    Teuchos::Array<value_type> &global_values )
+{
+    DTK_REQUIRE( local_values.size() == global_values.size() );
+    if ( local_values.size() > 0 )
+    {
+        Teuchos::reduceAll<int, value_type>(
+            comm, reduct_type, local_values.size(), local_values.getRawPtr(),
+            global_values.getRawPtr() );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -194,42 +194,12 @@ BoundingBox GeometryManager<Geometry, GlobalOrdinal>::localBoundingBox() const
 template <class Geometry, class GlobalOrdinal>
 BoundingBox GeometryManager<Geometry, GlobalOrdinal>::globalBoundingBox() const
 {
-    Teuchos::Tuple<double, 6> local_bounds =
-        Teuchos::tuple( Teuchos::ScalarTraits<double>::rmax(),
-                        Teuchos::ScalarTraits<double>::rmax(),
-                        Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax(),
-                        -Teuchos::ScalarTraits<double>::rmax() );
+    Teuchos::Tuple<double, 6> local_bounds = BoundingBox::emptyBounds();
     if ( d_geometry.size() > 0 )
     {
-        BoundingBox local_box = localBoundingBox();
-        local_bounds = local_box.getBounds();
+        local_bounds = localBoundingBox().getBounds();
     }
-
-    double global_x_min, global_y_min, global_z_min;
-    double global_x_max, global_y_max, global_z_max;
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[0], &global_x_min );
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[1], &global_y_min );
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[2], &global_z_min );
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[3], &global_x_max );
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[4], &global_y_max );
-
-    Teuchos::reduceAll<int, double>( *d_comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[5], &global_z_max );
-
-    return BoundingBox( global_x_min, global_y_min, global_z_min, global_x_max,
-                        global_y_max, global_z_max );
+    return BoundingBox::globalUnion( *d_comm, local_bounds );
 }
 
 //---------------------------------------------------------------------------//
@@ -134,16 +134,9 @@ MeshManager<Mesh>::globalNumElements() const
 template <class Mesh>
 BoundingBox MeshManager<Mesh>::globalBoundingBox()
 {
-    double global_x_min = Teuchos::ScalarTraits<double>::rmax();
-    double global_y_min = Teuchos::ScalarTraits<double>::rmax();
-    double global_z_min = Teuchos::ScalarTraits<double>::rmax();
-    double global_x_max = -Teuchos::ScalarTraits<double>::rmax();
-    double global_y_max = -Teuchos::ScalarTraits<double>::rmax();
-    double global_z_max = -Teuchos::ScalarTraits<double>::rmax();
-
-    // Get the bounding box for each mesh block.
-    Teuchos::Tuple<double, 6> box_bounds;
-    BoundingBox block_box;
+    // Union the local bounding boxes of the non-empty mesh blocks.
+    Teuchos::Tuple<double, 6> local_bounds = BoundingBox::emptyBounds();
+    Teuchos::Tuple<double, 6> block_bounds;
     BlockIterator block_iterator;
     for ( block_iterator = d_mesh_blocks.begin();
           block_iterator != d_mesh_blocks.end(); ++block_iterator )
@@ -151,40 +144,20 @@ BoundingBox MeshManager<Mesh>::globalBoundingBox()
         // If the mesh block is empty, do nothing.
         if ( MeshTools<Mesh>::numVertices( *( *block_iterator ) ) > 0 )
         {
-            block_box = MeshTools<Mesh>::globalBoundingBox(
-                *( *block_iterator ), d_comm );
-
-            box_bounds = block_box.getBounds();
-
-            if ( box_bounds[0] < global_x_min )
-            {
-                global_x_min = box_bounds[0];
-            }
-            if ( box_bounds[1] < global_y_min )
-            {
-                global_y_min = box_bounds[1];
-            }
-            if ( box_bounds[2] < global_z_min )
-            {
-                global_z_min = box_bounds[2];
-            }
-            if ( box_bounds[3] > global_x_max )
-            {
-                global_x_max = box_bounds[3];
-            }
-            if ( box_bounds[4] > global_y_max )
-            {
-                global_y_max = box_bounds[4];
-            }
-            if ( box_bounds[5] > global_z_max )
+            block_bounds =
+                MeshTools<Mesh>::localBoundingBox( *( *block_iterator ) )
+                    .getBounds();
+            for ( int d = 0; d < 3; ++d )
             {
-                global_z_max = box_bounds[5];
+                local_bounds[d] = std::min( local_bounds[d], block_bounds[d] );
+                local_bounds[d + 3] =
+                    std::max( local_bounds[d + 3], block_bounds[d + 3] );
             }
         }
     }
 
-    return BoundingBox( global_x_min, global_y_min, global_z_min, global_x_max,
-                        global_y_max, global_z_max );
+    // Reduce over all blocks at once.
+    return BoundingBox::globalUnion( *d_comm, local_bounds );
 }
 
 //---------------------------------------------------------------------------//
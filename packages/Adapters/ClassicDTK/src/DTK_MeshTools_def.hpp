@@ -408,32 +408,8 @@ template <class Mesh>
 BoundingBox MeshTools<Mesh>::globalBoundingBox( const Mesh &mesh,
                                                 const RCP_Comm &comm )
 {
-    BoundingBox local_box = localBoundingBox( mesh );
-    Teuchos::Tuple<double, 6> local_bounds = local_box.getBounds();
-
-    double global_x_min, global_y_min, global_z_min;
-    double global_x_max, global_y_max, global_z_max;
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[0], &global_x_min );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[1], &global_y_min );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MIN, 1,
-                                     &local_bounds[2], &global_z_min );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[3], &global_x_max );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[4], &global_y_max );
-
-    Teuchos::reduceAll<int, double>( *comm, Teuchos::REDUCE_MAX, 1,
-                                     &local_bounds[5], &global_z_max );
-
-    return BoundingBox( global_x_min, global_y_min, global_z_min, global_x_max,
-                        global_y_max, global_z_max );
+    return BoundingBox::globalUnion( *comm,
+                                     localBoundingBox( mesh ).getBounds() );
 }
 
 //---------------------------------------------------------------------------//
@@ -42,7 +42,6 @@
 #define DTK_SHAREDDOMAINMAP_HPP
 
 #include "DTK_BasicEntitySet.hpp"
-#include "DTK_CommIndexer.hpp"
 #include "DTK_ConsistentInterpolationOperator.hpp"
 #include "DTK_EntitySet.hpp"
 
@@ -56,12 +55,14 @@
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_ArrayView.hpp>
 #include <Teuchos_Comm.hpp>
+#include <Teuchos_Describable.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ScalarTraits.hpp>
 
 #include <Tpetra_Directory.hpp>
 #include <Tpetra_Import.hpp>
 #include <Tpetra_Map.hpp>
+#include <Tpetra_MultiVector.hpp>
 
 namespace DataTransferKit
 {
@@ -123,7 +124,8 @@ class SharedDomainMap
 
     // Constructor.
     SharedDomainMap( const RCP_Comm &comm, const int dimension,
-                     bool store_missed_points = false );
+                     bool store_missed_points = false,
+                     bool cache_node_coords = false );
 
     // Generate the shared domain map.
     void setup( const RCP_MeshManager &source_mesh_manager,
@@ -149,6 +151,12 @@ class SharedDomainMap
     computePointOrdinals( const RCP_CoordFieldManager &target_coord_manager,
                           Teuchos::Array<GlobalOrdinal> &target_ordinals );
 
+    // Get a persistent multivector over a map.
+    template <class Scalar>
+    static Teuchos::RCP<Tpetra::MultiVector<Scalar, int, GlobalOrdinal>>
+    persistentVector( Teuchos::RCP<Teuchos::Describable> &cache,
+                      const RCP_TpetraMap &map, const int field_dim );
+
   private:
     // Communicator.
     RCP_Comm d_comm;
@@ -159,11 +167,8 @@ class SharedDomainMap
     // Boolean for storing missed points in the mapping.
     bool d_store_missed_points;
 
-    // Process indexer for the source application.
-    DataTransferKit::CommIndexer d_source_indexer;
-
-    // Process indexer for the target application.
-    DataTransferKit::CommIndexer d_target_indexer;
+    // Boolean for caching the source element node coordinates.
+    bool d_cache_node_coords;
 
     // Indices for target points missed in the mapping.
     Teuchos::Array<GlobalOrdinal> d_missed_points;
@@ -177,6 +182,12 @@ class SharedDomainMap
     // Source-to-target importer.
     RCP_TpetraImport d_source_to_target_importer;
 
+    // Source field vector reused between applications.
+    Teuchos::RCP<Teuchos::Describable> d_source_vector;
+
+    // Target field vector reused between applications.
+    Teuchos::RCP<Teuchos::Describable> d_target_vector;
+
     // Local source geometries.
     Teuchos::Array<GlobalOrdinal> d_source_geometry;
 
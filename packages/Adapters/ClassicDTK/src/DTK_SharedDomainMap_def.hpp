@@ -42,7 +42,7 @@
 #define DTK_SHAREDDOMAINMAP_DEF_HPP
 
 #include <algorithm>
-#include <unordered_map>
+#include <numeric>
 
 #include "DTK_DBC.hpp"
 #include "DTK_ParallelSearch.hpp"
@@ -79,13 +79,20 @@ namespace DataTransferKit
  * \param store_missed_points Set to true if it is desired to keep track of
  * the local target points missed during map generation. The default value is
  * false.
+ *
+ * \param cache_node_coords Set to true to store the node coordinates of each
+ * source element contiguously. This speeds up the element queries of the
+ * search at the cost of duplicating the coordinates of shared nodes. The
+ * default value is false.
  */
 template <class Mesh, class CoordinateField>
 SharedDomainMap<Mesh, CoordinateField>::SharedDomainMap(
-    const RCP_Comm &comm, const int dimension, bool store_missed_points )
+    const RCP_Comm &comm, const int dimension, bool store_missed_points,
+    bool cache_node_coords )
     : d_comm( comm )
     , d_dimension( dimension )
     , d_store_missed_points( store_missed_points )
+    , d_cache_node_coords( cache_node_coords )
 { /* ... */
 }
 
@@ -121,20 +128,6 @@ void SharedDomainMap<Mesh, CoordinateField>::setup(
     if ( target_coord_manager.is_null() )
         target_exists = false;
 
-    // Create local to global process indexers for the managers.
-    RCP_Comm source_comm;
-    if ( source_exists )
-    {
-        source_comm = source_mesh_manager->comm();
-    }
-    RCP_Comm target_comm;
-    if ( target_exists )
-    {
-        target_comm = target_coord_manager->comm();
-    }
-    d_source_indexer = CommIndexer( d_comm, source_comm );
-    d_target_indexer = CommIndexer( d_comm, target_comm );
-
     // Check the source and target dimensions for consistency.
     if ( source_exists )
     {
@@ -152,8 +145,8 @@ void SharedDomainMap<Mesh, CoordinateField>::setup(
 
     // Create an entity set from the local source mesh.
     Teuchos::RCP<DataTransferKit::ClassicMesh<Mesh>> classic_mesh =
-        Teuchos::rcp(
-            new DataTransferKit::ClassicMesh<Mesh>( source_mesh_manager ) );
+        Teuchos::rcp( new DataTransferKit::ClassicMesh<Mesh>(
+            source_mesh_manager, d_cache_node_coords ) );
     ClassicMeshEntitySet<Mesh> source_entity_set( classic_mesh );
 
     // Create a local map.
@@ -210,61 +203,40 @@ void SharedDomainMap<Mesh, CoordinateField>::setup(
     // Build the mapping.
     // -----------------------
 
-    // Get the source-target parings.
-    EntityIterator source_begin = source_iterator.begin();
-    EntityIterator source_end = source_iterator.end();
+    // Get the source-target pairings. The search gives one source geometry
+    // for each target point found on this process which handles the local
+    // uniqueness problem. The tpetra import will handle the global
+    // uniqueness problem.
     Teuchos::Array<EntityId> found_targets;
-    Teuchos::Array<std::pair<EntityId, EntityId>> src_tgt_pairs;
-    for ( auto src_geom = source_begin; src_geom != source_end; ++src_geom )
-    {
-        // Get the target points found in this source geometry.
-        parallel_search.getRangeEntitiesFromDomain( src_geom->id(),
-                                                    found_targets );
-
-        // If we found any points, add them to the mapping.
-        for ( auto found_tgt : found_targets )
-        {
-            src_tgt_pairs.push_back(
-                std::make_pair( src_geom->id(), found_tgt ) );
-        }
-    }
-
-    // Filter the source-target pairings so we only find a target point in one
-    // geometry on this process. This handles the local uniqueness
-    // problem. The tpetra import will handle the global uniqueness problem.
-    auto sort_func = []( std::pair<EntityId, EntityId> a,
-                         std::pair<EntityId, EntityId> b ) {
-        return a.second < b.second;
-    };
-    std::sort( src_tgt_pairs.begin(), src_tgt_pairs.end(), sort_func );
-    auto unique_func = []( std::pair<EntityId, EntityId> a,
-                           std::pair<EntityId, EntityId> b ) {
-        return a.second == b.second;
-    };
-    auto unique_it =
-        std::unique( src_tgt_pairs.begin(), src_tgt_pairs.end(), unique_func );
+    Teuchos::Array<EntityId> found_sources;
+    Teuchos::Array<double> found_coords;
+    parallel_search.getUniqueRangePairings( found_targets, found_sources,
+                                            found_coords );
+
+    // Order the pairings by source geometry so the evaluator gets the target
+    // points in each geometry as a contiguous block.
+    int num_tgt = found_targets.size();
+    Teuchos::Array<int> tgt_order( num_tgt );
+    std::iota( tgt_order.begin(), tgt_order.end(), 0 );
+    std::stable_sort( tgt_order.begin(), tgt_order.end(),
+                      [&found_sources]( const int a, const int b ) {
+                          return found_sources[a] < found_sources[b];
+                      } );
 
     // Extract the mapping data.
-    int num_tgt = std::distance( src_tgt_pairs.begin(), unique_it );
     Teuchos::Array<GlobalOrdinal> source_ordinals( num_tgt );
     d_source_geometry.resize( num_tgt );
     d_target_coords.resize( num_tgt * d_dimension );
-    Teuchos::ArrayView<const double> tgt_coords;
+    int t = 0;
     for ( int i = 0; i < num_tgt; ++i )
     {
-        // Get the source geom id.
-        d_source_geometry[i] = src_tgt_pairs[i].first;
-
-        // Get the target point id.
-        source_ordinals[i] = src_tgt_pairs[i].second;
-
-        // Get the coordinates of the target point.
-        parallel_search.rangeParametricCoordinatesInDomain(
-            src_tgt_pairs[i].first, src_tgt_pairs[i].second, tgt_coords );
-
+        t = tgt_order[i];
+        d_source_geometry[i] = found_sources[t];
+        source_ordinals[i] = found_targets[t];
         for ( int d = 0; d < d_dimension; ++d )
         {
-            d_target_coords[d * num_tgt + i] = tgt_coords[d];
+            d_target_coords[d * num_tgt + i] =
+                found_coords[t * d_dimension + d];
         }
     }
 
@@ -280,25 +252,30 @@ void SharedDomainMap<Mesh, CoordinateField>::setup(
     d_source_to_target_importer = Teuchos::rcp(
         new Tpetra::Import<int, GlobalOrdinal>( d_source_map, d_target_map ) );
 
+    // The field vectors of a previous map are no longer valid.
+    d_source_vector = Teuchos::null;
+    d_target_vector = Teuchos::null;
+
     // Extract the missed points.
     if ( d_store_missed_points )
     {
-        std::unordered_map<GlobalOrdinal, int> target_g2l;
-        int local_num_targets = target_ordinals.size();
-        for ( int t = 0; t < local_num_targets; ++t )
-        {
-            target_g2l.emplace( target_ordinals[t], t );
-        }
-
+        // The local target ordinals are contiguous so the local index of a
+        // missed point is its offset from the first local ordinal.
         Teuchos::ArrayView<const EntityId> missed =
             parallel_search.getMissedRangeEntityIds();
 
         int num_missed = missed.size();
+        int local_num_targets = target_ordinals.size();
         d_missed_points.resize( num_missed );
         for ( int i = 0; i < num_missed; ++i )
         {
-            DTK_CHECK( target_g2l.count( missed[i] ) );
-            d_missed_points[i] = target_g2l.find( missed[i] )->second;
+            DTK_CHECK( local_num_targets > 0 );
+            d_missed_points[i] = Teuchos::as<int>(
+                Teuchos::as<GlobalOrdinal>( missed[i] ) - target_ordinals[0] );
+            DTK_CHECK( 0 <= d_missed_points[i] &&
+                       d_missed_points[i] < local_num_targets );
+            DTK_CHECK( target_ordinals[d_missed_points[i]] ==
+                       Teuchos::as<GlobalOrdinal>( missed[i] ) );
         }
     }
 }
@@ -333,28 +310,10 @@ void SharedDomainMap<Mesh, CoordinateField>::apply(
     if ( target_space_manager.is_null() )
         target_exists = false;
 
-    // Evaluate the source function at the target points and construct a view
-    // of the function evaluations.
-    int source_dim = 0;
-    Teuchos::ArrayRCP<typename SFT::value_type> source_field_copy( 0, 0 );
-    if ( source_exists )
-    {
-        SourceField function_evaluations = source_evaluator->evaluate(
-            Teuchos::arcpFromArray( d_source_geometry ),
-            Teuchos::arcpFromArray( d_target_coords ) );
-
-        source_dim = SFT::dim( function_evaluations );
-
-        source_field_copy =
-            FieldTools<SourceField>::copy( function_evaluations );
-    }
-    Teuchos::broadcast<int, int>( *d_comm, d_source_indexer.l2g( 0 ),
-                                  Teuchos::Ptr<int>( &source_dim ) );
-
-    // Build a multivector for the function evaluations.
-    Tpetra::MultiVector<typename SFT::value_type, int, GlobalOrdinal>
-        source_vector( d_source_map, source_dim );
-    source_vector.get1dViewNonConst().deepCopy( source_field_copy() );
+    typedef Tpetra::MultiVector<typename SFT::value_type, int, GlobalOrdinal>
+        SourceVector;
+    typedef Tpetra::MultiVector<typename TFT::value_type, int, GlobalOrdinal>
+        TargetVector;
 
     // Construct a view of the target space.
     int target_dim = 0;
@@ -366,11 +325,71 @@ void SharedDomainMap<Mesh, CoordinateField>::apply(
 
         target_dim = TFT::dim( *target_space_manager->field() );
     }
-    Teuchos::broadcast<int, int>( *d_comm, d_target_indexer.l2g( 0 ),
-                                  Teuchos::Ptr<int>( &target_dim ) );
 
-    // Check that the source and target have the same field dimension.
-    DTK_REQUIRE( source_dim == target_dim );
+    // The field dimension is taken from the local source or target data. The
+    // source and target maps are empty on processes that have neither so the
+    // dimension does not have to be agreed on through communication. It is
+    // known up front if this process has target data or if the evaluator
+    // reports it.
+    int field_dim = 1;
+    bool known_dim = false;
+    if ( target_exists )
+    {
+        field_dim = target_dim;
+        known_dim = true;
+    }
+    else if ( source_exists && source_evaluator->fieldDimension() > 0 )
+    {
+        field_dim = source_evaluator->fieldDimension();
+        known_dim = true;
+    }
+
+    // Evaluate the source function at the target points directly into the
+    // persistent source vector if the field dimension is known.
+    Teuchos::RCP<SourceVector> source_vector;
+    if ( source_exists && known_dim )
+    {
+        DTK_REQUIRE( source_evaluator->fieldDimension() <= 0 ||
+                     source_evaluator->fieldDimension() == field_dim );
+        source_vector = persistentVector<typename SFT::value_type>(
+            d_source_vector, d_source_map, field_dim );
+        Teuchos::ArrayRCP<typename SFT::value_type> source_data =
+            source_vector->get1dViewNonConst();
+        source_evaluator->evaluateInto(
+            Teuchos::arcpFromArray( d_source_geometry ),
+            Teuchos::arcpFromArray( d_target_coords ), field_dim,
+            source_data() );
+    }
+
+    // Otherwise evaluate into a new field to get its dimension and copy the
+    // evaluations into the source vector.
+    else if ( source_exists )
+    {
+        SourceField function_evaluations = source_evaluator->evaluate(
+            Teuchos::arcpFromArray( d_source_geometry ),
+            Teuchos::arcpFromArray( d_target_coords ) );
+
+        // Check that the source and target have the same field dimension.
+        int source_dim = SFT::dim( function_evaluations );
+        DTK_REQUIRE( !target_exists || source_dim == target_dim );
+        field_dim = source_dim;
+
+        source_vector = persistentVector<typename SFT::value_type>(
+            d_source_vector, d_source_map, field_dim );
+        Teuchos::ArrayRCP<typename SFT::value_type> source_data =
+            source_vector->get1dViewNonConst();
+        DTK_REQUIRE( std::distance( SFT::begin( function_evaluations ),
+                                    SFT::end( function_evaluations ) ) ==
+                     source_data.size() );
+        std::copy( SFT::begin( function_evaluations ),
+                   SFT::end( function_evaluations ), source_data.begin() );
+    }
+    else
+    {
+        DTK_REQUIRE( 0 == d_source_map->getNodeNumElements() );
+        source_vector = persistentVector<typename SFT::value_type>(
+            d_source_vector, d_source_map, field_dim );
+    }
 
     // Verify that the target space has the proper amount of memory allocated.
     if ( target_exists )
@@ -381,23 +400,21 @@ void SharedDomainMap<Mesh, CoordinateField>::apply(
                 target_dim );
     }
 
-    // Build a multivector for the target space.
-    Tpetra::MultiVector<typename TFT::value_type, int, GlobalOrdinal>
-        target_vector( d_target_map, target_dim );
-
-    // Fill the target space with zeros so that points we didn't map get some
-    // data.
+    // Move the data from the source decomposition to the target
+    // decomposition. The import only writes the mapped points so the points
+    // we didn't map keep the zeros the target vector was built with.
+    Teuchos::RCP<TargetVector> target_vector =
+        persistentVector<typename TFT::value_type>( d_target_vector,
+                                                    d_target_map, field_dim );
+    target_vector->doImport( *source_vector, *d_source_to_target_importer,
+                             Tpetra::INSERT );
     if ( target_exists )
     {
-        FieldTools<TargetField>::putScalar( *target_space_manager->field(),
-                                            0.0 );
+        Teuchos::ArrayRCP<const typename TFT::value_type> target_data =
+            target_vector->get1dView();
+        std::copy( target_data.begin(), target_data.end(),
+                   target_field_view.begin() );
     }
-
-    // Move the data from the source decomposition to the target
-    // decomposition.
-    target_vector.doImport( source_vector, *d_source_to_target_importer,
-                            Tpetra::INSERT );
-    target_field_view.deepCopy( target_vector.get1dView()() );
 }
 
 //---------------------------------------------------------------------------//
@@ -446,7 +463,8 @@ SharedDomainMap<Mesh, CoordinateField>::getMissedTargetPoints()
  * \param target_coords The coordinates to compute global ordinals for.
  *
  * \param target_ordinals The computed globally unique ordinals for the target
- * coordinates.
+ * coordinates. The ordinals on a process are contiguous and increasing so a
+ * local index is the offset of an ordinal from the first local ordinal.
  */
 template <class Mesh, class CoordinateField>
 void SharedDomainMap<Mesh, CoordinateField>::computePointOrdinals(
@@ -480,6 +498,37 @@ void SharedDomainMap<Mesh, CoordinateField>::computePointOrdinals(
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get a persistent multivector over a map. The vector is only rebuilt
+ * if it does not exist yet or if the field scalar type or dimension changed
+ * so repeated applications do not allocate.
+ *
+ * \param cache The cached vector.
+ *
+ * \param map The map of the vector.
+ *
+ * \param field_dim The number of vectors.
+ */
+template <class Mesh, class CoordinateField>
+template <class Scalar>
+Teuchos::RCP<Tpetra::MultiVector<Scalar, int, GlobalOrdinal>>
+SharedDomainMap<Mesh, CoordinateField>::persistentVector(
+    Teuchos::RCP<Teuchos::Describable> &cache, const RCP_TpetraMap &map,
+    const int field_dim )
+{
+    typedef Tpetra::MultiVector<Scalar, int, GlobalOrdinal> VectorType;
+    Teuchos::RCP<VectorType> vector =
+        Teuchos::rcp_dynamic_cast<VectorType>( cache );
+    if ( vector.is_null() ||
+         Teuchos::as<int>( vector->getNumVectors() ) != field_dim )
+    {
+        vector = Teuchos::rcp( new VectorType( map, field_dim ) );
+        cache = vector;
+    }
+    return vector;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -41,7 +41,6 @@
 #ifndef DTK_VOLUMESOURCEMAP_HPP
 #define DTK_VOLUMESOURCEMAP_HPP
 
-#include "DTK_CommIndexer.hpp"
 #include "DTK_FieldEvaluator.hpp"
 #include "DTK_FieldManager.hpp"
 #include "DTK_FieldTraits.hpp"
@@ -52,11 +51,13 @@
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_ArrayView.hpp>
 #include <Teuchos_Comm.hpp>
+#include <Teuchos_Describable.hpp>
 #include <Teuchos_RCP.hpp>
 
 #include <Tpetra_Directory.hpp>
 #include <Tpetra_Import.hpp>
 #include <Tpetra_Map.hpp>
+#include <Tpetra_MultiVector.hpp>
 
 namespace DataTransferKit
 {
@@ -129,6 +130,12 @@ class VolumeSourceMap
     computePointOrdinals( const RCP_CoordFieldManager &target_coord_manager,
                           Teuchos::Array<GlobalOrdinal> &target_ordinals );
 
+    // Get a persistent multivector over a map.
+    template <class Scalar>
+    static Teuchos::RCP<Tpetra::MultiVector<Scalar, int, GlobalOrdinal>>
+    persistentVector( Teuchos::RCP<Teuchos::Describable> &cache,
+                      const RCP_TpetraMap &map, const int field_dim );
+
   private:
     // Communicator.
     RCP_Comm d_comm;
@@ -142,12 +149,6 @@ class VolumeSourceMap
     // Geometric tolerance.
     double d_geometric_tolerance;
 
-    // Process indexer for the source application.
-    DataTransferKit::CommIndexer d_source_indexer;
-
-    // Process indexer for the target application.
-    DataTransferKit::CommIndexer d_target_indexer;
-
     // Indices for target points missed in the mapping.
     Teuchos::Array<GlobalOrdinal> d_missed_points;
 
@@ -160,6 +161,12 @@ class VolumeSourceMap
     // Source-to-target importer.
     RCP_TpetraImport d_source_to_target_importer;
 
+    // Source field vector reused between applications.
+    Teuchos::RCP<Teuchos::Describable> d_source_vector;
+
+    // Target field vector reused between applications.
+    Teuchos::RCP<Teuchos::Describable> d_target_vector;
+
     // Local source geometries.
     Teuchos::Array<GlobalOrdinal> d_source_geometry;
 
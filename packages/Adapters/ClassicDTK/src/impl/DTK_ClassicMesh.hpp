@@ -41,6 +41,7 @@
 #ifndef DTK_CLASSICMESH_HPP
 #define DTK_CLASSICMESH_HPP
 
+#include <array>
 #include <unordered_map>
 
 #include "DTK_MeshManager.hpp"
@@ -49,6 +50,7 @@
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_ArrayView.hpp>
 #include <Teuchos_Comm.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_Tuple.hpp>
@@ -73,8 +75,17 @@ class ClassicMesh
     typedef MeshTraits<Mesh> MT;
     typedef typename MT::global_ordinal_type GlobalOrdinal;
 
-    // Constructor.
-    ClassicMesh( const Teuchos::RCP<MeshManager<Mesh>> &mesh_manager );
+    // Largest number of element node coordinates. The largest supported
+    // topology is the 27 node hexahedron.
+    static const int max_element_node_coords = 27 * 3;
+
+    // Fixed-capacity buffer for the coordinates of one element.
+    typedef std::array<double, max_element_node_coords> NodeCoordinateBuffer;
+
+    // Constructor. If cache_node_coords is true the coordinates of the
+    // element nodes are also stored contiguously for each element.
+    ClassicMesh( const Teuchos::RCP<MeshManager<Mesh>> &mesh_manager,
+                 const bool cache_node_coords = false );
 
     //! Get the number of mesh blocks.
     int getNumBlocks() const { return d_mesh_manager->getNumBlocks(); }
@@ -127,6 +138,19 @@ class ClassicMesh
     getElementNodeCoordinates( const GlobalOrdinal gid,
                                const int block_id ) const;
 
+    // Given an element local id and its block id get a view of the
+    // coordinates of the element nodes. The view is into the cached node
+    // coordinates if they were built and into the given buffer otherwise.
+    Teuchos::ArrayView<const double>
+    getLocalElementNodeCoordinates( const int element_lid, const int block_id,
+                                    NodeCoordinateBuffer &buffer ) const;
+
+    // Given an element local id and its block id fill a cell coordinate
+    // container with the coordinates of the element nodes.
+    void getLocalElementNodeCoordinates(
+        const int element_lid, const int block_id,
+        Intrepid::FieldContainer<double> &coords ) const;
+
     // Get the connectivity of an element.
     Teuchos::Array<SupportId>
     getElementConnectivity( const GlobalOrdinal gid, const int block_id ) const;
@@ -143,6 +167,12 @@ class ClassicMesh
     // Given a block id create its shards topology.
     shards::CellTopology createBlockTopology( const int block_id ) const;
 
+    // Gather the coordinates of the element nodes from the vertex
+    // coordinates.
+    void gatherElementNodeCoordinates( const int element_lid,
+                                       const int block_id,
+                                       double *coords ) const;
+
   private:
     // Classic mesh manager.
     Teuchos::RCP<MeshManager<Mesh>> d_mesh_manager;
@@ -170,6 +200,17 @@ class ClassicMesh
 
     // Pointer to permutation lists.
     Teuchos::Array<Teuchos::ArrayRCP<const int>> d_permutation;
+
+    // Block-wise element-node vertex local ids in permuted node order.
+    Teuchos::Array<Teuchos::Array<int>> d_element_vertex_lids;
+
+    // Block-wise element-node coordinates. Each element holds its nodes in
+    // permuted order with the coordinates of each node contiguous. Only
+    // built if node coordinate caching was requested. Otherwise empty.
+    Teuchos::Array<Teuchos::Array<double>> d_element_node_coords;
+
+    // True if the element-node coordinates are cached.
+    bool d_cache_node_coords;
 };
 
 //---------------------------------------------------------------------------//
@@ -64,7 +64,8 @@ class ClassicMeshElement : public Entity
   public:
     // Constructor.
     ClassicMeshElement( const Teuchos::Ptr<ClassicMesh<Mesh>> &mesh,
-                        const EntityId global_id, const int block_id );
+                        const EntityId global_id, const int block_id,
+                        const int element_lid );
 };
 
 //---------------------------------------------------------------------------//
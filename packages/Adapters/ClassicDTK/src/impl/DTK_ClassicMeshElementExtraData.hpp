@@ -41,8 +41,12 @@
 #ifndef DTK_CLASSICMESHELEMENTENTITYEXTRADATA_HPP
 #define DTK_CLASSICMESHELEMENTENTITYEXTRADATA_HPP
 
+#include "DTK_DBC.hpp"
+#include "DTK_Entity.hpp"
 #include "DTK_EntityExtraData.hpp"
 
+#include <Teuchos_RCP.hpp>
+
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
@@ -54,15 +58,34 @@ namespace DataTransferKit
 class ClassicMeshElementExtraData : public EntityExtraData
 {
   public:
-    ClassicMeshElementExtraData( const int block_id )
+    ClassicMeshElementExtraData( const int block_id, const int element_lid )
         : d_block_id( block_id )
+        , d_element_lid( element_lid )
     { /* ... */
     }
 
     // Block id.
     int d_block_id;
+
+    // Element local id in the block.
+    int d_element_lid;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the extra data of a classic mesh element. Every entity of a
+ * classic mesh carries this data so the cast is only checked in debug builds.
+ */
+inline const ClassicMeshElementExtraData &
+classicMeshElementExtraData( const Entity &entity )
+{
+    DTK_CHECK( Teuchos::nonnull(
+        Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
+            entity.extraData() ) ) );
+    return *static_cast<const ClassicMeshElementExtraData *>(
+        entity.extraData().getRawPtr() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -68,7 +68,8 @@ class ClassicMeshElementImpl : public EntityImpl
   public:
     // Default constructor.
     ClassicMeshElementImpl( const Teuchos::Ptr<ClassicMesh<Mesh>> &mesh,
-                            const EntityId global_id, const int block_id );
+                            const EntityId global_id, const int block_id,
+                            const int element_lid );
 
     //@{
     //! EntityImpl interface.
@@ -49,11 +49,12 @@ namespace DataTransferKit
 template <class Mesh>
 ClassicMeshElementImpl<Mesh>::ClassicMeshElementImpl(
     const Teuchos::Ptr<ClassicMesh<Mesh>> &mesh, const EntityId global_id,
-    const int block_id )
+    const int block_id, const int element_lid )
     : d_mesh( mesh )
     , d_id( global_id )
 {
-    d_extra_data = Teuchos::rcp( new ClassicMeshElementExtraData( block_id ) );
+    d_extra_data = Teuchos::rcp(
+        new ClassicMeshElementExtraData( block_id, element_lid ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -127,18 +128,21 @@ template <class Mesh>
 void ClassicMeshElementImpl<Mesh>::boundingBox(
     Teuchos::Tuple<double, 6> &bounds ) const
 {
-    Intrepid::FieldContainer<double> coords =
-        d_mesh->getElementNodeCoordinates( d_id, d_extra_data->d_block_id );
-    int num_nodes = coords.dimension( 1 );
-    int space_dim = coords.dimension( 2 );
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Teuchos::ArrayView<const double> coords =
+        d_mesh->getLocalElementNodeCoordinates(
+            d_extra_data->d_element_lid, d_extra_data->d_block_id, buffer );
+    int space_dim = d_mesh->dim();
+    int num_nodes = coords.size() / space_dim;
     double max = std::numeric_limits<double>::max();
     bounds = Teuchos::tuple( max, max, max, -max, -max, -max );
     for ( int n = 0; n < num_nodes; ++n )
     {
         for ( int d = 0; d < space_dim; ++d )
         {
-            bounds[d] = std::min( bounds[d], coords( 0, n, d ) );
-            bounds[d + 3] = std::max( bounds[d + 3], coords( 0, n, d ) );
+            bounds[d] = std::min( bounds[d], coords[n * space_dim + d] );
+            bounds[d + 3] =
+                std::max( bounds[d + 3], coords[n * space_dim + d] );
         }
     }
 }
@@ -49,6 +49,8 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
+#include <Intrepid_FieldContainer.hpp>
+
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
@@ -131,6 +133,20 @@ class ClassicMeshElementLocalMap : public EntityLocalMap
                               const Teuchos::ArrayView<const double>
                                   &reference_point ) const override;
 
+    /*!
+     * \brief Locate a set of points in a set of entities at once. The block
+     * topology is resolved once for each run of pairs in the same block.
+     * \param entities The entity of each pair.
+     * \param physical_points The physical point of each pair.
+     * \param reference_points The reference point of each pair.
+     * \param found Set to 1 if the point of a pair is in its entity.
+     */
+    void
+    locatePoints( const Teuchos::ArrayView<const Entity> &entities,
+                  const Teuchos::ArrayView<const double> &physical_points,
+                  const Teuchos::ArrayView<double> &reference_points,
+                  const Teuchos::ArrayView<int> &found ) const override;
+
     /*!
      * \brief (Forward Map) Map a reference point to the physical space of an
      * entity.
@@ -162,6 +178,20 @@ class ClassicMeshElementLocalMap : public EntityLocalMap
         const Teuchos::ArrayView<const double> &reference_point,
         const Teuchos::ArrayView<double> &normal ) const override;
 
+  private:
+    // Get the block id of an entity and the cell dimensions and address of
+    // its node coordinates. The coordinates are read in place from the mesh
+    // cache or gathered into the buffer.
+    int elementNodeCoordinates(
+        const Entity &entity,
+        typename ClassicMesh<Mesh>::NodeCoordinateBuffer &buffer,
+        Teuchos::Array<int> &cell_dims, double *&node_coords ) const;
+
+    // Check if a point is in the bounding box of a set of element nodes.
+    static bool
+    pointInNodeBox( const Teuchos::ArrayView<const double> &node_coords,
+                    const Teuchos::ArrayView<const double> &point );
+
   private:
     // Classic mesh.
     Teuchos::RCP<ClassicMesh<Mesh>> d_mesh;
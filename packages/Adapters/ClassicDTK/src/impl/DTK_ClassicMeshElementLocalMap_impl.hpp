@@ -41,6 +41,8 @@
 #ifndef DTK_CLASSICMESHELEMENTLOCALMAP_IMPL_HPP
 #define DTK_CLASSICMESHELEMENTLOCALMAP_IMPL_HPP
 
+#include <algorithm>
+
 #include "DTK_ClassicMeshElementExtraData.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_IntrepidCellLocalMap.hpp"
@@ -79,16 +81,15 @@ void ClassicMeshElementLocalMap<Mesh>::setParameters(
 template <class Mesh>
 double ClassicMeshElementLocalMap<Mesh>::measure( const Entity &entity ) const
 {
-    // Get the block id and topology.
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
+    // Get the entity coordinates and topology.
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Teuchos::Array<int> cell_dims( 3 );
+    double *node_coords = nullptr;
+    int block_id =
+        elementNodeCoordinates( entity, buffer, cell_dims, node_coords );
+    Intrepid::FieldContainer<double> entity_coords( cell_dims, node_coords );
     shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
 
-    // Get the entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        d_mesh->getElementNodeCoordinates( entity.id(), block_id );
-
     // Compute the measure.
     return IntrepidCellLocalMap::measure( entity_topo, entity_coords );
 }
@@ -99,16 +100,15 @@ template <class Mesh>
 void ClassicMeshElementLocalMap<Mesh>::centroid(
     const Entity &entity, const Teuchos::ArrayView<double> &centroid ) const
 {
-    // Get the block id and topology.
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
+    // Get the entity coordinates and topology.
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Teuchos::Array<int> cell_dims( 3 );
+    double *node_coords = nullptr;
+    int block_id =
+        elementNodeCoordinates( entity, buffer, cell_dims, node_coords );
+    Intrepid::FieldContainer<double> entity_coords( cell_dims, node_coords );
     shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
 
-    // Get the entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        d_mesh->getElementNodeCoordinates( entity.id(), block_id );
-
     // Compute the centroid of the element.
     IntrepidCellLocalMap::centroid( entity_topo, entity_coords, centroid );
 }
@@ -121,8 +121,13 @@ bool ClassicMeshElementLocalMap<Mesh>::isSafeToMapToReferenceFrame(
     const Entity &entity,
     const Teuchos::ArrayView<const double> &physical_point ) const
 {
-    return EntityLocalMap::isSafeToMapToReferenceFrame( entity,
-                                                        physical_point );
+    const ClassicMeshElementExtraData &extra_data =
+        classicMeshElementExtraData( entity );
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    return pointInNodeBox(
+        d_mesh->getLocalElementNodeCoordinates(
+            extra_data.d_element_lid, extra_data.d_block_id, buffer ),
+        physical_point );
 }
 
 //---------------------------------------------------------------------------//
@@ -134,16 +139,15 @@ bool ClassicMeshElementLocalMap<Mesh>::mapToReferenceFrame(
     const Teuchos::ArrayView<const double> &physical_point,
     const Teuchos::ArrayView<double> &reference_point ) const
 {
-    // Get the block id and topology.
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
+    // Get the entity coordinates and topology.
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Teuchos::Array<int> cell_dims( 3 );
+    double *node_coords = nullptr;
+    int block_id =
+        elementNodeCoordinates( entity, buffer, cell_dims, node_coords );
+    Intrepid::FieldContainer<double> entity_coords( cell_dims, node_coords );
     shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
 
-    // Get the entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        d_mesh->getElementNodeCoordinates( entity.id(), block_id );
-
     // Use the cell to perform the element mapping.
     return IntrepidCellLocalMap::mapToReferenceFrame(
         entity_topo, entity_coords, physical_point, reference_point );
@@ -157,20 +161,68 @@ bool ClassicMeshElementLocalMap<Mesh>::checkPointInclusion(
     const Teuchos::ArrayView<const double> &reference_point ) const
 {
     // Get the block id and topology.
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
+    int block_id = classicMeshElementExtraData( entity ).d_block_id;
     shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
 
-    // Get the entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        d_mesh->getElementNodeCoordinates( entity.id(), block_id );
-
     // Check point inclusion in the element.
     return IntrepidCellLocalMap::checkPointInclusion(
         entity_topo, reference_point, d_inclusion_tol );
 }
 
+//---------------------------------------------------------------------------//
+// Locate a set of points in a set of entities at once.
+template <class Mesh>
+void ClassicMeshElementLocalMap<Mesh>::locatePoints(
+    const Teuchos::ArrayView<const Entity> &entities,
+    const Teuchos::ArrayView<const double> &physical_points,
+    const Teuchos::ArrayView<double> &reference_points,
+    const Teuchos::ArrayView<int> &found ) const
+{
+    DTK_REQUIRE( physical_points.size() == reference_points.size() );
+    DTK_REQUIRE( entities.size() == found.size() );
+
+    int num_pairs = entities.size();
+    int space_dim = d_mesh->dim();
+    int block_id = -1;
+    shards::CellTopology entity_topo;
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Intrepid::FieldContainer<double> entity_coords;
+    for ( int p = 0; p < num_pairs; ++p )
+    {
+        const ClassicMeshElementExtraData &extra_data =
+            classicMeshElementExtraData( entities[p] );
+
+        // Candidates usually come from a single block so only resolve the
+        // topology when the block changes.
+        if ( extra_data.d_block_id != block_id )
+        {
+            block_id = extra_data.d_block_id;
+            entity_topo = d_mesh->getBlockTopology( block_id );
+            entity_coords.resize( 1, entity_topo.getNodeCount(), space_dim );
+        }
+
+        // Safeguard with the element nodes before doing the nonlinear map.
+        Teuchos::ArrayView<const double> point =
+            physical_points( p * space_dim, space_dim );
+        Teuchos::ArrayView<double> ref_point =
+            reference_points( p * space_dim, space_dim );
+        Teuchos::ArrayView<const double> node_coords =
+            d_mesh->getLocalElementNodeCoordinates( extra_data.d_element_lid,
+                                                    block_id, buffer );
+        found[p] = 0;
+        if ( pointInNodeBox( node_coords, point ) )
+        {
+            DTK_CHECK( node_coords.size() == entity_coords.size() );
+            std::copy( node_coords.begin(), node_coords.end(),
+                       &entity_coords[0] );
+            found[p] = IntrepidCellLocalMap::mapToReferenceFrame(
+                           entity_topo, entity_coords, point, ref_point ) &&
+                       IntrepidCellLocalMap::checkPointInclusion(
+                           entity_topo, ref_point, d_inclusion_tol );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Map a reference point to the physical space of an entity.
 template <class Mesh>
@@ -179,16 +231,15 @@ void ClassicMeshElementLocalMap<Mesh>::mapToPhysicalFrame(
     const Teuchos::ArrayView<const double> &reference_point,
     const Teuchos::ArrayView<double> &physical_point ) const
 {
-    // Get the block id and topology.
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
+    // Get the entity coordinates and topology.
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer buffer;
+    Teuchos::Array<int> cell_dims( 3 );
+    double *node_coords = nullptr;
+    int block_id =
+        elementNodeCoordinates( entity, buffer, cell_dims, node_coords );
+    Intrepid::FieldContainer<double> entity_coords( cell_dims, node_coords );
     shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
 
-    // Get the entity coordinates.
-    Intrepid::FieldContainer<double> entity_coords =
-        d_mesh->getElementNodeCoordinates( entity.id(), block_id );
-
     // Map from the element.
     IntrepidCellLocalMap::mapToPhysicalFrame( entity_topo, entity_coords,
                                               reference_point, physical_point );
@@ -206,6 +257,59 @@ void ClassicMeshElementLocalMap<Mesh>::normalAtReferencePoint(
     DTK_INSIST( !not_implemented );
 }
 
+//---------------------------------------------------------------------------//
+// Get the block id of an entity and the cell dimensions and address of its
+// node coordinates. The coordinates are only read through the returned
+// address so the cached coordinates may be wrapped without a copy.
+template <class Mesh>
+int ClassicMeshElementLocalMap<Mesh>::elementNodeCoordinates(
+    const Entity &entity,
+    typename ClassicMesh<Mesh>::NodeCoordinateBuffer &buffer,
+    Teuchos::Array<int> &cell_dims, double *&node_coords ) const
+{
+    DTK_REQUIRE( 3 == cell_dims.size() );
+    const ClassicMeshElementExtraData &extra_data =
+        classicMeshElementExtraData( entity );
+    Teuchos::ArrayView<const double> coords =
+        d_mesh->getLocalElementNodeCoordinates(
+            extra_data.d_element_lid, extra_data.d_block_id, buffer );
+    int space_dim = d_mesh->dim();
+    cell_dims[0] = 1;
+    cell_dims[1] = coords.size() / space_dim;
+    cell_dims[2] = space_dim;
+    node_coords = const_cast<double *>( coords.getRawPtr() );
+    return extra_data.d_block_id;
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is in the bounding box of a set of element nodes with the
+// same relative tolerance as the default safeguard.
+template <class Mesh>
+bool ClassicMeshElementLocalMap<Mesh>::pointInNodeBox(
+    const Teuchos::ArrayView<const double> &node_coords,
+    const Teuchos::ArrayView<const double> &point )
+{
+    double tolerance = 1.0e-6;
+    int space_dim = point.size();
+    int num_nodes = node_coords.size() / space_dim;
+    for ( int d = 0; d < space_dim; ++d )
+    {
+        double box_min = node_coords[d];
+        double box_max = node_coords[d];
+        for ( int n = 1; n < num_nodes; ++n )
+        {
+            box_min = std::min( box_min, node_coords[n * space_dim + d] );
+            box_max = std::max( box_max, node_coords[n * space_dim + d] );
+        }
+        double tol = ( box_max - box_min ) * tolerance;
+        if ( point[d] < box_min - tol || point[d] > box_max + tol )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -50,10 +50,10 @@ namespace DataTransferKit
 template <class Mesh>
 ClassicMeshElement<Mesh>::ClassicMeshElement(
     const Teuchos::Ptr<ClassicMesh<Mesh>> &mesh, const EntityId global_id,
-    const int block_id )
+    const int block_id, const int element_lid )
 {
-    this->b_entity_impl = Teuchos::rcp(
-        new ClassicMeshElementImpl<Mesh>( mesh, global_id, block_id ) );
+    this->b_entity_impl = Teuchos::rcp( new ClassicMeshElementImpl<Mesh>(
+        mesh, global_id, block_id, element_lid ) );
 }
 
 //---------------------------------------------------------------------------//
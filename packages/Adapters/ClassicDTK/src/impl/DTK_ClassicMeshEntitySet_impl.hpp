@@ -144,8 +144,10 @@ Entity &ClassicMeshEntitySetIterator<Mesh>::operator*( void )
 template <class Mesh>
 Entity *ClassicMeshEntitySetIterator<Mesh>::operator->( void )
 {
+    int element_lid =
+        d_element_it - d_mesh->d_element_gids[d_current_block].begin();
     d_entity = ClassicMeshElement<Mesh>( d_mesh.ptr(), *d_element_it,
-                                         d_current_block );
+                                         d_current_block, element_lid );
     return &d_entity;
 }
 
@@ -263,8 +265,10 @@ void ClassicMeshEntitySet<Mesh>::getEntity( const EntityId entity_id,
                                             const int topological_dimension,
                                             Entity &entity ) const
 {
-    entity = ClassicMeshElement<Mesh>( d_mesh.ptr(), entity_id,
-                                       d_mesh->elementBlockId( entity_id ) );
+    int block_id = d_mesh->elementBlockId( entity_id );
+    entity = ClassicMeshElement<Mesh>(
+        d_mesh.ptr(), entity_id, block_id,
+        d_mesh->elementLocalId( entity_id, block_id ) );
 }
 
 //---------------------------------------------------------------------------//
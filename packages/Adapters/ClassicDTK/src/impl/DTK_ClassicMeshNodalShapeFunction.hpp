@@ -43,6 +43,7 @@
 
 #include "DTK_ClassicMesh.hpp"
 #include "DTK_EntityShapeFunction.hpp"
+#include "DTK_IntrepidShapeFunction.hpp"
 #include "DTK_Types.hpp"
 
 #include <Teuchos_Array.hpp>
@@ -98,6 +99,21 @@ class ClassicMeshNodalShapeFunction : public EntityShapeFunction
                         const Teuchos::ArrayView<const double> &reference_point,
                         Teuchos::Array<double> &values ) const override;
 
+    /*!
+     * \brief Given an entity and a set of reference points, evaluate the
+     * shape function of the entity at all of the points at once.
+     * \param entity Evaluate the shape function of this entity.
+     * \param reference_points Evaluate the shape function at these points
+     * given in reference coordinates.
+     * \param values Entity shape function evaluated at the reference points
+     * ordered as values[p*N + n] for the nth support location at the pth
+     * point.
+     */
+    void evaluateValues(
+        const Entity &entity,
+        const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+        Teuchos::Array<double> &values ) const override;
+
     /*!
      * \brief Given an entity and a reference point, evaluate the gradient of
      * the shape function of the entity at that point.
@@ -115,14 +131,12 @@ class ClassicMeshNodalShapeFunction : public EntityShapeFunction
         const Teuchos::ArrayView<const double> &reference_point,
         Teuchos::Array<Teuchos::Array<double>> &gradients ) const override;
 
-  private:
-    // Given an entity, get the intrepid basis function.
-    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
-    getIntrepidBasis( const Entity &entity ) const;
-
   private:
     // Classic mesh.
     Teuchos::RCP<ClassicMesh<Mesh>> d_mesh;
+
+    // Intrepid shape function. Caches the basis of each block topology.
+    IntrepidShapeFunction d_intrepid_shape;
 };
 
 //---------------------------------------------------------------------------//
@@ -43,7 +43,6 @@
 
 #include "DTK_ClassicMeshElementExtraData.hpp"
 #include "DTK_DBC.hpp"
-#include "DTK_IntrepidBasisFactory.hpp"
 
 #include <Shards_CellTopology.hpp>
 
@@ -65,10 +64,8 @@ template <class Mesh>
 void ClassicMeshNodalShapeFunction<Mesh>::entitySupportIds(
     const Entity &entity, Teuchos::Array<SupportId> &support_ids ) const
 {
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
-    support_ids = d_mesh->getElementConnectivity( entity.id(), block_id );
+    support_ids = d_mesh->getElementConnectivity(
+        entity.id(), classicMeshElementExtraData( entity ).d_block_id );
 }
 
 //---------------------------------------------------------------------------//
@@ -80,82 +77,38 @@ void ClassicMeshNodalShapeFunction<Mesh>::evaluateValue(
     const Teuchos::ArrayView<const double> &reference_point,
     Teuchos::Array<double> &values ) const
 {
-    // Get the basis for the entity.
-    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
-        basis = getIntrepidBasis( entity );
-
-    // Wrap the reference point.
-    Teuchos::Array<int> point_dims( 2 );
-    point_dims[0] = 1;
-    point_dims[1] = reference_point.size();
-    Intrepid::FieldContainer<double> point_container(
-        point_dims, const_cast<double *>( reference_point.getRawPtr() ) );
-
-    // Wrap the evaluations.
-    values.resize( basis->getCardinality() );
-    Teuchos::Array<int> value_dims( 2 );
-    value_dims[0] = basis->getCardinality();
-    value_dims[1] = 1;
-    Intrepid::FieldContainer<double> value_container( value_dims,
-                                                      values.getRawPtr() );
-
-    // Evaluate the basis function.
-    basis->getValues( value_container, point_container,
-                      Intrepid::OPERATOR_VALUE );
+    shards::CellTopology entity_topo = d_mesh->getBlockTopology(
+        classicMeshElementExtraData( entity ).d_block_id );
+    d_intrepid_shape.evaluateValue( entity_topo, reference_point, values );
 }
 
 //---------------------------------------------------------------------------//
-// Given an entity and a reference point, evaluate the gradient of the shape
-// function of the entity at that point.
+// Given an entity and a set of reference points, evaluate the shape function
+// of the entity at all of the points at once.
 template <class Mesh>
-void ClassicMeshNodalShapeFunction<Mesh>::evaluateGradient(
+void ClassicMeshNodalShapeFunction<Mesh>::evaluateValues(
     const Entity &entity,
-    const Teuchos::ArrayView<const double> &reference_point,
-    Teuchos::Array<Teuchos::Array<double>> &gradients ) const
+    const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+    Teuchos::Array<double> &values ) const
 {
-    // Get the basis for the entity.
-    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
-        basis = getIntrepidBasis( entity );
-
-    // Wrap the reference point.
-    int space_dim = reference_point.size();
-    Teuchos::Array<int> point_dims( 2 );
-    point_dims[0] = 1;
-    point_dims[1] = space_dim;
-    Intrepid::FieldContainer<double> point_container(
-        point_dims, const_cast<double *>( reference_point.getRawPtr() ) );
-
-    // Evaluate the basis function.
-    int cardinality = basis->getCardinality();
-    Intrepid::FieldContainer<double> grad_container( cardinality, 1,
-                                                     space_dim );
-    basis->getValues( grad_container, point_container,
-                      Intrepid::OPERATOR_GRAD );
-
-    // Extract the evaluations.
-    gradients.resize( cardinality );
-    for ( int n = 0; n < cardinality; ++n )
-    {
-        gradients[n].resize( space_dim );
-        for ( int d = 0; d < space_dim; ++d )
-        {
-            gradients[n][d] = grad_container( n, 0, d );
-        }
-    }
+    shards::CellTopology entity_topo = d_mesh->getBlockTopology(
+        classicMeshElementExtraData( entity ).d_block_id );
+    d_intrepid_shape.evaluateValues( entity_topo, reference_points, values );
 }
 
 //---------------------------------------------------------------------------//
-// Given an entity, get the intrepid basis function.
+// Given an entity and a reference point, evaluate the gradient of the shape
+// function of the entity at that point.
 template <class Mesh>
-Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
-ClassicMeshNodalShapeFunction<Mesh>::getIntrepidBasis(
-    const Entity &entity ) const
+void ClassicMeshNodalShapeFunction<Mesh>::evaluateGradient(
+    const Entity &entity,
+    const Teuchos::ArrayView<const double> &reference_point,
+    Teuchos::Array<Teuchos::Array<double>> &gradients ) const
 {
-    int block_id = Teuchos::rcp_dynamic_cast<ClassicMeshElementExtraData>(
-                       entity.extraData() )
-                       ->d_block_id;
-    shards::CellTopology entity_topo = d_mesh->getBlockTopology( block_id );
-    return IntrepidBasisFactory::create( entity_topo );
+    shards::CellTopology entity_topo = d_mesh->getBlockTopology(
+        classicMeshElementExtraData( entity ).d_block_id );
+    d_intrepid_shape.evaluateGradient( entity_topo, reference_point,
+                                       gradients );
 }
 
 //---------------------------------------------------------------------------//
@@ -41,6 +41,8 @@
 #ifndef DTK_CLASSICMESH_IMPL_HPP
 #define DTK_CLASSICMESH_IMPL_HPP
 
+#include <algorithm>
+
 #include "DTK_DBC.hpp"
 #include "DTK_MeshTools.hpp"
 
@@ -53,8 +55,10 @@ namespace DataTransferKit
 // Constructor.
 template <class Mesh>
 ClassicMesh<Mesh>::ClassicMesh(
-    const Teuchos::RCP<MeshManager<Mesh>> &mesh_manager )
+    const Teuchos::RCP<MeshManager<Mesh>> &mesh_manager,
+    const bool cache_node_coords )
     : d_mesh_manager( mesh_manager )
+    , d_cache_node_coords( cache_node_coords )
 {
     // Allocate arrays.
     int num_blocks = 0;
@@ -69,6 +73,8 @@ ClassicMesh<Mesh>::ClassicMesh(
         d_vertex_coords.resize( num_blocks );
         d_element_conn.resize( num_blocks );
         d_permutation.resize( num_blocks );
+        d_element_vertex_lids.resize( num_blocks );
+        d_element_node_coords.resize( num_blocks );
     }
 
     // Create views.
@@ -102,6 +108,67 @@ ClassicMesh<Mesh>::ClassicMesh(
             ++lid;
         }
     }
+
+    // Flatten the connectivity so element queries are indexed reads with no
+    // hashing.
+    for ( int b = 0; b < num_blocks; ++b )
+    {
+        int num_node = d_permutation[b].size();
+        int num_element = d_element_gids[b].size();
+        d_element_vertex_lids[b].resize( num_element * num_node );
+        for ( int n = 0; n < num_node; ++n )
+        {
+            GlobalOrdinal conn_stride = d_permutation[b][n] * num_element;
+            for ( int e = 0; e < num_element; ++e )
+            {
+                d_element_vertex_lids[b][e * num_node + n] =
+                    vertexLocalId( d_element_conn[b][conn_stride + e], b );
+            }
+        }
+    }
+
+    // Optionally cache the element node coordinates contiguously. This
+    // duplicates the vertex coordinates of shared nodes so it is off by
+    // default.
+    if ( d_cache_node_coords )
+    {
+        int space_dim = ( num_blocks > 0 ) ? dim() : 0;
+        for ( int b = 0; b < num_blocks; ++b )
+        {
+            int size = d_permutation[b].size() * space_dim;
+            int num_element = d_element_gids[b].size();
+            d_element_node_coords[b].resize( num_element * size );
+            for ( int e = 0; e < num_element; ++e )
+            {
+                gatherElementNodeCoordinates(
+                    e, b, d_element_node_coords[b].getRawPtr() + e * size );
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Gather the coordinates of the element nodes from the vertex coordinates.
+// The nodes are in permuted order with the coordinates of each node
+// contiguous.
+template <class Mesh>
+void ClassicMesh<Mesh>::gatherElementNodeCoordinates( const int element_lid,
+                                                      const int block_id,
+                                                      double *coords ) const
+{
+    int space_dim = dim();
+    int num_node = d_permutation[block_id].size();
+    GlobalOrdinal vertex_size = d_vertex_gids[block_id].size();
+    const int *vertex_lids =
+        d_element_vertex_lids[block_id].getRawPtr() + element_lid * num_node;
+    for ( int n = 0; n < num_node; ++n )
+    {
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            coords[n * space_dim + d] =
+                d_vertex_coords[block_id][d * vertex_size + vertex_lids[n]];
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -219,36 +286,62 @@ Intrepid::FieldContainer<double>
 ClassicMesh<Mesh>::getElementNodeCoordinates( const GlobalOrdinal gid,
                                               const int block_id ) const
 {
-    DTK_REQUIRE( block_id < d_mesh_manager->getNumBlocks() );
+    Intrepid::FieldContainer<double> coords;
+    getLocalElementNodeCoordinates( elementLocalId( gid, block_id ), block_id,
+                                    coords );
+    return coords;
+}
 
-    // Get the element local id.
-    int element_lid = elementLocalId( gid, block_id );
+//---------------------------------------------------------------------------//
+// Given an element local id and its block id get a view of the coordinates of
+// the element nodes.
+template <class Mesh>
+Teuchos::ArrayView<const double>
+ClassicMesh<Mesh>::getLocalElementNodeCoordinates(
+    const int element_lid, const int block_id,
+    NodeCoordinateBuffer &buffer ) const
+{
+    DTK_REQUIRE( block_id < d_mesh_manager->getNumBlocks() );
+    DTK_REQUIRE( element_lid < d_element_gids[block_id].size() );
+    int size = d_permutation[block_id].size() * dim();
+    if ( d_cache_node_coords )
+    {
+        return d_element_node_coords[block_id].view( element_lid * size,
+                                                     size );
+    }
+    DTK_CHECK( size <= max_element_node_coords );
+    gatherElementNodeCoordinates( element_lid, block_id, buffer.data() );
+    return Teuchos::ArrayView<const double>( buffer.data(), size );
+}
 
-    // Allocate the coordinate container.
+//---------------------------------------------------------------------------//
+// Given an element local id and its block id fill a cell coordinate container
+// with the coordinates of the element nodes. The container is only resized if
+// its shape does not match.
+template <class Mesh>
+void ClassicMesh<Mesh>::getLocalElementNodeCoordinates(
+    const int element_lid, const int block_id,
+    Intrepid::FieldContainer<double> &coords ) const
+{
     int space_dim = dim();
     int num_node = d_permutation[block_id].size();
-    Intrepid::FieldContainer<double> coords( 1, num_node, space_dim );
-
-    // Extract the coordinates.
-    GlobalOrdinal element_size = d_element_gids[block_id].size();
-    GlobalOrdinal vertex_size = d_vertex_gids[block_id].size();
-    GlobalOrdinal conn_stride = 0;
-    GlobalOrdinal coord_stride = 0;
-    GlobalOrdinal vertex_gid = 0;
-    int vertex_lid = 0;
-    for ( int n = 0; n < num_node; ++n )
+    if ( coords.rank() != 3 || coords.dimension( 0 ) != 1 ||
+         coords.dimension( 1 ) != num_node ||
+         coords.dimension( 2 ) != space_dim )
     {
-        conn_stride = d_permutation[block_id][n] * element_size;
-        vertex_gid = d_element_conn[block_id][conn_stride + element_lid];
-        vertex_lid = vertexLocalId( vertex_gid, block_id );
-        for ( int d = 0; d < space_dim; ++d )
-        {
-            coord_stride = d * vertex_size;
-            coords( 0, n, d ) =
-                d_vertex_coords[block_id][coord_stride + vertex_lid];
-        }
+        coords.resize( 1, num_node, space_dim );
+    }
+    if ( d_cache_node_coords )
+    {
+        int size = num_node * space_dim;
+        Teuchos::ArrayView<const double> node_coords =
+            d_element_node_coords[block_id].view( element_lid * size, size );
+        std::copy( node_coords.begin(), node_coords.end(), &coords[0] );
+    }
+    else
+    {
+        gatherElementNodeCoordinates( element_lid, block_id, &coords[0] );
     }
-    return coords;
 }
 
 //---------------------------------------------------------------------------//
@@ -261,13 +354,12 @@ ClassicMesh<Mesh>::getElementConnectivity( const GlobalOrdinal gid,
     DTK_REQUIRE( block_id < d_mesh_manager->getNumBlocks() );
     int element_lid = elementLocalId( gid, block_id );
     int num_node = d_permutation[block_id].size();
-    GlobalOrdinal element_size = d_element_gids[block_id].size();
-    GlobalOrdinal conn_stride = 0;
+    const int *vertex_lids =
+        d_element_vertex_lids[block_id].getRawPtr() + element_lid * num_node;
     Teuchos::Array<SupportId> conn( num_node );
     for ( int n = 0; n < num_node; ++n )
     {
-        conn_stride = d_permutation[block_id][n] * element_size;
-        conn[n] = d_element_conn[block_id][conn_stride + element_lid];
+        conn[n] = d_vertex_gids[block_id][vertex_lids[n]];
     }
     return conn;
 }
@@ -331,6 +331,101 @@ class MyEvaluator
     Teuchos::RCP<const Teuchos::Comm<int>> d_comm;
 };
 
+//---------------------------------------------------------------------------//
+// FieldEvaluator Implementation that evaluates into the map's buffer.
+class MyBufferedEvaluator : public MyEvaluator
+{
+  public:
+    MyBufferedEvaluator( const MyMesh &mesh,
+                         const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
+        : MyEvaluator( mesh, comm )
+        , d_num_buffered( 0 )
+        , d_sorted( true )
+    { /* ... */
+    }
+
+    void evaluateInto(
+        const Teuchos::ArrayRCP<MyMesh::global_ordinal_type> &elements,
+        const Teuchos::ArrayRCP<double> &coords, const int /*field_dim*/,
+        const Teuchos::ArrayView<double> &values )
+    {
+        ++d_num_buffered;
+        d_sorted = d_sorted && std::is_sorted( elements.begin(),
+                                               elements.end() );
+        MyField evaluations = evaluate( elements, coords );
+        std::copy( evaluations.begin(), evaluations.end(), values.begin() );
+    }
+
+    int numBuffered() const { return d_num_buffered; }
+
+    bool sorted() const { return d_sorted; }
+
+  private:
+    int d_num_buffered;
+    bool d_sorted;
+};
+
+//---------------------------------------------------------------------------//
+// FieldEvaluator Implementation with a configurable field dimension. Each
+// component d of the field is (rank + 1) * (d + 1).
+class MyVectorEvaluator : public MyEvaluator
+{
+  public:
+    MyVectorEvaluator( const MyMesh &mesh,
+                       const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                       const bool report_dim )
+        : MyEvaluator( mesh, comm )
+        , d_dim( 1 )
+        , d_report_dim( report_dim )
+        , d_buffer_sized( true )
+    { /* ... */
+    }
+
+    void setDim( const int dim ) { d_dim = dim; }
+
+    int fieldDimension() const { return d_report_dim ? d_dim : 0; }
+
+    MyField
+    evaluate( const Teuchos::ArrayRCP<MyMesh::global_ordinal_type> &elements,
+              const Teuchos::ArrayRCP<double> &coords )
+    {
+        MyField scalar = MyEvaluator::evaluate( elements, coords );
+        int num_elements = elements.size();
+        MyField evaluated_data( num_elements * d_dim, d_dim );
+        for ( int d = 0; d < d_dim; ++d )
+        {
+            for ( int n = 0; n < num_elements; ++n )
+            {
+                *( evaluated_data.begin() + d * num_elements + n ) =
+                    *( scalar.begin() + n ) * ( d + 1.0 );
+            }
+        }
+        return evaluated_data;
+    }
+
+    void evaluateInto(
+        const Teuchos::ArrayRCP<MyMesh::global_ordinal_type> &elements,
+        const Teuchos::ArrayRCP<double> &coords, const int field_dim,
+        const Teuchos::ArrayView<double> &values )
+    {
+        d_buffer_sized = d_buffer_sized && ( field_dim == d_dim ) &&
+                         ( values.size() == d_dim * elements.size() );
+        if ( values.size() == d_dim * elements.size() )
+        {
+            MyField evaluations = evaluate( elements, coords );
+            std::copy( evaluations.begin(), evaluations.end(),
+                       values.begin() );
+        }
+    }
+
+    bool bufferSized() const { return d_buffer_sized; }
+
+  private:
+    int d_dim;
+    bool d_report_dim;
+    bool d_buffer_sized;
+};
+
 //---------------------------------------------------------------------------//
 // Mesh create function.
 //---------------------------------------------------------------------------//
@@ -501,6 +596,151 @@ TEUCHOS_UNIT_TEST( SharedDomainMap, shared_domain_map_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+// Repeated apply with an evaluator that writes into the map's buffer.
+TEUCHOS_UNIT_TEST( SharedDomainMap, buffered_evaluator_test )
+{
+    using namespace DataTransferKit;
+
+    // Setup communication.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm<int>();
+    int my_size = comm->getSize();
+
+    // This is a 4 processor test.
+    if ( my_size == 4 )
+    {
+        // Setup source mesh manager.
+        Teuchos::ArrayRCP<Teuchos::RCP<MyMesh>> mesh_blocks( 1 );
+        mesh_blocks[0] = buildMyMesh();
+        Teuchos::RCP<MeshManager<MyMesh>> source_mesh_manager =
+            Teuchos::rcp( new MeshManager<MyMesh>( mesh_blocks, comm, 2 ) );
+
+        // Setup target coordinate field manager
+        Teuchos::RCP<FieldManager<MyField>> target_coord_manager = Teuchos::rcp(
+            new FieldManager<MyField>( buildCoordinateField(), comm ) );
+
+        // Create field evaluator.
+        Teuchos::RCP<MyBufferedEvaluator> buffered_evaluator =
+            Teuchos::rcp( new MyBufferedEvaluator( *mesh_blocks[0], comm ) );
+        Teuchos::RCP<FieldEvaluator<MyMesh::global_ordinal_type, MyField>>
+            source_evaluator = buffered_evaluator;
+
+        // Create data target manager
+        int field_size = target_coord_manager->field()->size() /
+                         target_coord_manager->field()->dim();
+        Teuchos::RCP<MyField> target_field =
+            Teuchos::rcp( new MyField( field_size, 1 ) );
+        Teuchos::RCP<FieldManager<MyField>> target_space_manager =
+            Teuchos::rcp( new FieldManager<MyField>( target_field, comm ) );
+
+        // Setup the map and apply it twice.
+        SharedDomainMap<MyMesh, MyField> shared_domain_map(
+            comm, source_mesh_manager->dim() );
+        shared_domain_map.setup( source_mesh_manager, target_coord_manager );
+        for ( int i = 0; i < 2; ++i )
+        {
+            shared_domain_map.apply( source_evaluator, target_space_manager );
+
+            // Check the data transfer.
+            for ( int n = 0; n < target_space_manager->field()->size(); ++n )
+            {
+                TEST_EQUALITY( *( target_space_manager->field()->begin() + n ),
+                               n + 1 );
+            }
+        }
+
+        // Every process has target data so the buffer is used for every
+        // apply and the geometries are given in sorted blocks.
+        TEST_EQUALITY( buffered_evaluator->numBuffered(), 2 );
+        TEST_ASSERT( buffered_evaluator->sorted() );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Apply to fields of different dimensions with a process that only has
+// source data. That process cannot take the field dimension from the target.
+TEUCHOS_UNIT_TEST( SharedDomainMap, source_only_field_dim_test )
+{
+    using namespace DataTransferKit;
+
+    // Setup communication.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm<int>();
+    int my_rank = comm->getRank();
+    int my_size = comm->getSize();
+
+    // This is a 4 processor test.
+    if ( my_size == 4 )
+    {
+        // Setup source mesh manager.
+        Teuchos::ArrayRCP<Teuchos::RCP<MyMesh>> mesh_blocks( 1 );
+        mesh_blocks[0] = buildMyMesh();
+        Teuchos::RCP<MeshManager<MyMesh>> source_mesh_manager =
+            Teuchos::rcp( new MeshManager<MyMesh>( mesh_blocks, comm, 2 ) );
+
+        // Setup target coordinate field manager. Process 0 has no targets
+        // but its mesh still contains targets of the other processes.
+        Teuchos::RCP<FieldManager<MyField>> target_coord_manager;
+        if ( my_rank > 0 )
+        {
+            target_coord_manager = Teuchos::rcp(
+                new FieldManager<MyField>( buildCoordinateField(), comm ) );
+        }
+        int num_points = 4;
+
+        // Check both an evaluator that reports its dimension and one that
+        // does not.
+        for ( int r = 0; r < 2; ++r )
+        {
+            Teuchos::RCP<MyVectorEvaluator> vector_evaluator =
+                Teuchos::rcp( new MyVectorEvaluator( *mesh_blocks[0], comm,
+                                                     ( 1 == r ) ) );
+            Teuchos::RCP<FieldEvaluator<MyMesh::global_ordinal_type, MyField>>
+                source_evaluator = vector_evaluator;
+
+            // Setup the map and apply it to a scalar and then a vector.
+            SharedDomainMap<MyMesh, MyField> shared_domain_map(
+                comm, source_mesh_manager->dim() );
+            shared_domain_map.setup( source_mesh_manager,
+                                     target_coord_manager );
+            int field_dims[3] = {1, 3, 2};
+            for ( int i = 0; i < 3; ++i )
+            {
+                int field_dim = field_dims[i];
+                vector_evaluator->setDim( field_dim );
+                Teuchos::RCP<FieldManager<MyField>> target_space_manager;
+                if ( my_rank > 0 )
+                {
+                    target_space_manager =
+                        Teuchos::rcp( new FieldManager<MyField>(
+                            Teuchos::rcp( new MyField( num_points * field_dim,
+                                                       field_dim ) ),
+                            comm ) );
+                }
+                shared_domain_map.apply( source_evaluator,
+                                         target_space_manager );
+
+                // Point n is in the mesh of process n.
+                if ( my_rank > 0 )
+                {
+                    for ( int d = 0; d < field_dim; ++d )
+                    {
+                        for ( int n = 0; n < num_points; ++n )
+                        {
+                            TEST_EQUALITY(
+                                *( target_space_manager->field()->begin() +
+                                   d * num_points + n ),
+                                ( n + 1.0 ) * ( d + 1.0 ) );
+                        }
+                    }
+                }
+            }
+
+            // The buffer given to the evaluator always matched the field.
+            TEST_ASSERT( vector_evaluator->bufferSized() );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstSharedDomainMap1.cpp
 //---------------------------------------------------------------------------//
@@ -248,6 +248,36 @@ TEUCHOS_UNIT_TEST( BoundingBox, intersection_test )
     TEST_ASSERT( !has_intersect );
 }
 
+//---------------------------------------------------------------------------//
+// Global union test.
+TEUCHOS_UNIT_TEST( BoundingBox, global_union_test )
+{
+    using namespace DataTransferKit;
+
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm<int>();
+    int my_rank = comm->getRank();
+    int my_size = comm->getSize();
+
+    // Each rank but the last contributes a unit box shifted by its rank. The
+    // last rank contributes nothing unless it is the only rank.
+    Teuchos::Tuple<double, 6> local_bounds = BoundingBox::emptyBounds();
+    if ( my_rank < my_size - 1 || 1 == my_size )
+    {
+        local_bounds = Teuchos::tuple( 1.0 * my_rank, -2.0 * my_rank, 0.0,
+                                       my_rank + 1.0, 1.0, 3.0 );
+    }
+
+    BoundingBox global_box = BoundingBox::globalUnion( *comm, local_bounds );
+    Teuchos::Tuple<double, 6> bounds = global_box.getBounds();
+    int num_boxes = ( 1 == my_size ) ? 1 : my_size - 1;
+    TEST_EQUALITY( bounds[0], 0.0 );
+    TEST_EQUALITY( bounds[1], -2.0 * ( num_boxes - 1 ) );
+    TEST_EQUALITY( bounds[2], 0.0 );
+    TEST_EQUALITY( bounds[3], 1.0 * num_boxes );
+    TEST_EQUALITY( bounds[4], 1.0 );
+    TEST_EQUALITY( bounds[5], 3.0 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstBoundingBox.cpp
 //---------------------------------------------------------------------------//
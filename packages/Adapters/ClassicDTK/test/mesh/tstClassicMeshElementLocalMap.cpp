@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+/*!
+ * \file tstClassicMeshElementLocalMap.cpp
+ * \author Stuart R. Slattery
+ * \brief Classic mesh element local map unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <DTK_ClassicMesh.hpp>
+#include <DTK_ClassicMeshElementLocalMap.hpp>
+#include <DTK_ClassicMeshEntitySet.hpp>
+#include <DTK_Entity.hpp>
+#include <DTK_EntityIterator.hpp>
+#include <DTK_MeshContainer.hpp>
+#include <DTK_MeshManager.hpp>
+#include <DTK_MeshTypes.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+//---------------------------------------------------------------------------//
+// MPI Setup
+//---------------------------------------------------------------------------//
+
+template <class Ordinal>
+Teuchos::RCP<const Teuchos::Comm<Ordinal>> getDefaultComm()
+{
+#ifdef HAVE_MPI
+    return Teuchos::DefaultComm<Ordinal>::getComm();
+#else
+    return Teuchos::rcp( new Teuchos::SerialComm<Ordinal>() );
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Mesh container creation functions.
+//---------------------------------------------------------------------------//
+// Two unit hexahedra side by side in x. Element 12 covers [0,1]^3 and element
+// 13 covers [1,2]x[0,1]^2.
+Teuchos::RCP<DataTransferKit::MeshContainer<unsigned long int>>
+buildTwoHexContainer()
+{
+    using namespace DataTransferKit;
+
+    int vertex_dim = 3;
+    int num_vertices = 12;
+    int num_elements = 2;
+    int vertices_per_hex = 8;
+
+    // Vertices are numbered x fastest on a 3x2x2 grid.
+    Teuchos::ArrayRCP<unsigned long int> vertex_handles( num_vertices );
+    Teuchos::ArrayRCP<double> coords( vertex_dim * num_vertices );
+    for ( int k = 0; k < 2; ++k )
+    {
+        for ( int j = 0; j < 2; ++j )
+        {
+            for ( int i = 0; i < 3; ++i )
+            {
+                int v = i + 3 * j + 6 * k;
+                vertex_handles[v] = v;
+                coords[v] = i;
+                coords[num_vertices + v] = j;
+                coords[2 * num_vertices + v] = k;
+            }
+        }
+    }
+
+    // Connectivity is blocked by vertex.
+    Teuchos::ArrayRCP<unsigned long int> hex_handles( num_elements );
+    Teuchos::ArrayRCP<unsigned long int> connectivity( vertices_per_hex *
+                                                       num_elements );
+    int offsets[8] = {0, 1, 4, 3, 6, 7, 10, 9};
+    for ( int e = 0; e < num_elements; ++e )
+    {
+        hex_handles[e] = 12 + e;
+        for ( int n = 0; n < vertices_per_hex; ++n )
+        {
+            connectivity[n * num_elements + e] = e + offsets[n];
+        }
+    }
+
+    Teuchos::ArrayRCP<int> permutation_list( vertices_per_hex );
+    for ( int i = 0; i < permutation_list.size(); ++i )
+    {
+        permutation_list[i] = i;
+    }
+
+    return Teuchos::rcp( new MeshContainer<unsigned long int>(
+        vertex_dim, vertex_handles, coords, DTK_HEXAHEDRON, vertices_per_hex,
+        hex_handles, connectivity, permutation_list ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that locating a batch of point/element pairs gives the same answer as
+// the per-point safeguard, map and inclusion calls.
+TEUCHOS_UNIT_TEST( ClassicMeshElementLocalMap, locate_points_test )
+{
+    using namespace DataTransferKit;
+    typedef MeshContainer<unsigned long int> MeshType;
+
+    // Create the mesh.
+    Teuchos::ArrayRCP<Teuchos::RCP<MeshType>> mesh_blocks( 1 );
+    mesh_blocks[0] = buildTwoHexContainer();
+    Teuchos::RCP<MeshManager<MeshType>> mesh_manager = Teuchos::rcp(
+        new MeshManager<MeshType>( mesh_blocks, getDefaultComm<int>(), 3 ) );
+
+    // Run with and without cached node coordinates.
+    for ( int cache = 0; cache < 2; ++cache )
+    {
+        Teuchos::RCP<ClassicMesh<MeshType>> classic_mesh = Teuchos::rcp(
+            new ClassicMesh<MeshType>( mesh_manager, ( cache == 1 ) ) );
+        ClassicMeshEntitySet<MeshType> entity_set( classic_mesh );
+        ClassicMeshElementLocalMap<MeshType> local_map( classic_mesh );
+
+        // Gather the elements by id.
+        Teuchos::Array<Entity> elements( 2 );
+        EntityIterator it = entity_set.entityIterator( 3 );
+        TEST_EQUALITY( it.size(), 2u );
+        for ( it = it.begin(); it != it.end(); ++it )
+        {
+            elements[it->id() - 12] = *it;
+        }
+
+        // Pair points with candidate elements. The first point is in element
+        // 12 only, the second in element 13 only, and the third in neither.
+        int num_pairs = 5;
+        Teuchos::Array<Entity> candidates( num_pairs );
+        candidates[0] = elements[0];
+        candidates[1] = elements[1];
+        candidates[2] = elements[1];
+        candidates[3] = elements[0];
+        candidates[4] = elements[1];
+        double point_data[15] = {0.5, 0.5,  0.5,  0.5, 0.5,  0.5,
+                                 1.5, 0.25, 0.75, 1.5, 0.25, 0.75,
+                                 3.0, 0.5,  0.5};
+        Teuchos::Array<double> points( point_data, point_data + 15 );
+        Teuchos::Array<double> ref_points( 3 * num_pairs, -10.0 );
+        Teuchos::Array<int> found( num_pairs, -1 );
+        local_map.locatePoints( candidates(), points(), ref_points(),
+                                found() );
+
+        // Check the expected inclusion.
+        TEST_EQUALITY( found[0], 1 );
+        TEST_EQUALITY( found[1], 0 );
+        TEST_EQUALITY( found[2], 1 );
+        TEST_EQUALITY( found[3], 0 );
+        TEST_EQUALITY( found[4], 0 );
+
+        // Check the reference coordinates of the found pairs.
+        TEST_ASSERT( std::abs( ref_points[0] ) < 1.0e-12 );
+        TEST_ASSERT( std::abs( ref_points[1] ) < 1.0e-12 );
+        TEST_ASSERT( std::abs( ref_points[2] ) < 1.0e-12 );
+        TEST_ASSERT( std::abs( ref_points[6] ) < 1.0e-12 );
+        TEST_ASSERT( std::abs( ref_points[7] + 0.5 ) < 1.0e-12 );
+        TEST_ASSERT( std::abs( ref_points[8] - 0.5 ) < 1.0e-12 );
+
+        // Compare against the per-point interface.
+        Teuchos::Array<double> ref_point( 3 );
+        for ( int p = 0; p < num_pairs; ++p )
+        {
+            Teuchos::ArrayView<const double> point = points( 3 * p, 3 );
+            bool expected =
+                local_map.isSafeToMapToReferenceFrame( candidates[p],
+                                                       point ) &&
+                local_map.mapToReferenceFrame( candidates[p], point,
+                                               ref_point() ) &&
+                local_map.checkPointInclusion( candidates[p], ref_point() );
+            TEST_EQUALITY( found[p], static_cast<int>( expected ) );
+            if ( expected )
+            {
+                for ( int d = 0; d < 3; ++d )
+                {
+                    TEST_ASSERT( std::abs( ref_points[3 * p + d] -
+                                           ref_point[d] ) < 1.0e-12 );
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end tstClassicMeshElementLocalMap.cpp
+//---------------------------------------------------------------------------//
@@ -156,6 +156,15 @@ TEUCHOS_UNIT_TEST( CommIndexer, subcommunicator_test )
         TEST_ASSERT( !indexer.isValid() );
         TEST_ASSERT( Teuchos::is_null( local_comm ) );
     }
+
+    // Every process gets the full map, including those outside of the local
+    // communicator.
+    TEST_EQUALITY( (int)indexer.size(), (int)sub_ranks.size() );
+    for ( int n = 0; n < (int)sub_ranks.size(); ++n )
+    {
+        TEST_EQUALITY( indexer.l2g( n ), sub_ranks[n] );
+    }
+    TEST_EQUALITY( indexer.l2g( sub_ranks.size() ), -1 );
     TEST_EQUALITY( indexer.l2g( -32 ), -1 );
 }
 
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_FixedNewtonSolver.hpp
+ * \author Stuart Slattery
+ * \brief  A stateless class for Newton's method on problems of fixed
+ * dimension.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_FIXEDNEWTONSOLVER_HPP
+#define DTK_FIXEDNEWTONSOLVER_HPP
+
+#include <array>
+
+#include "DTK_FixedNonlinearProblemTraits.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class FixedNewtonSolver
+ * \brief A stateless class for Newton's method on problems whose dimension
+ * is known at compile time.
+ *
+ * All work arrays are stack allocated and the linear model is solved with a
+ * closed-form inverse so a solve performs no heap allocation. Dimensions 1
+ * through 3 are supported.
+ */
+//---------------------------------------------------------------------------//
+template <typename NonlinearProblem, int DIM>
+class FixedNewtonSolver
+{
+  public:
+    static_assert( 0 < DIM && DIM < 4,
+                   "FixedNewtonSolver supports dimensions 1 through 3" );
+
+    //@{
+    //! Typedefs.
+    typedef FixedNonlinearProblemTraits<NonlinearProblem> NPT;
+    typedef typename NPT::Scalar Scalar;
+    typedef std::array<Scalar, DIM> Vector;
+    typedef std::array<Scalar, DIM * DIM> Matrix;
+    //@}
+
+    // Solve a nonlinear problem with Newton's method.
+    static void solve( Vector &u, NonlinearProblem &problem,
+                       const double tolerance, const int max_iters );
+
+  private:
+    // Compute the determinant of a row-major matrix.
+    static Scalar determinant( const Matrix &A );
+
+    // Compute the inverse of a row-major matrix given its determinant.
+    static void inverse( const Matrix &A, const Scalar det, Matrix &A_inv );
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// Template includes.
+//---------------------------------------------------------------------------//
+
+#include "DTK_FixedNewtonSolver_impl.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_FIXEDNEWTONSOLVER_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_FixedNewtonSolver.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_FixedNewtonSolver_impl.hpp
+ * \author Stuart Slattery
+ * \brief  A stateless class for Newton's method on problems of fixed
+ * dimension.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_FIXEDNEWTONSOLVER_IMPL_HPP
+#define DTK_FIXEDNEWTONSOLVER_IMPL_HPP
+
+#include <cmath>
+#include <limits>
+
+#include "DTK_DBC.hpp"
+#include "DTK_Profiler.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Closed-form determinants and inverses of small row-major matrices.
+ */
+template <typename Scalar, int DIM>
+struct FixedSmallMatrix;
+
+//! 1x1 matrices.
+template <typename Scalar>
+struct FixedSmallMatrix<Scalar, 1>
+{
+    static inline Scalar determinant( const std::array<Scalar, 1> &A )
+    {
+        return A[0];
+    }
+
+    static inline void inverse( const std::array<Scalar, 1> &,
+                                const Scalar det,
+                                std::array<Scalar, 1> &A_inv )
+    {
+        A_inv[0] = 1.0 / det;
+    }
+};
+
+//! 2x2 matrices.
+template <typename Scalar>
+struct FixedSmallMatrix<Scalar, 2>
+{
+    static inline Scalar determinant( const std::array<Scalar, 4> &A )
+    {
+        return A[0] * A[3] - A[1] * A[2];
+    }
+
+    static inline void inverse( const std::array<Scalar, 4> &A,
+                                const Scalar det,
+                                std::array<Scalar, 4> &A_inv )
+    {
+        Scalar inv_det = 1.0 / det;
+        A_inv[0] = A[3] * inv_det;
+        A_inv[1] = -A[1] * inv_det;
+        A_inv[2] = -A[2] * inv_det;
+        A_inv[3] = A[0] * inv_det;
+    }
+};
+
+//! 3x3 matrices.
+template <typename Scalar>
+struct FixedSmallMatrix<Scalar, 3>
+{
+    static inline Scalar determinant( const std::array<Scalar, 9> &A )
+    {
+        return A[0] * ( A[4] * A[8] - A[5] * A[7] ) -
+               A[1] * ( A[3] * A[8] - A[5] * A[6] ) +
+               A[2] * ( A[3] * A[7] - A[4] * A[6] );
+    }
+
+    static inline void inverse( const std::array<Scalar, 9> &A,
+                                const Scalar det,
+                                std::array<Scalar, 9> &A_inv )
+    {
+        Scalar inv_det = 1.0 / det;
+        A_inv[0] = ( A[4] * A[8] - A[5] * A[7] ) * inv_det;
+        A_inv[1] = ( A[2] * A[7] - A[1] * A[8] ) * inv_det;
+        A_inv[2] = ( A[1] * A[5] - A[2] * A[4] ) * inv_det;
+        A_inv[3] = ( A[5] * A[6] - A[3] * A[8] ) * inv_det;
+        A_inv[4] = ( A[0] * A[8] - A[2] * A[6] ) * inv_det;
+        A_inv[5] = ( A[2] * A[3] - A[0] * A[5] ) * inv_det;
+        A_inv[6] = ( A[3] * A[7] - A[4] * A[6] ) * inv_det;
+        A_inv[7] = ( A[1] * A[6] - A[0] * A[7] ) * inv_det;
+        A_inv[8] = ( A[0] * A[4] - A[1] * A[3] ) * inv_det;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Solve a nonlinear problem with Newton's method.
+ *
+ * \param u On input the initial guess. On output the solution. If the
+ * Jacobian is degenerate the solution is filled with the maximum scalar
+ * value to indicate that no solution exists.
+ *
+ * \param problem The nonlinear problem.
+ *
+ * \param tolerance Convergence tolerance on the norm of the Newton update.
+ * The iteration exits as soon as the update norm is below this value.
+ *
+ * \param max_iters Maximum number of Newton iterations.
+ */
+template <typename NonlinearProblem, int DIM>
+void FixedNewtonSolver<NonlinearProblem, DIM>::solve(
+    Vector &u, NonlinearProblem &problem, const double tolerance,
+    const int max_iters )
+{
+    // Nonlinear residual, Jacobian, and its inverse.
+    Vector F;
+    Matrix J;
+    Matrix J_inv;
+    Scalar det = 0.0;
+    Scalar conv_check = std::numeric_limits<Scalar>::max();
+
+    // Nonlinear solve.
+    int num_iters = 0;
+    for ( int k = 0; k < max_iters; ++k )
+    {
+        // Update any state-dependent data using the current solution vector
+        // and compute the nonlinear residual and Jacobian.
+        NPT::updateState( problem, u.data() );
+        NPT::evaluateResidual( problem, u.data(), F.data() );
+        NPT::evaluateJacobian( problem, u.data(), J.data() );
+
+        // Check for degeneracy of the initial Jacobian. If it is degenerate
+        // then the problem is ill conditioned and return very large numbers
+        // in the state vector that correspond to no solution.
+        det = determinant( J );
+        if ( 0 == k && std::abs( det ) < tolerance )
+        {
+            u.fill( std::numeric_limits<Scalar>::max() );
+            return;
+        }
+
+        ++num_iters;
+
+        // Solve the linear model, delta_u = J^-1 * -F(u), and update the
+        // solution, u += delta_u.
+        inverse( J, det, J_inv );
+        conv_check = 0.0;
+        for ( int i = 0; i < DIM; ++i )
+        {
+            Scalar delta = 0.0;
+            for ( int j = 0; j < DIM; ++j )
+            {
+                delta -= J_inv[i * DIM + j] * F[j];
+            }
+            u[i] += delta;
+            conv_check += delta * delta;
+        }
+        conv_check = std::sqrt( conv_check );
+
+        // Check for convergence.
+        if ( tolerance > conv_check )
+        {
+            break;
+        }
+    }
+
+    // Record the number of iterations.
+    Profiler::recordCount( "Newton Solves", 1 );
+    Profiler::recordCount( "Newton Iterations", num_iters );
+
+    // Check for convergence.
+    DTK_ENSURE( tolerance > conv_check );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the determinant of a row-major matrix.
+ */
+template <typename NonlinearProblem, int DIM>
+typename FixedNewtonSolver<NonlinearProblem, DIM>::Scalar
+FixedNewtonSolver<NonlinearProblem, DIM>::determinant( const Matrix &A )
+{
+    return FixedSmallMatrix<Scalar, DIM>::determinant( A );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the inverse of a row-major matrix given its determinant.
+ */
+template <typename NonlinearProblem, int DIM>
+void FixedNewtonSolver<NonlinearProblem, DIM>::inverse( const Matrix &A,
+                                                        const Scalar det,
+                                                        Matrix &A_inv )
+{
+    FixedSmallMatrix<Scalar, DIM>::inverse( A, det, A_inv );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_FIXEDNEWTONSOLVER_IMPL_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_FixedNewtonSolver_impl.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   DTK_FixedNonlinearProblemTraits.hpp
+ * \author Stuart Slattery
+ * \brief  Traits class for nonlinear problems of fixed dimension.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_FIXEDNONLINEARPROBLEMTRAITS_HPP
+#define DTK_FIXEDNONLINEARPROBLEMTRAITS_HPP
+
+#include "DTK_NonlinearProblemTraits.hpp"
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class FixedNonlinearProblemTraits
+ * \brief Traits class for nonlinear problems whose dimension is known at
+ * compile time.
+ *
+ * Solution vectors and residuals are contiguous arrays of the problem
+ * dimension. Jacobians are contiguous arrays of the problem dimension squared
+ * stored in row-major order.
+ */
+//---------------------------------------------------------------------------//
+template <typename NonlinearProblem>
+class FixedNonlinearProblemTraits
+{
+  public:
+    //! Typedef for NonlinearProblem.
+    typedef NonlinearProblem nonlinear_problem_type;
+
+    //! Typedef for scalar type.
+    typedef typename NonlinearProblem::scalar_type Scalar;
+
+    //! Update the state of the nonlinear problem given a new solution vector.
+    static inline void updateState( NonlinearProblem &problem,
+                                    const Scalar *u )
+    {
+        UndefinedNonlinearProblemTraits<NonlinearProblem>::notDefined();
+    }
+
+    //! Compute the nonlinear residual given a new solution vector.
+    static inline void evaluateResidual( const NonlinearProblem &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        UndefinedNonlinearProblemTraits<NonlinearProblem>::notDefined();
+    }
+
+    //! Compute the row-major Jacobian matrix given a new solution vector.
+    static inline void evaluateJacobian( const NonlinearProblem &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        UndefinedNonlinearProblemTraits<NonlinearProblem>::notDefined();
+    }
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_FIXEDNONLINEARPROBLEMTRAITS_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_FixedNonlinearProblemTraits.hpp
+//---------------------------------------------------------------------------//
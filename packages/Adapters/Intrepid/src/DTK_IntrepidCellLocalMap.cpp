@@ -166,6 +166,60 @@ void IntrepidCellLocalMap::mapToPhysicalFrame(
     entity_cell.mapToCellPhysicalFrame( ref_point_container, point_container );
 }
 
+//---------------------------------------------------------------------------//
+// Map a point to the reference space of each of a set of candidate faces.
+void IntrepidCellLocalMap::mapToCandidateFaces(
+    const Teuchos::ParameterList &parameters,
+    const shards::CellTopology &face_topo,
+    const Intrepid::FieldContainer<double> &faces_coords,
+    const Intrepid::FieldContainer<double> &faces_node_normals,
+    const Teuchos::ArrayView<const double> &point,
+    Teuchos::Array<int> &mapped_faces,
+    Teuchos::Array<double> &reference_points )
+{
+    DTK_REQUIRE( 3 == faces_coords.rank() );
+    DTK_REQUIRE( point.size() == faces_coords.dimension( 2 ) );
+
+    int num_faces = faces_coords.dimension( 0 );
+    int space_dim = faces_coords.dimension( 2 );
+
+    // Reject the candidates whose volume of influence does not contain the
+    // point. All candidates are checked in a single batch.
+    Teuchos::Array<int> point_dims( 1, space_dim );
+    Intrepid::FieldContainer<double> point_container(
+        point_dims, const_cast<double *>( point.getRawPtr() ) );
+    Teuchos::Array<int> in_volume( num_faces );
+    ProjectionPrimitives::pointInFacesVolumeOfInfluence(
+        parameters, point_container, faces_coords, faces_node_normals,
+        face_topo, in_volume() );
+
+    // Project the point onto the remaining candidates. The face basis and
+    // projection problem are built once and reset for each candidate.
+    Intrepid::FieldContainer<double> parametric_points( num_faces, space_dim );
+    Intrepid::FieldContainer<double> physical_points( num_faces, space_dim );
+    Teuchos::Array<int> face_edge_ids( num_faces );
+    Teuchos::Array<int> face_node_ids( num_faces );
+    ProjectionPrimitives::projectPointToFaces(
+        parameters, point_container, faces_coords, faces_node_normals,
+        face_topo, in_volume(), parametric_points, physical_points,
+        face_edge_ids(), face_node_ids() );
+
+    // Extract the mapped faces.
+    mapped_faces.clear();
+    reference_points.clear();
+    for ( int f = 0; f < num_faces; ++f )
+    {
+        if ( in_volume[f] )
+        {
+            mapped_faces.push_back( f );
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                reference_points.push_back( parametric_points( f, d ) );
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -42,7 +42,9 @@
 #ifndef DTK_INTREPIDCELLLOCALMAP_HPP
 #define DTK_INTREPIDCELLLOCALMAP_HPP
 
+#include <Teuchos_Array.hpp>
 #include <Teuchos_ArrayView.hpp>
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
 #include <Shards_CellTopology.hpp>
@@ -127,6 +129,31 @@ class IntrepidCellLocalMap
                         const Intrepid::FieldContainer<double> &entity_coords,
                         const Teuchos::ArrayView<const double> &reference_point,
                         const Teuchos::ArrayView<double> &point );
+
+    /*!
+     * \brief (Reverse Map) Map a point to the reference space of each of a
+     * set of candidate faces of the same topology. Faces whose volume of
+     * influence does not contain the point are rejected before any
+     * projection is computed.
+     * \param parameters Projection parameters.
+     * \param face_topo The topology of the candidate faces.
+     * \param faces_coords Candidate face node coordinates (Face,Node,Dim).
+     * \param faces_node_normals Candidate face node normals (Face,Node,Dim).
+     * \param point A view into an array of size physicalDimension()
+     * containing the coordinates of the point to map.
+     * \param mapped_faces The indices of the candidate faces the point was
+     * mapped to.
+     * \param reference_points The reference coordinates of the point on each
+     * of the mapped faces, physicalDimension() values per face.
+     */
+    static void mapToCandidateFaces(
+        const Teuchos::ParameterList &parameters,
+        const shards::CellTopology &face_topo,
+        const Intrepid::FieldContainer<double> &faces_coords,
+        const Intrepid::FieldContainer<double> &faces_node_normals,
+        const Teuchos::ArrayView<const double> &point,
+        Teuchos::Array<int> &mapped_faces,
+        Teuchos::Array<double> &reference_points );
 };
 
 //---------------------------------------------------------------------------//
@@ -76,6 +76,48 @@ void IntrepidShapeFunction::evaluateValue(
                       Intrepid::OPERATOR_VALUE );
 }
 
+//---------------------------------------------------------------------------//
+// Given an topology and a set of reference points, evaluate the shape
+// function of the topology at all of the points at once.
+void IntrepidShapeFunction::evaluateValues(
+    const shards::CellTopology &topology,
+    const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+    Teuchos::Array<double> &values ) const
+{
+    // Get the basis for the topology.
+    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
+        basis = getIntrepidBasis( topology );
+
+    // Pack the reference points.
+    int num_points = reference_points.size();
+    int space_dim = ( num_points > 0 ) ? reference_points[0].size() : 0;
+    Intrepid::FieldContainer<double> point_container( num_points, space_dim );
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            point_container( p, d ) = reference_points[p][d];
+        }
+    }
+
+    // Evaluate the basis function at all points.
+    int cardinality = basis->getCardinality();
+    Intrepid::FieldContainer<double> value_container( cardinality,
+                                                      num_points );
+    basis->getValues( value_container, point_container,
+                      Intrepid::OPERATOR_VALUE );
+
+    // Extract the evaluations ordered by point.
+    values.resize( num_points * cardinality );
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int n = 0; n < cardinality; ++n )
+        {
+            values[p * cardinality + n] = value_container( n, p );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Given an topology and a reference point, evaluate the gradient of the shape
 // function of the topology at that point.
@@ -75,6 +75,24 @@ class IntrepidShapeFunction
                         const Teuchos::ArrayView<const double> &reference_point,
                         Teuchos::Array<double> &values ) const;
 
+    /*!
+     * \brief Given an topology and a set of reference points, evaluate the
+     * shape function of the topology at all of the points at once.
+     *
+     * \param topology Evaluate the shape function of this topology.
+     *
+     * \param reference_points Evaluate the shape function at these points
+     * given in reference coordinates.
+     *
+     * \param values Topology shape function evaluated at the reference
+     * points ordered as values[p*N + n] for the nth basis function at the
+     * pth point.
+     */
+    void evaluateValues(
+        const shards::CellTopology &topology,
+        const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+        Teuchos::Array<double> &values ) const;
+
     /*!
      * \brief Given an topology and a reference point, evaluate the gradient of
      * the shape function of the topology at that point.
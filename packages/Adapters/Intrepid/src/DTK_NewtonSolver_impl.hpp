@@ -45,6 +45,7 @@
 #include <limits>
 
 #include "DTK_DBC.hpp"
+#include "DTK_Profiler.hpp"
 
 #include <Teuchos_ScalarTraits.hpp>
 
@@ -103,8 +104,11 @@ void NewtonSolver<NonlinearProblem>::solve( MDArray &u,
     }
 
     // Nonlinear solve.
+    int num_iters = 0;
     for ( int k = 0; k < max_iters; ++k )
     {
+        ++num_iters;
+
         // Solve the linear model, delta_u = J^-1 * -F(u).
         Intrepid::RealSpaceTools<Scalar>::inverse( J_inv, J );
         Intrepid::RealSpaceTools<Scalar>::matvec( update, J_inv, F );
@@ -137,6 +141,10 @@ void NewtonSolver<NonlinearProblem>::solve( MDArray &u,
         NPT::evaluateJacobian( problem, u, J );
     }
 
+    // Record the number of iterations.
+    Profiler::recordCount( "Newton Solves", 1 );
+    Profiler::recordCount( "Newton Iterations", num_iters );
+
     // Check for convergence.
     DTK_ENSURE( tolerance > conv_check( 0 ) );
 }
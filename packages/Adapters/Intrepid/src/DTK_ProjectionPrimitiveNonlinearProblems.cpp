@@ -48,7 +48,6 @@
 #include <Shards_CellTopology.hpp>
 
 #include <Intrepid_Basis.hpp>
-#include <Intrepid_RealSpaceTools.hpp>
 #include <Intrepid_Types.hpp>
 
 namespace DataTransferKit
@@ -81,17 +80,72 @@ ProjectPointToFaceNonlinearProblem::ProjectPointToFaceNonlinearProblem(
     d_eval_points = Intrepid::FieldContainer<double>( num_points, d_topo_dim );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Reset the point to be projected. The face data and work arrays
+ * are kept so a single problem may be solved for many points.
+ */
+void ProjectPointToFaceNonlinearProblem::setPoint(
+    const Intrepid::FieldContainer<double> &point )
+{
+    DTK_REQUIRE( 1 == point.rank() );
+    DTK_REQUIRE( d_space_dim == point.dimension( 0 ) );
+
+    for ( int i = 0; i < d_space_dim; ++i )
+    {
+        d_point( i ) = point( i );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Reset the face to project to. The face data is overwritten in place
+ * so a single problem may be reused for many faces of the same topology.
+ */
+void ProjectPointToFaceNonlinearProblem::setFace(
+    const Intrepid::FieldContainer<double> &face_nodes,
+    const Intrepid::FieldContainer<double> &face_node_normals )
+{
+    DTK_REQUIRE( 2 == face_nodes.rank() );
+    DTK_REQUIRE( 2 == face_node_normals.rank() );
+    DTK_REQUIRE( d_face_nodes.dimension( 0 ) == face_nodes.dimension( 0 ) );
+    DTK_REQUIRE( d_face_nodes.dimension( 0 ) ==
+                 face_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( d_space_dim == face_nodes.dimension( 1 ) );
+    DTK_REQUIRE( d_space_dim == face_node_normals.dimension( 1 ) );
+
+    int num_nodes = face_nodes.dimension( 0 );
+    for ( int n = 0; n < num_nodes; ++n )
+    {
+        for ( int i = 0; i < d_space_dim; ++i )
+        {
+            d_face_nodes( n, i ) = face_nodes( n, i );
+            d_face_node_normals( n, i ) = face_node_normals( n, i );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Update the state of the problem given the new solution vector.
  */
 void ProjectPointToFaceNonlinearProblem::updateState(
     const Intrepid::FieldContainer<double> &u )
+{
+    updateState( &u( 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Update the state of the problem given the new solution vector
+ * stored contiguously.
+ */
+void ProjectPointToFaceNonlinearProblem::updateState( const double *u )
 {
     // Extract the current natural coordinates from the solution vector.
     for ( int i = 0; i < d_topo_dim; ++i )
     {
-        d_eval_points( 0, i ) = u( 0, i );
+        d_eval_points( 0, i ) = u[i];
     }
 
     // Evaluate the basis at the current natural coordinates.
@@ -116,15 +170,25 @@ void ProjectPointToFaceNonlinearProblem::evaluateResidual(
     DTK_REQUIRE( F.dimension( 0 ) == u.dimension( 0 ) );
     DTK_REQUIRE( F.dimension( 1 ) == u.dimension( 1 ) );
 
+    evaluateResidual( &u( 0, 0 ), &F( 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the nonlinear residual into a contiguous vector.
+ */
+void ProjectPointToFaceNonlinearProblem::evaluateResidual(
+    const double *u, double *F ) const
+{
     // Build the nonlinear residual.
     for ( int i = 0; i < d_space_dim; ++i )
     {
-        F( 0, i ) = -d_point( i );
+        F[i] = -d_point( i );
         for ( int n = 0; n < d_cardinality; ++n )
         {
-            F( 0, i ) += d_basis_evals( n, 0 ) *
-                         ( d_face_nodes( n, i ) -
-                           u( 0, d_topo_dim ) * d_face_node_normals( n, i ) );
+            F[i] += d_basis_evals( n, 0 ) *
+                    ( d_face_nodes( n, i ) -
+                      u[d_topo_dim] * d_face_node_normals( n, i ) );
         }
     }
 }
@@ -143,27 +207,37 @@ void ProjectPointToFaceNonlinearProblem::evaluateJacobian(
     DTK_REQUIRE( J.dimension( 1 ) == u.dimension( 1 ) );
     DTK_REQUIRE( J.dimension( 2 ) == u.dimension( 1 ) );
 
+    evaluateJacobian( &u( 0, 0 ), &J( 0, 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the jacobian into a contiguous row-major matrix.
+ */
+void ProjectPointToFaceNonlinearProblem::evaluateJacobian(
+    const double *u, double *J ) const
+{
     // Build the Jacobian.
     for ( int i = 0; i < d_space_dim; ++i )
     {
         // Start with the basis gradient contributions.
         for ( int j = 0; j < d_topo_dim; ++j )
         {
-            J( 0, i, j ) = 0.0;
+            J[i * d_space_dim + j] = 0.0;
             for ( int n = 0; n < d_cardinality; ++n )
             {
-                J( 0, i, j ) +=
+                J[i * d_space_dim + j] +=
                     d_grad_evals( n, 0, j ) *
                     ( d_face_nodes( n, i ) -
-                      u( 0, d_topo_dim ) * d_face_node_normals( n, i ) );
+                      u[d_topo_dim] * d_face_node_normals( n, i ) );
             }
         }
 
         // Then add the point normal contribution.
-        J( 0, i, d_space_dim - 1 ) = 0.0;
+        J[i * d_space_dim + d_space_dim - 1] = 0.0;
         for ( int n = 0; n < d_cardinality; ++n )
         {
-            J( 0, i, d_space_dim - 1 ) -=
+            J[i * d_space_dim + d_space_dim - 1] -=
                 d_basis_evals( n, 0 ) * d_face_node_normals( n, i );
         }
     }
@@ -192,6 +266,7 @@ PointInFaceVolumeOfInfluenceNonlinearProblem::
     DTK_CHECK( d_face_edge_nodes.dimension( 0 ) ==
                d_face_edge_node_normals.dimension( 0 ) );
     d_space_dim = point.dimension( 0 );
+    DTK_CHECK( 3 == d_space_dim );
     d_topo_dim = d_space_dim - 1;
     d_cardinality = 4;
     int num_points = 1;
@@ -205,12 +280,54 @@ PointInFaceVolumeOfInfluenceNonlinearProblem::
     // Compute the two extra psuedo-nodes along the node normal
     // directions.
     d_face_normal_nodes = Intrepid::FieldContainer<double>( 2, d_space_dim );
-    for ( int j = 0; j < d_space_dim; ++j )
+    setFaceEdge( face_edge_nodes, face_edge_node_normals, c );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Reset the face edge to be checked. The edge data is overwritten in
+ * place so a single problem may be reused for the edges of many faces.
+ */
+void PointInFaceVolumeOfInfluenceNonlinearProblem::setFaceEdge(
+    const Intrepid::FieldContainer<double> &face_edge_nodes,
+    const Intrepid::FieldContainer<double> &face_edge_node_normals,
+    const double c )
+{
+    DTK_REQUIRE( 2 == face_edge_nodes.rank() );
+    DTK_REQUIRE( 2 == face_edge_node_normals.rank() );
+    DTK_REQUIRE( 2 == face_edge_nodes.dimension( 0 ) );
+    DTK_REQUIRE( 2 == face_edge_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( d_space_dim == face_edge_nodes.dimension( 1 ) );
+    DTK_REQUIRE( d_space_dim == face_edge_node_normals.dimension( 1 ) );
+
+    d_c = c;
+    for ( int n = 0; n < 2; ++n )
+    {
+        for ( int j = 0; j < d_space_dim; ++j )
+        {
+            d_face_edge_nodes( n, j ) = face_edge_nodes( n, j );
+            d_face_edge_node_normals( n, j ) = face_edge_node_normals( n, j );
+            d_face_normal_nodes( n, j ) =
+                d_face_edge_nodes( n, j ) +
+                d_c * d_face_edge_node_normals( n, j );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Reset the point to be checked. The face data and work arrays
+ * are kept so a single problem may be solved for many points.
+ */
+void PointInFaceVolumeOfInfluenceNonlinearProblem::setPoint(
+    const Intrepid::FieldContainer<double> &point )
+{
+    DTK_REQUIRE( 1 == point.rank() );
+    DTK_REQUIRE( d_space_dim == point.dimension( 0 ) );
+
+    for ( int i = 0; i < d_space_dim; ++i )
     {
-        d_face_normal_nodes( 0, j ) =
-            face_edge_nodes( 0, j ) + d_c * d_face_edge_node_normals( 0, j );
-        d_face_normal_nodes( 1, j ) =
-            face_edge_nodes( 1, j ) + d_c * d_face_edge_node_normals( 1, j );
+        d_point( i ) = point( i );
     }
 }
 
@@ -220,35 +337,48 @@ PointInFaceVolumeOfInfluenceNonlinearProblem::
  */
 void PointInFaceVolumeOfInfluenceNonlinearProblem::updateState(
     const Intrepid::FieldContainer<double> &u )
+{
+    updateState( &u( 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Update the state of the problem given the new solution vector
+ * stored contiguously.
+ */
+void PointInFaceVolumeOfInfluenceNonlinearProblem::updateState(
+    const double *u )
 {
     // Evaluate the basis at the current natural coordinates.
-    d_basis_evals( 0, 0 ) = ( 1.0 - u( 0, 0 ) ) * ( 1.0 - u( 0, 1 ) );
-    d_basis_evals( 1, 0 ) = u( 0, 0 ) * ( 1.0 - u( 0, 1 ) );
-    d_basis_evals( 2, 0 ) = u( 0, 0 ) * u( 0, 1 );
-    d_basis_evals( 3, 0 ) = ( 1.0 - u( 0, 0 ) ) * u( 0, 1 );
+    d_basis_evals( 0, 0 ) = ( 1.0 - u[0] ) * ( 1.0 - u[1] );
+    d_basis_evals( 1, 0 ) = u[0] * ( 1.0 - u[1] );
+    d_basis_evals( 2, 0 ) = u[0] * u[1];
+    d_basis_evals( 3, 0 ) = ( 1.0 - u[0] ) * u[1];
 
     // Evaluate the basis gradient at the current natural coordinates.
-    d_grad_evals( 0, 0, 0 ) = u( 0, 1 ) - 1.0;
-    d_grad_evals( 1, 0, 0 ) = 1.0 - u( 0, 1 );
-    d_grad_evals( 2, 0, 0 ) = u( 0, 1 );
-    d_grad_evals( 3, 0, 0 ) = -u( 0, 1 );
-    d_grad_evals( 0, 0, 1 ) = u( 0, 0 ) - 1.0;
-    d_grad_evals( 1, 0, 1 ) = -u( 0, 0 );
-    d_grad_evals( 2, 0, 1 ) = u( 0, 0 );
-    d_grad_evals( 3, 0, 1 ) = 1.0 - u( 0, 0 );
+    d_grad_evals( 0, 0, 0 ) = u[1] - 1.0;
+    d_grad_evals( 1, 0, 0 ) = 1.0 - u[1];
+    d_grad_evals( 2, 0, 0 ) = u[1];
+    d_grad_evals( 3, 0, 0 ) = -u[1];
+    d_grad_evals( 0, 0, 1 ) = u[0] - 1.0;
+    d_grad_evals( 1, 0, 1 ) = -u[0];
+    d_grad_evals( 2, 0, 1 ) = u[0];
+    d_grad_evals( 3, 0, 1 ) = 1.0 - u[0];
 
     // Compute the current projection normal direction.
-    Intrepid::FieldContainer<double> v1( d_space_dim );
-    Intrepid::FieldContainer<double> v2( d_space_dim );
+    double v1[3];
+    double v2[3];
     for ( int i = 0; i < d_space_dim; ++i )
     {
-        v1( i ) = d_face_edge_nodes( 1, i ) - d_face_edge_nodes( 0, i ) +
-                  d_c * u( 0, 1 ) * ( d_face_edge_node_normals( 1, i ) -
-                                      d_face_edge_node_normals( 0, i ) );
-        v2( i ) = u( 0, 0 ) * d_face_edge_node_normals( 1, i ) +
-                  ( 1 - u( 0, 0 ) ) * d_face_edge_node_normals( 0, i );
+        v1[i] = d_face_edge_nodes( 1, i ) - d_face_edge_nodes( 0, i ) +
+                d_c * u[1] * ( d_face_edge_node_normals( 1, i ) -
+                               d_face_edge_node_normals( 0, i ) );
+        v2[i] = u[0] * d_face_edge_node_normals( 1, i ) +
+                ( 1 - u[0] ) * d_face_edge_node_normals( 0, i );
     }
-    Intrepid::RealSpaceTools<Scalar>::vecprod( d_proj_normal, v1, v2 );
+    d_proj_normal( 0 ) = v1[1] * v2[2] - v1[2] * v2[1];
+    d_proj_normal( 1 ) = v1[2] * v2[0] - v1[0] * v2[2];
+    d_proj_normal( 2 ) = v1[0] * v2[1] - v1[1] * v2[0];
 }
 
 //---------------------------------------------------------------------------//
@@ -264,14 +394,24 @@ void PointInFaceVolumeOfInfluenceNonlinearProblem::evaluateResidual(
     DTK_REQUIRE( F.dimension( 0 ) == u.dimension( 0 ) );
     DTK_REQUIRE( F.dimension( 1 ) == u.dimension( 1 ) );
 
+    evaluateResidual( &u( 0, 0 ), &F( 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the nonlinear residual into a contiguous vector.
+ */
+void PointInFaceVolumeOfInfluenceNonlinearProblem::evaluateResidual(
+    const double *u, double *F ) const
+{
     // Build the nonlinear residual.
     for ( int i = 0; i < d_space_dim; ++i )
     {
-        F( 0, i ) = d_basis_evals( 0, 0 ) * d_face_edge_nodes( 0, i ) +
-                    d_basis_evals( 1, 0 ) * d_face_edge_nodes( 1, i ) +
-                    d_basis_evals( 2, 0 ) * d_face_normal_nodes( 1, i ) +
-                    d_basis_evals( 3, 0 ) * d_face_normal_nodes( 0, i ) +
-                    u( 0, 2 ) * d_proj_normal( i ) - d_point( i );
+        F[i] = d_basis_evals( 0, 0 ) * d_face_edge_nodes( 0, i ) +
+               d_basis_evals( 1, 0 ) * d_face_edge_nodes( 1, i ) +
+               d_basis_evals( 2, 0 ) * d_face_normal_nodes( 1, i ) +
+               d_basis_evals( 3, 0 ) * d_face_normal_nodes( 0, i ) +
+               u[2] * d_proj_normal( i ) - d_point( i );
     }
 }
 
@@ -289,13 +429,23 @@ void PointInFaceVolumeOfInfluenceNonlinearProblem::evaluateJacobian(
     DTK_REQUIRE( J.dimension( 1 ) == u.dimension( 1 ) );
     DTK_REQUIRE( J.dimension( 2 ) == u.dimension( 1 ) );
 
+    evaluateJacobian( &u( 0, 0 ), &J( 0, 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the jacobian into a contiguous row-major matrix.
+ */
+void PointInFaceVolumeOfInfluenceNonlinearProblem::evaluateJacobian(
+    const double *u, double *J ) const
+{
     // Build the Jacobian.
     for ( int i = 0; i < d_space_dim; ++i )
     {
         // Start with the basis gradient contributions.
         for ( int j = 0; j < d_topo_dim; ++j )
         {
-            J( 0, i, j ) =
+            J[i * d_space_dim + j] =
                 d_grad_evals( 0, 0, j ) * d_face_edge_nodes( 0, i ) +
                 d_grad_evals( 1, 0, j ) * d_face_edge_nodes( 1, i ) +
                 d_grad_evals( 2, 0, j ) * d_face_normal_nodes( 1, i ) +
@@ -303,7 +453,7 @@ void PointInFaceVolumeOfInfluenceNonlinearProblem::evaluateJacobian(
         }
 
         // Then add the point normal contribution.
-        J( 0, i, d_space_dim - 1 ) = d_proj_normal( i );
+        J[i * d_space_dim + d_space_dim - 1] = d_proj_normal( i );
     }
 }
 
@@ -318,7 +468,7 @@ ProjectPointFeatureToEdgeFeatureNonlinearProblem::
         const Intrepid::FieldContainer<double> &point,
         const Intrepid::FieldContainer<double> &edge_nodes,
         const Intrepid::FieldContainer<double> &edge_node_normals,
-        const Intrepid::FieldContainer<double> &edge_node_binormals )
+        const std::array<std::array<double, 3>, 2> &edge_node_binormals )
     : d_point( point )
     , d_edge_nodes( edge_nodes )
     , d_edge_node_normals( edge_node_normals )
@@ -327,14 +477,12 @@ ProjectPointFeatureToEdgeFeatureNonlinearProblem::
     DTK_CHECK( 1 == d_point.rank() );
     DTK_CHECK( 2 == d_edge_nodes.rank() );
     DTK_CHECK( 2 == d_edge_node_normals.rank() );
-    DTK_CHECK( 2 == d_edge_node_binormals.rank() );
     DTK_CHECK( d_point.dimension( 0 ) == d_edge_nodes.dimension( 1 ) );
     DTK_CHECK( d_point.dimension( 0 ) == d_edge_node_normals.dimension( 1 ) );
     DTK_CHECK( d_edge_nodes.dimension( 0 ) ==
                d_edge_node_normals.dimension( 0 ) );
-    DTK_CHECK( d_point.dimension( 0 ) == d_edge_node_binormals.dimension( 1 ) );
-    DTK_CHECK( d_edge_nodes.dimension( 0 ) ==
-               d_edge_node_binormals.dimension( 0 ) );
+    DTK_CHECK( 2 == d_edge_nodes.dimension( 0 ) );
+    DTK_CHECK( 3 == d_point.dimension( 0 ) );
     d_space_dim = d_point.dimension( 0 );
 }
 
@@ -347,6 +495,16 @@ void ProjectPointFeatureToEdgeFeatureNonlinearProblem::updateState(
 { /* ... */
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Update the state of the problem given the new solution vector
+ * stored contiguously.
+ */
+void ProjectPointFeatureToEdgeFeatureNonlinearProblem::updateState(
+    const double *u )
+{ /* ... */
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Evaluate the nonlinear residual.
@@ -360,19 +518,28 @@ void ProjectPointFeatureToEdgeFeatureNonlinearProblem::evaluateResidual(
     DTK_REQUIRE( F.dimension( 0 ) == u.dimension( 0 ) );
     DTK_REQUIRE( F.dimension( 1 ) == u.dimension( 1 ) );
 
+    evaluateResidual( &u( 0, 0 ), &F( 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the nonlinear residual into a contiguous vector.
+ */
+void ProjectPointFeatureToEdgeFeatureNonlinearProblem::evaluateResidual(
+    const double *u, double *F ) const
+{
     // Build the nonlinear residual.
     for ( int i = 0; i < d_space_dim; ++i )
     {
-        F( 0, i ) =
-            d_edge_nodes( 0, i ) +
-            u( 0, 0 ) * ( d_edge_nodes( 1, i ) - d_edge_nodes( 0, i ) ) +
-            u( 0, 1 ) * ( d_edge_node_normals( 0, i ) +
-                          u( 0, 0 ) * ( d_edge_node_normals( 1, i ) -
-                                        d_edge_node_normals( 0, i ) ) ) +
-            u( 0, 2 ) * ( d_edge_node_binormals( 0, i ) +
-                          u( 0, 0 ) * ( d_edge_node_binormals( 1, i ) -
-                                        d_edge_node_binormals( 0, i ) ) ) -
-            d_point( i );
+        F[i] = d_edge_nodes( 0, i ) +
+               u[0] * ( d_edge_nodes( 1, i ) - d_edge_nodes( 0, i ) ) +
+               u[1] * ( d_edge_node_normals( 0, i ) +
+                        u[0] * ( d_edge_node_normals( 1, i ) -
+                                 d_edge_node_normals( 0, i ) ) ) +
+               u[2] * ( d_edge_node_binormals[0][i] +
+                        u[0] * ( d_edge_node_binormals[1][i] -
+                                 d_edge_node_binormals[0][i] ) ) -
+               d_point( i );
     }
 }
 
@@ -390,22 +557,35 @@ void ProjectPointFeatureToEdgeFeatureNonlinearProblem::evaluateJacobian(
     DTK_REQUIRE( J.dimension( 1 ) == u.dimension( 1 ) );
     DTK_REQUIRE( J.dimension( 2 ) == u.dimension( 1 ) );
 
+    evaluateJacobian( &u( 0, 0 ), &J( 0, 0, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the jacobian into a contiguous row-major matrix.
+ */
+void ProjectPointFeatureToEdgeFeatureNonlinearProblem::evaluateJacobian(
+    const double *u, double *J ) const
+{
     // Build the Jacobian.
     for ( int i = 0; i < d_space_dim; ++i )
     {
-        J( 0, i, 0 ) = ( d_edge_nodes( 1, i ) - d_edge_nodes( 0, i ) ) +
-                       u( 0, 1 ) * ( d_edge_node_normals( 1, i ) -
-                                     d_edge_node_normals( 0, i ) ) +
-                       u( 0, 2 ) * ( d_edge_node_binormals( 1, i ) -
-                                     d_edge_node_binormals( 0, i ) );
-
-        J( 0, i, 1 ) = d_edge_node_normals( 0, i ) +
-                       u( 0, 0 ) * ( d_edge_node_normals( 1, i ) -
-                                     d_edge_node_normals( 0, i ) );
-
-        J( 0, i, 2 ) = d_edge_node_binormals( 0, i ) +
-                       u( 0, 0 ) * ( d_edge_node_binormals( 1, i ) -
-                                     d_edge_node_binormals( 0, i ) );
+        J[i * d_space_dim] =
+            ( d_edge_nodes( 1, i ) - d_edge_nodes( 0, i ) ) +
+            u[1] * ( d_edge_node_normals( 1, i ) -
+                     d_edge_node_normals( 0, i ) ) +
+            u[2] * ( d_edge_node_binormals[1][i] -
+                     d_edge_node_binormals[0][i] );
+
+        J[i * d_space_dim + 1] =
+            d_edge_node_normals( 0, i ) +
+            u[0] * ( d_edge_node_normals( 1, i ) -
+                     d_edge_node_normals( 0, i ) );
+
+        J[i * d_space_dim + 2] =
+            d_edge_node_binormals[0][i] +
+            u[0] * ( d_edge_node_binormals[1][i] -
+                     d_edge_node_binormals[0][i] );
     }
 }
 
@@ -41,8 +41,10 @@
 #ifndef DTK_PROJECTIONPRIMITIVENONLINEARPROBLEMS_HPP
 #define DTK_PROJECTIONPRIMITIVENONLINEARPROBLEMS_HPP
 
+#include <array>
 #include <cmath>
 
+#include "DTK_FixedNonlinearProblemTraits.hpp"
 #include "DTK_NonlinearProblemTraits.hpp"
 
 #include <Teuchos_RCP.hpp>
@@ -77,6 +79,13 @@ class ProjectPointToFaceNonlinearProblem
         const Intrepid::FieldContainer<double> &face_nodes,
         const Intrepid::FieldContainer<double> &face_node_normals );
 
+    // Reset the point to be projected so the problem can be reused.
+    void setPoint( const Intrepid::FieldContainer<double> &point );
+
+    // Reset the face to project to so the problem can be reused.
+    void setFace( const Intrepid::FieldContainer<double> &face_nodes,
+                  const Intrepid::FieldContainer<double> &face_node_normals );
+
     //! Update the state of the problem given the new solution vector.
     void updateState( const Intrepid::FieldContainer<double> &u );
 
@@ -88,6 +97,15 @@ class ProjectPointToFaceNonlinearProblem
     void evaluateJacobian( const Intrepid::FieldContainer<double> &u,
                            Intrepid::FieldContainer<double> &J ) const;
 
+    // Update the state of the problem given a contiguous solution vector.
+    void updateState( const double *u );
+
+    // Evaluate the nonlinear residual into a contiguous vector.
+    void evaluateResidual( const double *u, double *F ) const;
+
+    // Evaluate the jacobian into a contiguous row-major matrix.
+    void evaluateJacobian( const double *u, double *J ) const;
+
   public:
     // Basis of the face we are projecting to.
     Teuchos::RCP<Intrepid::Basis<Scalar, Intrepid::FieldContainer<double>>>
@@ -158,6 +176,36 @@ class NonlinearProblemTraits<ProjectPointToFaceNonlinearProblem>
     }
 };
 
+//---------------------------------------------------------------------------//
+// ProjectPointToFaceNonlinearProblem fixed traits implementation.
+//---------------------------------------------------------------------------//
+template <>
+class FixedNonlinearProblemTraits<ProjectPointToFaceNonlinearProblem>
+{
+  public:
+    typedef ProjectPointToFaceNonlinearProblem nonlinear_problem_type;
+
+    typedef typename nonlinear_problem_type::Scalar Scalar;
+
+    static inline void updateState( nonlinear_problem_type &problem,
+                                    const Scalar *u )
+    {
+        problem.updateState( u );
+    }
+
+    static inline void evaluateResidual( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * \class PointInFaceVolumeOfInfluenceNonlinearProblem.
@@ -180,6 +228,15 @@ class PointInFaceVolumeOfInfluenceNonlinearProblem
         const Intrepid::FieldContainer<double> &face_edge_node_normals,
         const double c );
 
+    // Reset the point to be checked so the problem can be reused.
+    void setPoint( const Intrepid::FieldContainer<double> &point );
+
+    // Reset the face edge to be checked so the problem can be reused.
+    void setFaceEdge(
+        const Intrepid::FieldContainer<double> &face_edge_nodes,
+        const Intrepid::FieldContainer<double> &face_edge_node_normals,
+        const double c );
+
     // Update the state of the problem given the new solution vector.
     void updateState( const Intrepid::FieldContainer<double> &u );
 
@@ -191,6 +248,15 @@ class PointInFaceVolumeOfInfluenceNonlinearProblem
     void evaluateJacobian( const Intrepid::FieldContainer<double> &u,
                            Intrepid::FieldContainer<double> &J ) const;
 
+    // Update the state of the problem given a contiguous solution vector.
+    void updateState( const double *u );
+
+    // Evaluate the nonlinear residual into a contiguous vector.
+    void evaluateResidual( const double *u, double *F ) const;
+
+    // Evaluate the jacobian into a contiguous row-major matrix.
+    void evaluateJacobian( const double *u, double *J ) const;
+
   public:
     // Point to check for inclusion in the volume of influence.
     Intrepid::FieldContainer<double> d_point;
@@ -268,6 +334,36 @@ class NonlinearProblemTraits<PointInFaceVolumeOfInfluenceNonlinearProblem>
     }
 };
 
+//---------------------------------------------------------------------------//
+// PointInFaceVolumeOfInfluenceNonlinearProblem fixed traits implementation.
+//---------------------------------------------------------------------------//
+template <>
+class FixedNonlinearProblemTraits<PointInFaceVolumeOfInfluenceNonlinearProblem>
+{
+  public:
+    typedef PointInFaceVolumeOfInfluenceNonlinearProblem nonlinear_problem_type;
+
+    typedef typename nonlinear_problem_type::Scalar Scalar;
+
+    static inline void updateState( nonlinear_problem_type &problem,
+                                    const Scalar *u )
+    {
+        problem.updateState( u );
+    }
+
+    static inline void evaluateResidual( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * \class ProjectPointFeatureToEdgeFeatureNonlinearProblem.
@@ -287,7 +383,7 @@ class ProjectPointFeatureToEdgeFeatureNonlinearProblem
         const Intrepid::FieldContainer<double> &point,
         const Intrepid::FieldContainer<double> &edge_nodes,
         const Intrepid::FieldContainer<double> &edge_node_normals,
-        const Intrepid::FieldContainer<double> &edge_node_binormals );
+        const std::array<std::array<double, 3>, 2> &edge_node_binormals );
 
     // Update the state of the problem given the new solution vector.
     void updateState( const Intrepid::FieldContainer<double> &u );
@@ -300,6 +396,15 @@ class ProjectPointFeatureToEdgeFeatureNonlinearProblem
     void evaluateJacobian( const Intrepid::FieldContainer<double> &u,
                            Intrepid::FieldContainer<double> &J ) const;
 
+    // Update the state of the problem given a contiguous solution vector.
+    void updateState( const double *u );
+
+    // Evaluate the nonlinear residual into a contiguous vector.
+    void evaluateResidual( const double *u, double *F ) const;
+
+    // Evaluate the jacobian into a contiguous row-major matrix.
+    void evaluateJacobian( const double *u, double *J ) const;
+
   public:
     // point to project.
     Intrepid::FieldContainer<double> d_point;
@@ -310,8 +415,8 @@ class ProjectPointFeatureToEdgeFeatureNonlinearProblem
     // Normal vectors of the edge nodes.
     Intrepid::FieldContainer<double> d_edge_node_normals;
 
-    // Binormal vectors of the edge nodes.
-    Intrepid::FieldContainer<double> d_edge_node_binormals;
+    // Binormal vectors of the edge nodes (Node,Dim).
+    std::array<std::array<double, 3>, 2> d_edge_node_binormals;
 
     // Spatial dimension.
     int d_space_dim;
@@ -355,6 +460,38 @@ class NonlinearProblemTraits<ProjectPointFeatureToEdgeFeatureNonlinearProblem>
     }
 };
 
+//---------------------------------------------------------------------------//
+// ProjectPointFeatureToEdgeFeatureNonlinearProblem fixed traits implementation.
+//---------------------------------------------------------------------------//
+template <>
+class FixedNonlinearProblemTraits<
+    ProjectPointFeatureToEdgeFeatureNonlinearProblem>
+{
+  public:
+    typedef ProjectPointFeatureToEdgeFeatureNonlinearProblem
+        nonlinear_problem_type;
+
+    typedef typename nonlinear_problem_type::Scalar Scalar;
+
+    static inline void updateState( nonlinear_problem_type &problem,
+                                    const Scalar *u )
+    {
+        problem.updateState( u );
+    }
+
+    static inline void evaluateResidual( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const nonlinear_problem_type &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
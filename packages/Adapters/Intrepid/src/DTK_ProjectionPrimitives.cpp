@@ -39,12 +39,13 @@
 //---------------------------------------------------------------------------//
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
 #include "DTK_DBC.hpp"
+#include "DTK_FixedNewtonSolver.hpp"
 #include "DTK_IntrepidBasisFactory.hpp"
-#include "DTK_NewtonSolver.hpp"
 #include "DTK_ProjectionPrimitiveNonlinearProblems.hpp"
 #include "DTK_ProjectionPrimitives.hpp"
 
@@ -194,58 +195,185 @@ bool ProjectionPrimitives::pointInFaceVolumeOfInfluence(
     int space_dim = point.dimension( 0 );
     DTK_CHECK( 3 == space_dim );
 
-    // Get the geometric tolerance.
+    // Get the solver parameters.
     double geometric_tolerance =
         parameters.get<double>( "Geometric Tolerance" );
+    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
 
     // Project the point onto each bilinear surface formed by the face vertex
     // normals and the face edges. If the point is on the correct face of each
     // surface then it is within the volume of influence of the
     // face. Counter-clockwise ordering of the nodes on the face about the
     // outward facing normal is required.
-    Intrepid::FieldContainer<double> face_edge_nodes( 2, space_dim );
-    Intrepid::FieldContainer<double> face_edge_node_normals( 2, space_dim );
-    double distance_to_surface = 0.0;
-    int face_num_edges = face_nodes.dimension( 0 );
+    Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem> edge_problems;
+    buildFaceEdgeProblems( point, face_nodes, face_node_normals,
+                           edge_problems );
+    int rejecting_edge = 0;
+    return pointInFaceEdgeProblems( geometric_tolerance, newton_tolerance,
+                                    max_newton_iters, edge_problems,
+                                    rejecting_edge );
+}
 
-    // First edges.
-    for ( int e = 0; e < face_num_edges - 1; ++e )
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Determine if each of a set of points is within the volume of
+ * influence of a single face.
+ *
+ * The edge surface problems for the face are built once and reused for every
+ * point. The edge that rejected the previous point is checked first as
+ * neighboring points are typically rejected by the same edge.
+ *
+ * \param parameters Projection parameters.
+ *
+ * \param points Point coordinates (Point,Dim).
+ *
+ * \param face_nodes Face node coordinates (Node,Dim).
+ *
+ * \param face_node_normals Normal vectors for each face node (Node,Dim).
+ *
+ * \param face_topology Cell topology of the face.
+ *
+ * \param in_volume 1 if the point is in the volume of influence of the face,
+ * 0 if not (Point).
+ */
+void ProjectionPrimitives::pointsInFaceVolumeOfInfluence(
+    const Teuchos::ParameterList &parameters,
+    const Intrepid::FieldContainer<double> &points,
+    const Intrepid::FieldContainer<double> &face_nodes,
+    const Intrepid::FieldContainer<double> &face_node_normals,
+    const shards::CellTopology &face_topology,
+    const Teuchos::ArrayView<int> &in_volume )
+{
+    DTK_REQUIRE( 2 == points.rank() );
+    DTK_REQUIRE( 2 == face_nodes.rank() );
+    DTK_REQUIRE( 2 == face_node_normals.rank() );
+    DTK_REQUIRE( points.dimension( 1 ) == face_nodes.dimension( 1 ) );
+    DTK_REQUIRE( points.dimension( 1 ) == face_node_normals.dimension( 1 ) );
+    DTK_REQUIRE( face_nodes.dimension( 0 ) ==
+                 face_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( Teuchos::as<unsigned>( face_nodes.dimension( 0 ) ) ==
+                 face_topology.getNodeCount() );
+    DTK_REQUIRE( in_volume.size() == points.dimension( 0 ) );
+
+    // Get the dimensions.
+    int num_points = points.dimension( 0 );
+    int space_dim = points.dimension( 1 );
+    DTK_CHECK( 3 == space_dim );
+    if ( 0 == num_points )
     {
-        for ( int i = 0; i < space_dim; ++i )
+        return;
+    }
+
+    // Get the solver parameters.
+    double geometric_tolerance =
+        parameters.get<double>( "Geometric Tolerance" );
+    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
+
+    // Build the edge surface problems once for the face.
+    Intrepid::FieldContainer<double> point( space_dim );
+    Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem> edge_problems;
+    buildFaceEdgeProblems( point, face_nodes, face_node_normals,
+                           edge_problems );
+
+    // Check each point against the face.
+    int rejecting_edge = 0;
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int d = 0; d < space_dim; ++d )
         {
-            face_edge_nodes( 0, i ) = face_nodes( e, i );
-            face_edge_nodes( 1, i ) = face_nodes( e + 1, i );
-            face_edge_node_normals( 0, i ) = face_node_normals( e, i );
-            face_edge_node_normals( 1, i ) = face_node_normals( e + 1, i );
+            point( d ) = points( p, d );
         }
-        distance_to_surface = distanceToFaceBilinearSurface(
-            parameters, point, face_edge_nodes, face_edge_node_normals );
-        if ( distance_to_surface > geometric_tolerance )
+        for ( auto &problem : edge_problems )
         {
-            return false;
+            problem.setPoint( point );
         }
+        in_volume[p] = pointInFaceEdgeProblems(
+                           geometric_tolerance, newton_tolerance,
+                           max_newton_iters, edge_problems, rejecting_edge )
+                           ? 1
+                           : 0;
     }
+}
 
-    // Last edge.
-    for ( int i = 0; i < space_dim; ++i )
-    {
-        face_edge_nodes( 0, i ) = face_nodes( face_num_edges - 1, i );
-        face_edge_nodes( 1, i ) = face_nodes( 0, i );
-        face_edge_node_normals( 0, i ) =
-            face_node_normals( face_num_edges - 1, i );
-        face_edge_node_normals( 1, i ) = face_node_normals( 0, i );
-    }
-    distance_to_surface = distanceToFaceBilinearSurface(
-        parameters, point, face_edge_nodes, face_edge_node_normals );
-    if ( distance_to_surface > geometric_tolerance )
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Determine if a point is within the volume of influence of each of a
+ * set of candidate faces of the same topology.
+ *
+ * \param parameters Projection parameters.
+ *
+ * \param point Point coordinates (Dim).
+ *
+ * \param faces_nodes Face node coordinates (Face,Node,Dim).
+ *
+ * \param faces_node_normals Normal vectors for each face node
+ * (Face,Node,Dim).
+ *
+ * \param face_topology Cell topology of the faces.
+ *
+ * \param in_volume 1 if the point is in the volume of influence of the face,
+ * 0 if not (Face).
+ */
+void ProjectionPrimitives::pointInFacesVolumeOfInfluence(
+    const Teuchos::ParameterList &parameters,
+    const Intrepid::FieldContainer<double> &point,
+    const Intrepid::FieldContainer<double> &faces_nodes,
+    const Intrepid::FieldContainer<double> &faces_node_normals,
+    const shards::CellTopology &face_topology,
+    const Teuchos::ArrayView<int> &in_volume )
+{
+    DTK_REQUIRE( 1 == point.rank() );
+    DTK_REQUIRE( 3 == faces_nodes.rank() );
+    DTK_REQUIRE( 3 == faces_node_normals.rank() );
+    DTK_REQUIRE( faces_nodes.dimension( 0 ) ==
+                 faces_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( faces_nodes.dimension( 1 ) ==
+                 faces_node_normals.dimension( 1 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == faces_nodes.dimension( 2 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == faces_node_normals.dimension( 2 ) );
+    DTK_REQUIRE( Teuchos::as<unsigned>( faces_nodes.dimension( 1 ) ) ==
+                 face_topology.getNodeCount() );
+    DTK_REQUIRE( in_volume.size() == faces_nodes.dimension( 0 ) );
+
+    // Get the dimensions.
+    int num_faces = faces_nodes.dimension( 0 );
+    int num_nodes = faces_nodes.dimension( 1 );
+    int space_dim = point.dimension( 0 );
+    DTK_CHECK( 3 == space_dim );
+
+    // Get the solver parameters.
+    double geometric_tolerance =
+        parameters.get<double>( "Geometric Tolerance" );
+    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
+
+    // Check the point against each face. The face work arrays and the edge
+    // problems are built for the first face and reset for the others.
+    Intrepid::FieldContainer<double> face_nodes( num_nodes, space_dim );
+    Intrepid::FieldContainer<double> face_node_normals( num_nodes, space_dim );
+    Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem> edge_problems;
+    int rejecting_edge = 0;
+    for ( int f = 0; f < num_faces; ++f )
     {
-        return false;
+        for ( int n = 0; n < num_nodes; ++n )
+        {
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                face_nodes( n, d ) = faces_nodes( f, n, d );
+                face_node_normals( n, d ) = faces_node_normals( f, n, d );
+            }
+        }
+        buildFaceEdgeProblems( point, face_nodes, face_node_normals,
+                               edge_problems );
+        rejecting_edge = 0;
+        in_volume[f] = pointInFaceEdgeProblems(
+                           geometric_tolerance, newton_tolerance,
+                           max_newton_iters, edge_problems, rejecting_edge )
+                           ? 1
+                           : 0;
     }
-
-    // If we got here then the point is in the volume of influence of the
-    // face as it was to the left of all bilinear surfaces formed by the
-    // edges and their node normals.
-    return true;
 }
 
 //---------------------------------------------------------------------------//
@@ -302,181 +430,281 @@ void ProjectionPrimitives::projectPointToFace(
     DTK_REQUIRE( point.dimension( 0 ) == parametric_point.dimension( 1 ) );
 
     // Get dimensions.
-    int space_dim = point.dimension( 0 );
     int topo_dim = face_topology.getDimension();
 
-    // Get the geometric tolerance.
+    // Get the solver parameters.
     double geometric_tolerance =
         parameters.get<double>( "Geometric Tolerance" );
-
-    // Get the newton tolerance.
     double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
-
-    // Get the max newton iterations.
-    double max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
 
     // Get the basis functions for the face cell topology.
     Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
         face_basis = IntrepidBasisFactory::create( face_topology );
 
-    // Initializeunknown vector.
-    parametric_point.initialize( 0.0 );
-
-    // Set the initial solution guess to the center of the cell for the
-    // parametric coordinates and 0 for distance.
+    // Get the center of the face for the initial guess.
     int num_points = 1;
     Intrepid::FieldContainer<double> face_center( num_points, topo_dim );
     referenceCellCenter( face_topology, face_center );
-    for ( int n = 0; n < topo_dim; ++n )
-    {
-        parametric_point( 0, n ) = face_center( 0, n );
-    }
-    parametric_point( 0, topo_dim ) = Teuchos::ScalarTraits<double>::zero();
 
     // Build the nonlinear problem data.
     ProjectPointToFaceNonlinearProblem nonlinear_problem(
         face_basis, point, face_nodes, face_node_normals );
 
-    // Solve the nonlinear problem.
-    NewtonSolver<ProjectPointToFaceNonlinearProblem>::solve(
-        parametric_point, nonlinear_problem, newton_tolerance,
-        max_newton_iters );
+    // Project the point.
+    solvePointToFaceProjection( geometric_tolerance, newton_tolerance,
+                                max_newton_iters, face_center, face_topology,
+                                nonlinear_problem, parametric_point,
+                                physical_point, face_edge_id, face_node_id );
+}
 
-    // Apply tolerancing. If the point projected near a face edge or
-    // node within the tolerance, move it to that point.
-    if ( std::abs( parametric_point( 0, 0 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 0 ) = 0.0;
-    }
-    else if ( std::abs( 1.0 - parametric_point( 0, 0 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 0 ) = 1.0;
-    }
-    else if ( std::abs( 1.0 + parametric_point( 0, 0 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 0 ) = -1.0;
-    }
-    if ( std::abs( parametric_point( 0, 1 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 1 ) = 0.0;
-    }
-    else if ( std::abs( 1.0 - parametric_point( 0, 1 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 1 ) = 1.0;
-    }
-    else if ( std::abs( 1.0 + parametric_point( 0, 1 ) ) < geometric_tolerance )
-    {
-        parametric_point( 0, 1 ) = -1.0;
-    }
-    // This case is for the diagonal of the triangle reference geometry.
-    if ( std::abs( 1.0 - parametric_point( 0, 0 ) - parametric_point( 0, 1 ) ) <
-         geometric_tolerance )
-    {
-        parametric_point( 0, 0 ) = 1.0 - parametric_point( 0, 1 );
-    }
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Project a set of points onto a single face and return the physical
+ * and parametric coordinates of each projected point on that face.
+ *
+ * The face basis, reference center, and nonlinear problem are built once and
+ * reused for every point.
+ *
+ * \param parameters Projection parameters.
+ *
+ * \param points Point coordinates (Point,Dim).
+ *
+ * \param face_nodes Face node coordinates (Node,Dim).
+ *
+ * \param face_node_normals Face node normal vectors (Node,Dim).
+ *
+ * \param face_topology Cell topology of the face.
+ *
+ * \param parametric_points Projected points in parametric coordinates with
+ * the distance along the normal in the last component (Point,Dim).
+ *
+ * \param physical_points Projected points in physical coordinates
+ * (Point,Dim).
+ *
+ * \param face_edge_ids The local id of the face edge onto which each point
+ * projected or -1 if it did not project onto an edge (Point).
+ *
+ * \param face_node_ids The local id of the face node onto which each point
+ * projected or -1 if it did not project onto a node (Point).
+ */
+void ProjectionPrimitives::projectPointsToFace(
+    const Teuchos::ParameterList &parameters,
+    const Intrepid::FieldContainer<double> &points,
+    const Intrepid::FieldContainer<double> &face_nodes,
+    const Intrepid::FieldContainer<double> &face_node_normals,
+    const shards::CellTopology &face_topology,
+    Intrepid::FieldContainer<double> &parametric_points,
+    Intrepid::FieldContainer<double> &physical_points,
+    const Teuchos::ArrayView<int> &face_edge_ids,
+    const Teuchos::ArrayView<int> &face_node_ids )
+{
+    DTK_REQUIRE( 2 == points.rank() );
+    DTK_REQUIRE( 2 == face_nodes.rank() );
+    DTK_REQUIRE( 2 == face_node_normals.rank() );
+    DTK_REQUIRE( 2 == parametric_points.rank() );
+    DTK_REQUIRE( 2 == physical_points.rank() );
+    DTK_REQUIRE( points.dimension( 1 ) == face_nodes.dimension( 1 ) );
+    DTK_REQUIRE( points.dimension( 1 ) == face_node_normals.dimension( 1 ) );
+    DTK_REQUIRE( face_nodes.dimension( 0 ) ==
+                 face_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( Teuchos::as<unsigned>( face_nodes.dimension( 0 ) ) ==
+                 face_topology.getNodeCount() );
+    DTK_REQUIRE( points.dimension( 0 ) == parametric_points.dimension( 0 ) );
+    DTK_REQUIRE( points.dimension( 1 ) == parametric_points.dimension( 1 ) );
+    DTK_REQUIRE( points.dimension( 0 ) == physical_points.dimension( 0 ) );
+    DTK_REQUIRE( points.dimension( 1 ) == physical_points.dimension( 1 ) );
+    DTK_REQUIRE( face_edge_ids.size() == points.dimension( 0 ) );
+    DTK_REQUIRE( face_node_ids.size() == points.dimension( 0 ) );
 
-    // Compute the physical coordinates from the projection in the reference
-    // space.
-    nonlinear_problem.updateState( parametric_point );
-    for ( int d = 0; d < space_dim; ++d )
+    // Get dimensions.
+    int num_points = points.dimension( 0 );
+    int space_dim = points.dimension( 1 );
+    int topo_dim = face_topology.getDimension();
+    if ( 0 == num_points )
     {
-        physical_point( d ) = 0.0;
-        for ( int n = 0; n < nonlinear_problem.d_cardinality; ++n )
-        {
-            physical_point( d ) +=
-                nonlinear_problem.d_basis_evals( n, 0 ) * face_nodes( n, d );
-        }
+        return;
     }
 
-    // Determine if the point projected onto any of the face nodes or edges.
-    face_edge_id = -1;
-    face_node_id = -1;
+    // Get the solver parameters.
+    double geometric_tolerance =
+        parameters.get<double>( "Geometric Tolerance" );
+    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
 
-    // Triangle case.
-    if ( ( shards::Triangle<3>::key == face_topology.getKey() ) ||
-         ( shards::Triangle<4>::key == face_topology.getKey() ) ||
-         ( shards::Triangle<6>::key == face_topology.getKey() ) )
+    // Get the basis functions for the face cell topology.
+    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
+        face_basis = IntrepidBasisFactory::create( face_topology );
+
+    // Get the center of the face for the initial guess.
+    Intrepid::FieldContainer<double> face_center( 1, topo_dim );
+    referenceCellCenter( face_topology, face_center );
+
+    // Build the nonlinear problem data once for the face.
+    Intrepid::FieldContainer<double> point( space_dim );
+    ProjectPointToFaceNonlinearProblem nonlinear_problem(
+        face_basis, point, face_nodes, face_node_normals );
+
+    // Project each point.
+    Intrepid::FieldContainer<double> parametric_point( 1, space_dim );
+    Intrepid::FieldContainer<double> physical_point( space_dim );
+    for ( int p = 0; p < num_points; ++p )
     {
-        if ( ( 0.0 == parametric_point( 0, 0 ) ) &&
-             ( 0.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 0;
-        }
-        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
-                  ( 0.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 1;
-        }
-        else if ( ( 0.0 == parametric_point( 0, 0 ) ) &&
-                  ( 1.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 2;
-        }
-        else if ( 0.0 == parametric_point( 0, 1 ) )
-        {
-            face_edge_id = 0;
-        }
-        else if ( 1.0 == parametric_point( 0, 0 ) + parametric_point( 0, 1 ) )
+        for ( int d = 0; d < space_dim; ++d )
         {
-            face_edge_id = 1;
+            point( d ) = points( p, d );
         }
-        else if ( 0.0 == parametric_point( 0, 0 ) )
+        nonlinear_problem.setPoint( point );
+
+        solvePointToFaceProjection(
+            geometric_tolerance, newton_tolerance, max_newton_iters,
+            face_center, face_topology, nonlinear_problem, parametric_point,
+            physical_point, face_edge_ids[p], face_node_ids[p] );
+
+        for ( int d = 0; d < space_dim; ++d )
         {
-            face_edge_id = 2;
+            parametric_points( p, d ) = parametric_point( 0, d );
+            physical_points( p, d ) = physical_point( d );
         }
     }
-    // Quadrilateral case.
-    else if ( ( shards::Quadrilateral<4>::key == face_topology.getKey() ) ||
-              ( shards::Quadrilateral<8>::key == face_topology.getKey() ) ||
-              ( shards::Quadrilateral<9>::key == face_topology.getKey() ) )
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Project a point onto each of a set of candidate faces of the same
+ * topology and return the physical and parametric coordinates of the
+ * projected point on each face.
+ *
+ * The face basis, reference center, and nonlinear problem are built once and
+ * the face data is reset for every candidate.
+ *
+ * \param parameters Projection parameters.
+ *
+ * \param point Point coordinates (Dim).
+ *
+ * \param faces_nodes Face node coordinates (Face,Node,Dim).
+ *
+ * \param faces_node_normals Normal vectors for each face node
+ * (Face,Node,Dim).
+ *
+ * \param face_topology Cell topology of the faces.
+ *
+ * \param project 1 if the point should be projected onto the face, 0 if the
+ * face should be skipped (Face).
+ *
+ * \param parametric_points Projected point on each face in parametric
+ * coordinates with the distance along the normal in the last component
+ * (Face,Dim). Skipped faces are not written.
+ *
+ * \param physical_points Projected point on each face in physical
+ * coordinates (Face,Dim). Skipped faces are not written.
+ *
+ * \param face_edge_ids The local id of the face edge onto which the point
+ * projected or -1 if it did not project onto an edge or the face was skipped
+ * (Face).
+ *
+ * \param face_node_ids The local id of the face node onto which the point
+ * projected or -1 if it did not project onto a node or the face was skipped
+ * (Face).
+ */
+void ProjectionPrimitives::projectPointToFaces(
+    const Teuchos::ParameterList &parameters,
+    const Intrepid::FieldContainer<double> &point,
+    const Intrepid::FieldContainer<double> &faces_nodes,
+    const Intrepid::FieldContainer<double> &faces_node_normals,
+    const shards::CellTopology &face_topology,
+    const Teuchos::ArrayView<const int> &project,
+    Intrepid::FieldContainer<double> &parametric_points,
+    Intrepid::FieldContainer<double> &physical_points,
+    const Teuchos::ArrayView<int> &face_edge_ids,
+    const Teuchos::ArrayView<int> &face_node_ids )
+{
+    DTK_REQUIRE( 1 == point.rank() );
+    DTK_REQUIRE( 3 == faces_nodes.rank() );
+    DTK_REQUIRE( 3 == faces_node_normals.rank() );
+    DTK_REQUIRE( 2 == parametric_points.rank() );
+    DTK_REQUIRE( 2 == physical_points.rank() );
+    DTK_REQUIRE( faces_nodes.dimension( 0 ) ==
+                 faces_node_normals.dimension( 0 ) );
+    DTK_REQUIRE( faces_nodes.dimension( 1 ) ==
+                 faces_node_normals.dimension( 1 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == faces_nodes.dimension( 2 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == faces_node_normals.dimension( 2 ) );
+    DTK_REQUIRE( Teuchos::as<unsigned>( faces_nodes.dimension( 1 ) ) ==
+                 face_topology.getNodeCount() );
+    DTK_REQUIRE( project.size() == faces_nodes.dimension( 0 ) );
+    DTK_REQUIRE( faces_nodes.dimension( 0 ) ==
+                 parametric_points.dimension( 0 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == parametric_points.dimension( 1 ) );
+    DTK_REQUIRE( faces_nodes.dimension( 0 ) ==
+                 physical_points.dimension( 0 ) );
+    DTK_REQUIRE( point.dimension( 0 ) == physical_points.dimension( 1 ) );
+    DTK_REQUIRE( face_edge_ids.size() == faces_nodes.dimension( 0 ) );
+    DTK_REQUIRE( face_node_ids.size() == faces_nodes.dimension( 0 ) );
+
+    // Get dimensions.
+    int num_faces = faces_nodes.dimension( 0 );
+    int num_nodes = faces_nodes.dimension( 1 );
+    int space_dim = point.dimension( 0 );
+    int topo_dim = face_topology.getDimension();
+    std::fill( face_edge_ids.begin(), face_edge_ids.end(), -1 );
+    std::fill( face_node_ids.begin(), face_node_ids.end(), -1 );
+    if ( std::count( project.begin(), project.end(), 0 ) == num_faces )
     {
-        if ( ( -1.0 == parametric_point( 0, 0 ) ) &&
-             ( -1.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 0;
-        }
-        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
-                  ( -1.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 1;
-        }
-        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
-                  ( 1.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 2;
-        }
-        else if ( ( -1.0 == parametric_point( 0, 0 ) ) &&
-                  ( 1.0 == parametric_point( 0, 1 ) ) )
-        {
-            face_node_id = 3;
-        }
-        else if ( -1.0 == parametric_point( 0, 1 ) )
-        {
-            face_edge_id = 0;
-        }
-        else if ( 1.0 == parametric_point( 0, 0 ) )
-        {
-            face_edge_id = 1;
-        }
-        else if ( 1.0 == parametric_point( 0, 1 ) )
+        return;
+    }
+
+    // Get the solver parameters.
+    double geometric_tolerance =
+        parameters.get<double>( "Geometric Tolerance" );
+    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    int max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
+
+    // Get the basis functions for the face cell topology.
+    Teuchos::RCP<Intrepid::Basis<double, Intrepid::FieldContainer<double>>>
+        face_basis = IntrepidBasisFactory::create( face_topology );
+
+    // Get the center of the face for the initial guess.
+    Intrepid::FieldContainer<double> face_center( 1, topo_dim );
+    referenceCellCenter( face_topology, face_center );
+
+    // Build the nonlinear problem data once for the point. The face work
+    // arrays are filled and set in the problem for each candidate.
+    Intrepid::FieldContainer<double> face_nodes( num_nodes, space_dim );
+    Intrepid::FieldContainer<double> face_node_normals( num_nodes, space_dim );
+    ProjectPointToFaceNonlinearProblem nonlinear_problem(
+        face_basis, point, face_nodes, face_node_normals );
+
+    // Project onto each face.
+    Intrepid::FieldContainer<double> parametric_point( 1, space_dim );
+    Intrepid::FieldContainer<double> physical_point( space_dim );
+    for ( int f = 0; f < num_faces; ++f )
+    {
+        if ( !project[f] )
         {
-            face_edge_id = 2;
+            continue;
         }
-        else if ( -1.0 == parametric_point( 0, 0 ) )
+
+        for ( int n = 0; n < num_nodes; ++n )
         {
-            face_edge_id = 3;
-        }
-    }
-    // Unsupported case.
-    else
-    {
-        DTK_INSIST(
-            ( shards::Triangle<3>::key == face_topology.getKey() ) ||
-            ( shards::Triangle<4>::key == face_topology.getKey() ) ||
-            ( shards::Triangle<6>::key == face_topology.getKey() ) ||
-            ( shards::Quadrilateral<4>::key == face_topology.getKey() ) ||
-            ( shards::Quadrilateral<8>::key == face_topology.getKey() ) ||
-            ( shards::Quadrilateral<9>::key == face_topology.getKey() ) );
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                face_nodes( n, d ) = faces_nodes( f, n, d );
+                face_node_normals( n, d ) = faces_node_normals( f, n, d );
+            }
+        }
+        nonlinear_problem.setFace( face_nodes, face_node_normals );
+
+        solvePointToFaceProjection(
+            geometric_tolerance, newton_tolerance, max_newton_iters,
+            face_center, face_topology, nonlinear_problem, parametric_point,
+            physical_point, face_edge_ids[f], face_node_ids[f] );
+
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            parametric_points( f, d ) = parametric_point( 0, d );
+            physical_points( f, d ) = physical_point( d );
+        }
     }
 }
 
@@ -551,59 +779,55 @@ bool ProjectionPrimitives::projectPointFeatureToEdgeFeature(
         return false;
     }
 
-    // Build the binormals.
-    Intrepid::FieldContainer<double> gvec( space_dim );
-    for ( int d = 0; d < space_dim; ++d )
+    // Build the binormals. The edge is in 3 dimensions so the work vectors
+    // have a fixed size.
+    DTK_CHECK( 3 == space_dim );
+    std::array<double, 3> gvec;
+    for ( int d = 0; d < 3; ++d )
     {
-        gvec( d ) = edge_nodes( 1, d ) - edge_nodes( 0, d );
+        gvec[d] = edge_nodes( 1, d ) - edge_nodes( 0, d );
     }
-    Intrepid::FieldContainer<double> normal( space_dim );
-    Intrepid::FieldContainer<double> l( space_dim );
-    Intrepid::FieldContainer<double> edge_node_binormals(
-        edge_node_normals.dimension( 0 ), edge_node_normals.dimension( 1 ) );
+    std::array<double, 3> normal;
+    std::array<std::array<double, 3>, 2> edge_node_binormals;
     for ( int n = 0; n < 2; ++n )
     {
-        for ( int d = 0; d < space_dim; ++d )
-        {
-            normal( d ) = edge_node_normals( n, d );
-        }
-        Intrepid::RealSpaceTools<double>::vecprod( l, normal, gvec );
-        for ( int d = 0; d < space_dim; ++d )
+        for ( int d = 0; d < 3; ++d )
         {
-            edge_node_binormals( n, d ) = l( d );
+            normal[d] = edge_node_normals( n, d );
         }
+        std::array<double, 3> &l = edge_node_binormals[n];
+        l[0] = normal[1] * gvec[2] - normal[2] * gvec[1];
+        l[1] = normal[2] * gvec[0] - normal[0] * gvec[2];
+        l[2] = normal[0] * gvec[1] - normal[1] * gvec[0];
     }
 
-    // Allocate unknown vector.
-    int num_points = 1;
-    Intrepid::FieldContainer<double> u( num_points, space_dim );
+    typedef FixedNewtonSolver<ProjectPointFeatureToEdgeFeatureNonlinearProblem,
+                              3>
+        Solver;
 
     // Set the initial solution guess to 0.5.
-    for ( int n = 0; n < space_dim; ++n )
-    {
-        u( 0, n ) = 0.5;
-    }
+    Solver::Vector u;
+    u.fill( 0.5 );
 
     // Build the nonlinear problem data.
     ProjectPointFeatureToEdgeFeatureNonlinearProblem nonlinear_problem(
         point, edge_nodes, edge_node_normals, edge_node_binormals );
 
     // Solve the nonlinear problem.
-    NewtonSolver<ProjectPointFeatureToEdgeFeatureNonlinearProblem>::solve(
-        u, nonlinear_problem, newton_tolerance, max_newton_iters );
+    Solver::solve( u, nonlinear_problem, newton_tolerance, max_newton_iters );
 
     // Apply tolerancing.
-    if ( std::abs( u( 0, 0 ) ) < geometric_tolerance )
+    if ( std::abs( u[0] ) < geometric_tolerance )
     {
-        u( 0, 0 ) = 0.0;
+        u[0] = 0.0;
     }
-    else if ( std::abs( 1.0 - u( 0, 0 ) ) < geometric_tolerance )
+    else if ( std::abs( 1.0 - u[0] ) < geometric_tolerance )
     {
-        u( 0, 0 ) = 1.0;
+        u[0] = 1.0;
     }
 
     // See if the solution was outside the parameteric bounds of the edge.
-    if ( 0.0 > u( 0, 0 ) || 1.0 < u( 0, 0 ) )
+    if ( 0.0 > u[0] || 1.0 < u[0] )
     {
         return false;
     }
@@ -612,17 +836,17 @@ bool ProjectionPrimitives::projectPointFeatureToEdgeFeature(
     // space.
     for ( int d = 0; d < space_dim; ++d )
     {
-        projected_point( d ) = edge_nodes( 0, d ) + u( 0, 0 ) * gvec( d );
+        projected_point( d ) = edge_nodes( 0, d ) + u[0] * gvec[d];
     }
 
     // Check to see if the point projected onto one of the vertices of the
     // edge.
     edge_node_id = -1;
-    if ( u( 0, 0 ) == 0.0 )
+    if ( u[0] == 0.0 )
     {
         edge_node_id = 0;
     }
-    else if ( u( 0, 0 ) == 1.0 )
+    else if ( u[0] == 1.0 )
     {
         edge_node_id = 1;
     }
@@ -989,74 +1213,362 @@ bool ProjectionPrimitives::edgeEdgeIntersection(
 // PRIVATE IMPLEMENTATION
 //---------------------------------------------------------------------------//
 /*!
- * \brief Compute the distance of a projected point onto a bilinear surface
- * formed by a face edge and its normals.
+ * \brief Build the bilinear surface problems formed by each face edge and its
+ * node normals.
  *
- * \param parameters Intersection parameters.
+ * If the problems were already built for a face with the same number of
+ * edges they are reset in place instead of being rebuilt.
  *
  * \param point Point coordinates (Dim).
  *
- * \param face_edge_nodes Face node edge coordinates (Node,Dim).
+ * \param face_nodes Face node coordinates (Node,Dim).
+ *
+ * \param face_node_normals Normal vectors for each face node (Node,Dim).
  *
- * \param face_edge_node_normals Normal vectors for each face edge node
- * (Node,Dim).
+ * \param edge_problems The surface problem for each face edge (Edge).
  */
-typename Intrepid::FieldContainer<double>::scalar_type
-ProjectionPrimitives::distanceToFaceBilinearSurface(
-    const Teuchos::ParameterList &parameters,
+void ProjectionPrimitives::buildFaceEdgeProblems(
     const Intrepid::FieldContainer<double> &point,
-    const Intrepid::FieldContainer<double> &face_edge_nodes,
-    const Intrepid::FieldContainer<double> &face_edge_node_normals )
+    const Intrepid::FieldContainer<double> &face_nodes,
+    const Intrepid::FieldContainer<double> &face_node_normals,
+    Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem>
+        &edge_problems )
 {
-    // Get the geometric tolerance.
-    double geometric_tolerance =
-        parameters.get<double>( "Geometric Tolerance" );
+    int space_dim = point.dimension( 0 );
+    int face_num_edges = face_nodes.dimension( 0 );
+    DTK_CHECK( 3 == space_dim );
 
-    // Get the newton tolerance.
-    double newton_tolerance = parameters.get<double>( "Newton Tolerance" );
+    bool reuse = ( face_num_edges == edge_problems.size() );
+    if ( !reuse )
+    {
+        edge_problems.clear();
+        edge_problems.reserve( face_num_edges );
+    }
+    Intrepid::FieldContainer<double> face_edge_nodes( 2, space_dim );
+    Intrepid::FieldContainer<double> face_edge_node_normals( 2, space_dim );
+    for ( int e = 0; e < face_num_edges; ++e )
+    {
+        // The last edge wraps back around to the first node.
+        int e1 = ( e + 1 ) % face_num_edges;
+        for ( int i = 0; i < space_dim; ++i )
+        {
+            face_edge_nodes( 0, i ) = face_nodes( e, i );
+            face_edge_nodes( 1, i ) = face_nodes( e1, i );
+            face_edge_node_normals( 0, i ) = face_node_normals( e, i );
+            face_edge_node_normals( 1, i ) = face_node_normals( e1, i );
+        }
 
-    // Get the max newton iterations.
-    double max_newton_iters = parameters.get<int>( "Max Newton Iterations" );
+        // Compute the scale factor. Choose half the length of the face for
+        // simplicity.
+        double xdist = face_edge_nodes( 1, 0 ) - face_edge_nodes( 0, 0 );
+        double ydist = face_edge_nodes( 1, 1 ) - face_edge_nodes( 0, 1 );
+        double zdist = face_edge_nodes( 1, 2 ) - face_edge_nodes( 0, 2 );
+        double c =
+            0.5 * std::sqrt( xdist * xdist + ydist * ydist + zdist * zdist );
+
+        if ( reuse )
+        {
+            edge_problems[e].setFaceEdge( face_edge_nodes,
+                                          face_edge_node_normals, c );
+            edge_problems[e].setPoint( point );
+        }
+        else
+        {
+            edge_problems.push_back(
+                PointInFaceVolumeOfInfluenceNonlinearProblem(
+                    point, face_edge_nodes, face_edge_node_normals, c ) );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Determine if the point currently set in the face edge problems is
+ * within the volume of influence of the face.
+ *
+ * The point must be to the left of every edge surface so the check stops at
+ * the first edge that rejects it. The search starts at the given edge and the
+ * rejecting edge is returned so callers can start the next point there.
+ *
+ * \param edge_problems The surface problem for each face edge (Edge).
+ *
+ * \param rejecting_edge On input the first edge to check. On output the edge
+ * that rejected the point if it is not in the volume of influence.
+ *
+ * \return True if the point is in the volume of influence of the face.
+ */
+bool ProjectionPrimitives::pointInFaceEdgeProblems(
+    const double geometric_tolerance, const double newton_tolerance,
+    const int max_newton_iters,
+    Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem>
+        &edge_problems,
+    int &rejecting_edge )
+{
+    DTK_REQUIRE( 0 <= rejecting_edge );
+    DTK_REQUIRE( rejecting_edge < edge_problems.size() );
 
-    // Compute the scale factor. Choose half the length of the face for
-    // simplicity.
-    double xdist = face_edge_nodes( 1, 0 ) - face_edge_nodes( 0, 0 );
-    double ydist = face_edge_nodes( 1, 1 ) - face_edge_nodes( 0, 1 );
-    double zdist = face_edge_nodes( 1, 2 ) - face_edge_nodes( 0, 2 );
-    double c = 0.5 * std::sqrt( xdist * xdist + ydist * ydist + zdist * zdist );
+    int face_num_edges = edge_problems.size();
+    double distance_to_surface = 0.0;
+    for ( int n = 0; n < face_num_edges; ++n )
+    {
+        int e = ( rejecting_edge + n ) % face_num_edges;
+        distance_to_surface = distanceToFaceBilinearSurface(
+            geometric_tolerance, newton_tolerance, max_newton_iters,
+            edge_problems[e] );
+        if ( distance_to_surface > geometric_tolerance )
+        {
+            rejecting_edge = e;
+            return false;
+        }
+    }
+
+    // If we got here then the point is in the volume of influence of the
+    // face as it was to the left of all bilinear surfaces formed by the
+    // edges and their node normals.
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the distance of a projected point onto a bilinear surface
+ * formed by a face edge and its normals.
+ *
+ * \param geometric_tolerance Geometric tolerance.
+ *
+ * \param newton_tolerance Newton convergence tolerance.
+ *
+ * \param max_newton_iters Maximum number of Newton iterations allowed.
+ *
+ * \param nonlinear_problem The surface problem for the face edge with the
+ * point to project already set.
+ */
+double ProjectionPrimitives::distanceToFaceBilinearSurface(
+    const double geometric_tolerance, const double newton_tolerance,
+    const int max_newton_iters,
+    PointInFaceVolumeOfInfluenceNonlinearProblem &nonlinear_problem )
+{
+    typedef FixedNewtonSolver<PointInFaceVolumeOfInfluenceNonlinearProblem, 3>
+        Solver;
+    DTK_CHECK( 3 == nonlinear_problem.d_space_dim );
 
     // Get the distance to the bilinear surface.
-    Intrepid::FieldContainer<double> u( 1, point.dimension( 0 ) );
-    u( 0, 0 ) = 0.5;
-    u( 0, 1 ) = 0.5;
-    u( 0, 2 ) = Teuchos::ScalarTraits<double>::zero();
-    PointInFaceVolumeOfInfluenceNonlinearProblem nonlinear_problem(
-        point, face_edge_nodes, face_edge_node_normals, c );
-    NewtonSolver<PointInFaceVolumeOfInfluenceNonlinearProblem>::solve(
-        u, nonlinear_problem, newton_tolerance, max_newton_iters );
+    Solver::Vector u = {{0.5, 0.5, 0.0}};
+    Solver::solve( u, nonlinear_problem, newton_tolerance, max_newton_iters );
 
     // Check for degeneracy.
-    nonlinear_problem.updateState( u );
-    Intrepid::FieldContainer<double> v1( nonlinear_problem.d_space_dim );
-    Intrepid::FieldContainer<double> v2( nonlinear_problem.d_space_dim );
-    for ( int i = 0; i < nonlinear_problem.d_space_dim; ++i )
+    nonlinear_problem.updateState( u.data() );
+    double v1_dot_v2 = 0.0;
+    for ( int i = 0; i < 3; ++i )
     {
-        v1( i ) = nonlinear_problem.d_face_edge_nodes( 1, i ) -
-                  nonlinear_problem.d_face_edge_nodes( 0, i );
-        v2( i ) = v1( i ) +
-                  nonlinear_problem.d_c * u( 0, 1 ) *
-                      ( nonlinear_problem.d_face_edge_node_normals( 1, i ) -
-                        nonlinear_problem.d_face_edge_node_normals( 0, i ) );
+        double v1 = nonlinear_problem.d_face_edge_nodes( 1, i ) -
+                    nonlinear_problem.d_face_edge_nodes( 0, i );
+        double v2 = v1 +
+                    nonlinear_problem.d_c * u[1] *
+                        ( nonlinear_problem.d_face_edge_node_normals( 1, i ) -
+                          nonlinear_problem.d_face_edge_node_normals( 0, i ) );
+        v1_dot_v2 += v1 * v2;
     }
 
     // Return a positive number if degenerate.
-    if ( Intrepid::RealSpaceTools<double>::dot( v1, v2 ) < geometric_tolerance )
+    if ( v1_dot_v2 < geometric_tolerance )
     {
         return 1.0;
     }
 
     // Return the solution if not degenerate.
-    return u( 0, 2 );
+    return u[2];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Solve the projection of the point currently set in the nonlinear
+ * problem onto its face.
+ *
+ * \param face_center The reference center of the face used as the initial
+ * guess (1,TopoDim).
+ *
+ * \param face_topology Cell topology of the face.
+ *
+ * \param nonlinear_problem The face projection problem with the point to
+ * project already set.
+ *
+ * \param parametric_point Projected point in parametric coordinates (1,Dim).
+ *
+ * \param physical_point Projected point in physical coordinates (Dim).
+ *
+ * \param face_edge_id The local id of the face edge onto which the point
+ * projected or -1.
+ *
+ * \param face_node_id The local id of the face node onto which the point
+ * projected or -1.
+ */
+void ProjectionPrimitives::solvePointToFaceProjection(
+    const double geometric_tolerance, const double newton_tolerance,
+    const int max_newton_iters,
+    const Intrepid::FieldContainer<double> &face_center,
+    const shards::CellTopology &face_topology,
+    ProjectPointToFaceNonlinearProblem &nonlinear_problem,
+    Intrepid::FieldContainer<double> &parametric_point,
+    Intrepid::FieldContainer<double> &physical_point, int &face_edge_id,
+    int &face_node_id )
+{
+    typedef FixedNewtonSolver<ProjectPointToFaceNonlinearProblem, 3> Solver;
+    int space_dim = nonlinear_problem.d_space_dim;
+    int topo_dim = face_topology.getDimension();
+    DTK_CHECK( 3 == space_dim );
+
+    // Set the initial solution guess to the center of the cell for the
+    // parametric coordinates and 0 for distance.
+    Solver::Vector u;
+    for ( int n = 0; n < topo_dim; ++n )
+    {
+        u[n] = face_center( 0, n );
+    }
+    u[topo_dim] = Teuchos::ScalarTraits<double>::zero();
+
+    // Solve the nonlinear problem.
+    Solver::solve( u, nonlinear_problem, newton_tolerance, max_newton_iters );
+    for ( int n = 0; n < space_dim; ++n )
+    {
+        parametric_point( 0, n ) = u[n];
+    }
+    // Apply tolerancing. If the point projected near a face edge or
+    // node within the tolerance, move it to that point.
+    if ( std::abs( parametric_point( 0, 0 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 0 ) = 0.0;
+    }
+    else if ( std::abs( 1.0 - parametric_point( 0, 0 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 0 ) = 1.0;
+    }
+    else if ( std::abs( 1.0 + parametric_point( 0, 0 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 0 ) = -1.0;
+    }
+    if ( std::abs( parametric_point( 0, 1 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 1 ) = 0.0;
+    }
+    else if ( std::abs( 1.0 - parametric_point( 0, 1 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 1 ) = 1.0;
+    }
+    else if ( std::abs( 1.0 + parametric_point( 0, 1 ) ) < geometric_tolerance )
+    {
+        parametric_point( 0, 1 ) = -1.0;
+    }
+    // This case is for the diagonal of the triangle reference geometry.
+    if ( std::abs( 1.0 - parametric_point( 0, 0 ) - parametric_point( 0, 1 ) ) <
+         geometric_tolerance )
+    {
+        parametric_point( 0, 0 ) = 1.0 - parametric_point( 0, 1 );
+    }
+
+    // Compute the physical coordinates from the projection in the reference
+    // space.
+    nonlinear_problem.updateState( parametric_point );
+    for ( int d = 0; d < space_dim; ++d )
+    {
+        physical_point( d ) = 0.0;
+        for ( int n = 0; n < nonlinear_problem.d_cardinality; ++n )
+        {
+            physical_point( d ) +=
+                nonlinear_problem.d_basis_evals( n, 0 ) *
+                nonlinear_problem.d_face_nodes( n, d );
+        }
+    }
+
+    // Determine if the point projected onto any of the face nodes or edges.
+    face_edge_id = -1;
+    face_node_id = -1;
+
+    // Triangle case.
+    if ( ( shards::Triangle<3>::key == face_topology.getKey() ) ||
+         ( shards::Triangle<4>::key == face_topology.getKey() ) ||
+         ( shards::Triangle<6>::key == face_topology.getKey() ) )
+    {
+        if ( ( 0.0 == parametric_point( 0, 0 ) ) &&
+             ( 0.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 0;
+        }
+        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
+                  ( 0.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 1;
+        }
+        else if ( ( 0.0 == parametric_point( 0, 0 ) ) &&
+                  ( 1.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 2;
+        }
+        else if ( 0.0 == parametric_point( 0, 1 ) )
+        {
+            face_edge_id = 0;
+        }
+        else if ( 1.0 == parametric_point( 0, 0 ) + parametric_point( 0, 1 ) )
+        {
+            face_edge_id = 1;
+        }
+        else if ( 0.0 == parametric_point( 0, 0 ) )
+        {
+            face_edge_id = 2;
+        }
+    }
+    // Quadrilateral case.
+    else if ( ( shards::Quadrilateral<4>::key == face_topology.getKey() ) ||
+              ( shards::Quadrilateral<8>::key == face_topology.getKey() ) ||
+              ( shards::Quadrilateral<9>::key == face_topology.getKey() ) )
+    {
+        if ( ( -1.0 == parametric_point( 0, 0 ) ) &&
+             ( -1.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 0;
+        }
+        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
+                  ( -1.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 1;
+        }
+        else if ( ( 1.0 == parametric_point( 0, 0 ) ) &&
+                  ( 1.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 2;
+        }
+        else if ( ( -1.0 == parametric_point( 0, 0 ) ) &&
+                  ( 1.0 == parametric_point( 0, 1 ) ) )
+        {
+            face_node_id = 3;
+        }
+        else if ( -1.0 == parametric_point( 0, 1 ) )
+        {
+            face_edge_id = 0;
+        }
+        else if ( 1.0 == parametric_point( 0, 0 ) )
+        {
+            face_edge_id = 1;
+        }
+        else if ( 1.0 == parametric_point( 0, 1 ) )
+        {
+            face_edge_id = 2;
+        }
+        else if ( -1.0 == parametric_point( 0, 0 ) )
+        {
+            face_edge_id = 3;
+        }
+    }
+    // Unsupported case.
+    else
+    {
+        DTK_INSIST(
+            ( shards::Triangle<3>::key == face_topology.getKey() ) ||
+            ( shards::Triangle<4>::key == face_topology.getKey() ) ||
+            ( shards::Triangle<6>::key == face_topology.getKey() ) ||
+            ( shards::Quadrilateral<4>::key == face_topology.getKey() ) ||
+            ( shards::Quadrilateral<8>::key == face_topology.getKey() ) ||
+            ( shards::Quadrilateral<9>::key == face_topology.getKey() ) );
+    }
 }
 
 //---------------------------------------------------------------------------//
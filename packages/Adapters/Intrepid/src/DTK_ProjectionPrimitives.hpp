@@ -45,6 +45,8 @@
 
 #include "DTK_DBC.hpp"
 
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
 #include <Teuchos_ParameterList.hpp>
 
 #include <Shards_CellTopology.hpp>
@@ -54,6 +56,9 @@
 
 namespace DataTransferKit
 {
+class ProjectPointToFaceNonlinearProblem;
+class PointInFaceVolumeOfInfluenceNonlinearProblem;
+
 //---------------------------------------------------------------------------//
 /*!
  * \class ProjectionPrimitives
@@ -75,6 +80,26 @@ class ProjectionPrimitives
         const Intrepid::FieldContainer<double> &face_node_normals,
         const shards::CellTopology &face_topology );
 
+    // Determine if each of a set of points is within the volume of influence
+    // of a single face.
+    static void pointsInFaceVolumeOfInfluence(
+        const Teuchos::ParameterList &parameters,
+        const Intrepid::FieldContainer<double> &points,
+        const Intrepid::FieldContainer<double> &face_nodes,
+        const Intrepid::FieldContainer<double> &face_node_normals,
+        const shards::CellTopology &face_topology,
+        const Teuchos::ArrayView<int> &in_volume );
+
+    // Determine if a point is within the volume of influence of each of a set
+    // of candidate faces of the same topology.
+    static void pointInFacesVolumeOfInfluence(
+        const Teuchos::ParameterList &parameters,
+        const Intrepid::FieldContainer<double> &point,
+        const Intrepid::FieldContainer<double> &faces_nodes,
+        const Intrepid::FieldContainer<double> &faces_node_normals,
+        const shards::CellTopology &face_topology,
+        const Teuchos::ArrayView<int> &in_volume );
+
     // Project a point onto a face and return the physical and parametric
     // coordinates of the projected point on that face. This
     // requires the solution of a nonlinear parameterized projection problem.
@@ -88,6 +113,34 @@ class ProjectionPrimitives
         Intrepid::FieldContainer<double> &physical_point, int &face_edge_id,
         int &face_node_id );
 
+    // Project a set of points onto a single face and return the physical and
+    // parametric coordinates of each projected point on that face.
+    static void projectPointsToFace(
+        const Teuchos::ParameterList &parameters,
+        const Intrepid::FieldContainer<double> &points,
+        const Intrepid::FieldContainer<double> &face_nodes,
+        const Intrepid::FieldContainer<double> &face_node_normals,
+        const shards::CellTopology &face_topology,
+        Intrepid::FieldContainer<double> &parametric_points,
+        Intrepid::FieldContainer<double> &physical_points,
+        const Teuchos::ArrayView<int> &face_edge_ids,
+        const Teuchos::ArrayView<int> &face_node_ids );
+
+    // Project a point onto each of a set of candidate faces of the same
+    // topology and return the physical and parametric coordinates of the
+    // projected point on each face.
+    static void projectPointToFaces(
+        const Teuchos::ParameterList &parameters,
+        const Intrepid::FieldContainer<double> &point,
+        const Intrepid::FieldContainer<double> &faces_nodes,
+        const Intrepid::FieldContainer<double> &faces_node_normals,
+        const shards::CellTopology &face_topology,
+        const Teuchos::ArrayView<const int> &project,
+        Intrepid::FieldContainer<double> &parametric_points,
+        Intrepid::FieldContainer<double> &physical_points,
+        const Teuchos::ArrayView<int> &face_edge_ids,
+        const Teuchos::ArrayView<int> &face_node_ids );
+
     // Project a feature point to a feature edge.
     static bool projectPointFeatureToEdgeFeature(
         const Teuchos::ParameterList &parameters,
@@ -109,13 +162,42 @@ class ProjectionPrimitives
         int &edge_1_node_id, int &edge_2_node_id );
 
   private:
+    // Build the bilinear surface problems formed by each face edge and its
+    // node normals.
+    static void buildFaceEdgeProblems(
+        const Intrepid::FieldContainer<double> &point,
+        const Intrepid::FieldContainer<double> &face_nodes,
+        const Intrepid::FieldContainer<double> &face_node_normals,
+        Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem>
+            &edge_problems );
+
+    // Determine if the point currently set in the face edge problems is
+    // within the volume of influence of the face.
+    static bool pointInFaceEdgeProblems(
+        const double geometric_tolerance, const double newton_tolerance,
+        const int max_newton_iters,
+        Teuchos::Array<PointInFaceVolumeOfInfluenceNonlinearProblem>
+            &edge_problems,
+        int &rejecting_edge );
+
     // Compute the distance of a projected point onto a bilinear surface
     // formed by a face edge and its normals.
     static double distanceToFaceBilinearSurface(
-        const Teuchos::ParameterList &parameters,
-        const Intrepid::FieldContainer<double> &point,
-        const Intrepid::FieldContainer<double> &face_edge_nodes,
-        const Intrepid::FieldContainer<double> &face_edge_node_normals );
+        const double geometric_tolerance, const double newton_tolerance,
+        const int max_newton_iters,
+        PointInFaceVolumeOfInfluenceNonlinearProblem &nonlinear_problem );
+
+    // Solve the projection of the point currently set in the nonlinear
+    // problem onto its face.
+    static void solvePointToFaceProjection(
+        const double geometric_tolerance, const double newton_tolerance,
+        const int max_newton_iters,
+        const Intrepid::FieldContainer<double> &face_center,
+        const shards::CellTopology &face_topology,
+        ProjectPointToFaceNonlinearProblem &nonlinear_problem,
+        Intrepid::FieldContainer<double> &parametric_point,
+        Intrepid::FieldContainer<double> &physical_point, int &face_edge_id,
+        int &face_node_id );
 };
 
 //---------------------------------------------------------------------------//
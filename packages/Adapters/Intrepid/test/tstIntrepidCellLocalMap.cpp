@@ -46,6 +46,7 @@
 
 #include <Teuchos_Comm.hpp>
 #include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
 
@@ -225,6 +226,68 @@ TEUCHOS_UNIT_TEST( IntrepidCellLocalMap, element_single_cell_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( IntrepidCellLocalMap, candidate_faces_test )
+{
+    Teuchos::ParameterList parameters;
+    parameters.set<int>( "Max Newton Iterations", 1000 );
+    parameters.set<double>( "Newton Tolerance", 1.0e-9 );
+    parameters.set<double>( "Geometric Tolerance", 1.0e-6 );
+
+    // Build three unit normal quad faces. The second face is shifted away
+    // from the point and the third face is shifted along its normal.
+    int num_faces = 3;
+    int num_nodes = 4;
+    int space_dim = 3;
+    shards::CellTopology face_topo =
+        shards::getCellTopologyData<shards::Quadrilateral<4>>();
+    double node_coords[4][2] = {
+        {-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+    double face_shifts[3][3] = {
+        {0.0, 0.0, 0.0}, {3.0, 0.0, 0.0}, {0.0, 0.0, 0.5}};
+    Intrepid::FieldContainer<double> faces_coords( num_faces, num_nodes,
+                                                   space_dim );
+    Intrepid::FieldContainer<double> faces_node_normals( num_faces, num_nodes,
+                                                         space_dim );
+    for ( int f = 0; f < num_faces; ++f )
+    {
+        for ( int n = 0; n < num_nodes; ++n )
+        {
+            faces_coords( f, n, 0 ) = node_coords[n][0] + face_shifts[f][0];
+            faces_coords( f, n, 1 ) = node_coords[n][1] + face_shifts[f][1];
+            faces_coords( f, n, 2 ) = face_shifts[f][2];
+            faces_node_normals( f, n, 0 ) = 0.0;
+            faces_node_normals( f, n, 1 ) = 0.0;
+            faces_node_normals( f, n, 2 ) = 1.0;
+        }
+    }
+
+    // Map the point to the candidates.
+    Teuchos::Array<double> point( space_dim );
+    point[0] = 0.2;
+    point[1] = -0.34;
+    point[2] = 1.1;
+    Teuchos::Array<int> mapped_faces;
+    Teuchos::Array<double> reference_points;
+    DataTransferKit::IntrepidCellLocalMap::mapToCandidateFaces(
+        parameters, face_topo, faces_coords, faces_node_normals, point(),
+        mapped_faces, reference_points );
+
+    // The point projects onto the first and third faces at the same face
+    // coordinates.
+    TEST_EQUALITY( mapped_faces.size(), 2 );
+    TEST_EQUALITY( mapped_faces[0], 0 );
+    TEST_EQUALITY( mapped_faces[1], 2 );
+    TEST_EQUALITY( reference_points.size(), 2 * space_dim );
+    for ( int f = 0; f < 2; ++f )
+    {
+        TEST_FLOATING_EQUALITY( reference_points[f * space_dim], 0.2,
+                                1.0e-6 );
+        TEST_FLOATING_EQUALITY( reference_points[f * space_dim + 1], -0.34,
+                                1.0e-6 );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstIntrepidCellLocalMap.cpp
 //---------------------------------------------------------------------------//
@@ -41,10 +41,13 @@
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 
+#include <DTK_FixedNewtonSolver.hpp>
+#include <DTK_FixedNonlinearProblemTraits.hpp>
 #include <DTK_NewtonSolver.hpp>
 #include <DTK_NonlinearProblemTraits.hpp>
 
@@ -98,6 +101,16 @@ class ScalarNonlinearProblem
         J( 0, 0, 0 ) = 2.0 * u( 0, 0 ) + 1;
     }
 
+    void evaluateResidual( const scalar_type *u, scalar_type *F ) const
+    {
+        F[0] = u[0] * u[0] + u[0] - d_a;
+    }
+
+    void evaluateJacobian( const scalar_type *u, scalar_type *J ) const
+    {
+        J[0] = 2.0 * u[0] + 1;
+    }
+
   private:
     double d_a;
 };
@@ -132,6 +145,35 @@ class NonlinearProblemTraits<ScalarNonlinearProblem>
 };
 }
 
+// Fixed traits implementation.
+namespace DataTransferKit
+{
+template <>
+class FixedNonlinearProblemTraits<ScalarNonlinearProblem>
+{
+  public:
+    typedef ScalarNonlinearProblem nonlinear_problem_type;
+    typedef typename nonlinear_problem_type::scalar_type Scalar;
+
+    static inline void updateState( ScalarNonlinearProblem &problem,
+                                    const Scalar *u )
+    { /* ... */
+    }
+
+    static inline void evaluateResidual( const ScalarNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const ScalarNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+}
+
 //---------------------------------------------------------------------------//
 // Vector nonlinear problem. u_1^2 + u_2 = a, u_1*u_2^2 - u_1 = b
 //---------------------------------------------------------------------------//
@@ -163,6 +205,20 @@ class VectorNonlinearProblem
         J( 0, 1, 1 ) = 2.0 * u( 0, 0 ) * u( 0, 1 );
     }
 
+    void evaluateResidual( const scalar_type *u, scalar_type *F ) const
+    {
+        F[0] = u[0] * u[0] + u[1] - d_a;
+        F[1] = u[0] * ( u[1] * u[1] - 1.0 ) - d_b;
+    }
+
+    void evaluateJacobian( const scalar_type *u, scalar_type *J ) const
+    {
+        J[0] = 2.0 * u[0];
+        J[1] = 1.0;
+        J[2] = u[1] * u[1] - 1.0;
+        J[3] = 2.0 * u[0] * u[1];
+    }
+
   private:
     double d_a;
     double d_b;
@@ -198,6 +254,106 @@ class NonlinearProblemTraits<VectorNonlinearProblem>
 };
 }
 
+// Fixed traits implementation.
+namespace DataTransferKit
+{
+template <>
+class FixedNonlinearProblemTraits<VectorNonlinearProblem>
+{
+  public:
+    typedef VectorNonlinearProblem nonlinear_problem_type;
+    typedef typename nonlinear_problem_type::scalar_type Scalar;
+
+    static inline void updateState( VectorNonlinearProblem &problem,
+                                    const Scalar *u )
+    { /* ... */
+    }
+
+    static inline void evaluateResidual( const VectorNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const VectorNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+}
+
+//---------------------------------------------------------------------------//
+// 3D nonlinear problem. u_1^2 + u_2 + u_3 = a, u_1 + u_2^2 = b,
+// u_3^3 - u_1 = c
+//---------------------------------------------------------------------------//
+class ThreeDNonlinearProblem
+{
+  public:
+    typedef double scalar_type;
+
+    ThreeDNonlinearProblem( const double a, const double b, const double c )
+        : d_a( a )
+        , d_b( b )
+        , d_c( c )
+    { /* ... */
+    }
+
+    void evaluateResidual( const scalar_type *u, scalar_type *F ) const
+    {
+        F[0] = u[0] * u[0] + u[1] + u[2] - d_a;
+        F[1] = u[0] + u[1] * u[1] - d_b;
+        F[2] = u[2] * u[2] * u[2] - u[0] - d_c;
+    }
+
+    void evaluateJacobian( const scalar_type *u, scalar_type *J ) const
+    {
+        J[0] = 2.0 * u[0];
+        J[1] = 1.0;
+        J[2] = 1.0;
+        J[3] = 1.0;
+        J[4] = 2.0 * u[1];
+        J[5] = 0.0;
+        J[6] = -1.0;
+        J[7] = 0.0;
+        J[8] = 3.0 * u[2] * u[2];
+    }
+
+  private:
+    double d_a;
+    double d_b;
+    double d_c;
+};
+
+// Fixed traits implementation.
+namespace DataTransferKit
+{
+template <>
+class FixedNonlinearProblemTraits<ThreeDNonlinearProblem>
+{
+  public:
+    typedef ThreeDNonlinearProblem nonlinear_problem_type;
+    typedef typename nonlinear_problem_type::scalar_type Scalar;
+
+    static inline void updateState( ThreeDNonlinearProblem &problem,
+                                    const Scalar *u )
+    { /* ... */
+    }
+
+    static inline void evaluateResidual( const ThreeDNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *F )
+    {
+        problem.evaluateResidual( u, F );
+    }
+
+    static inline void evaluateJacobian( const ThreeDNonlinearProblem &problem,
+                                         const Scalar *u, Scalar *J )
+    {
+        problem.evaluateJacobian( u, J );
+    }
+};
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -267,6 +423,81 @@ TEUCHOS_UNIT_TEST( NewtonSolver, vector_test )
         u_3( 0, 0 ) * u_3( 0, 1 ) * u_3( 0, 1 ) - u_3( 0, 0 ), b_3, tolerance );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( NewtonSolver, fixed_scalar_test )
+{
+    typedef DataTransferKit::FixedNewtonSolver<ScalarNonlinearProblem, 1>
+        Solver;
+    double tolerance = 1.0e-12;
+    int max_iters = 10000;
+
+    double a[3] = {1.0, 1830.31, 0.0000231};
+    for ( int i = 0; i < 3; ++i )
+    {
+        ScalarNonlinearProblem problem( a[i] );
+        Solver::Vector u = {{0.0}};
+        Solver::solve( u, problem, tolerance, max_iters );
+        TEST_FLOATING_EQUALITY( u[0] * u[0] + u[0], a[i], tolerance );
+
+        // The fixed solver should agree with the general solver.
+        Intrepid::FieldContainer<double> u_general( 1, 1 );
+        DataTransferKit::NewtonSolver<ScalarNonlinearProblem>::solve(
+            u_general, problem, tolerance, max_iters );
+        TEST_FLOATING_EQUALITY( u[0], u_general( 0, 0 ), tolerance );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( NewtonSolver, fixed_vector_test )
+{
+    typedef DataTransferKit::FixedNewtonSolver<VectorNonlinearProblem, 2>
+        Solver;
+    double tolerance = 1.0e-12;
+    int max_iters = 10000;
+
+    double a[3] = {1.0, 483.20, 0.00322};
+    double b[3] = {1.0, 0.32, 1.987};
+    for ( int i = 0; i < 3; ++i )
+    {
+        VectorNonlinearProblem problem( a[i], b[i] );
+        Solver::Vector u = {{0.0, 0.0}};
+        Solver::solve( u, problem, tolerance, max_iters );
+        TEST_FLOATING_EQUALITY( u[0] * u[0] + u[1], a[i], tolerance );
+        TEST_FLOATING_EQUALITY( u[0] * u[1] * u[1] - u[0], b[i], tolerance );
+
+        // The fixed solver should agree with the general solver.
+        Intrepid::FieldContainer<double> u_general( 1, 2 );
+        DataTransferKit::NewtonSolver<VectorNonlinearProblem>::solve(
+            u_general, problem, tolerance, max_iters );
+        TEST_FLOATING_EQUALITY( u[0], u_general( 0, 0 ), tolerance );
+        TEST_FLOATING_EQUALITY( u[1], u_general( 0, 1 ), tolerance );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( NewtonSolver, fixed_3d_test )
+{
+    typedef DataTransferKit::FixedNewtonSolver<ThreeDNonlinearProblem, 3>
+        Solver;
+    double tolerance = 1.0e-12;
+    int max_iters = 100;
+
+    // The solution is u = (1, 2, 3).
+    ThreeDNonlinearProblem problem( 6.0, 5.0, 26.0 );
+    Solver::Vector u = {{1.5, 1.5, 2.5}};
+    Solver::solve( u, problem, tolerance, max_iters );
+    TEST_FLOATING_EQUALITY( u[0], 1.0, tolerance );
+    TEST_FLOATING_EQUALITY( u[1], 2.0, tolerance );
+    TEST_FLOATING_EQUALITY( u[2], 3.0, tolerance );
+
+    // A degenerate initial Jacobian gives no solution.
+    Solver::Vector u_degenerate = {{0.0, 0.0, 0.0}};
+    Solver::solve( u_degenerate, problem, tolerance, max_iters );
+    TEST_EQUALITY( u_degenerate[0], std::numeric_limits<double>::max() );
+    TEST_EQUALITY( u_degenerate[1], std::numeric_limits<double>::max() );
+    TEST_EQUALITY( u_degenerate[2], std::numeric_limits<double>::max() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstNewtonSolver.cpp
 //---------------------------------------------------------------------------//
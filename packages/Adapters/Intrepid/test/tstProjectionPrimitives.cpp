@@ -44,6 +44,7 @@
 #include <sstream>
 #include <vector>
 
+#include <Teuchos_Array.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
@@ -2365,6 +2366,133 @@ TEUCHOS_UNIT_TEST( ProjectionPrimitives, edge_edge_intersection_test_2 )
     TEST_ASSERT( !has_intersection );
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ProjectionPrimitives, quad_face_batched_test )
+{
+    Teuchos::ParameterList parameters = defaultParameters();
+
+    int elem_num_nodes = 4;
+    int space_dim = 3;
+    Intrepid::FieldContainer<double> side_nodes( elem_num_nodes, space_dim );
+    Intrepid::FieldContainer<double> side_node_normals( elem_num_nodes,
+                                                        space_dim );
+    shards::CellTopology side_topo =
+        shards::getCellTopologyData<shards::Quadrilateral<4>>();
+
+    double node_coords[4][2] = {
+        {-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+    for ( int n = 0; n < elem_num_nodes; ++n )
+    {
+        side_nodes( n, 0 ) = node_coords[n][0];
+        side_nodes( n, 1 ) = node_coords[n][1];
+        side_nodes( n, 2 ) = 0.0;
+        side_node_normals( n, 0 ) = 0.0;
+        side_node_normals( n, 1 ) = 0.0;
+        side_node_normals( n, 2 ) = 1.0;
+    }
+
+    // Points inside and outside of the face volume of influence including
+    // points on a node and an edge of the face.
+    int num_points = 6;
+    double point_coords[6][3] = {{0.2, -0.34, 1.1}, {2.2, -0.34, 1.1},
+                                 {-1.0, -1.0, 0.0}, {0.4, 1.0, -0.3},
+                                 {0.2, -2.34, 1.1}, {-0.1, 0.7, 0.5}};
+    Intrepid::FieldContainer<double> points( num_points, space_dim );
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            points( p, d ) = point_coords[p][d];
+        }
+    }
+
+    // Check the batched volume of influence against the single point
+    // version.
+    Teuchos::Array<int> in_volume( num_points, -1 );
+    DataTransferKit::ProjectionPrimitives::pointsInFaceVolumeOfInfluence(
+        parameters, points, side_nodes, side_node_normals, side_topo,
+        in_volume() );
+    Intrepid::FieldContainer<double> point( space_dim );
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            point( d ) = points( p, d );
+        }
+        bool single_in_volume =
+            DataTransferKit::ProjectionPrimitives::pointInFaceVolumeOfInfluence(
+                parameters, point, side_nodes, side_node_normals, side_topo );
+        TEST_EQUALITY( in_volume[p], single_in_volume ? 1 : 0 );
+    }
+    TEST_EQUALITY( in_volume[0], 1 );
+    TEST_EQUALITY( in_volume[1], 0 );
+    TEST_EQUALITY( in_volume[4], 0 );
+    TEST_EQUALITY( in_volume[5], 1 );
+
+    // Check one point against many faces. The second face is shifted away
+    // from the point.
+    int num_faces = 2;
+    Intrepid::FieldContainer<double> faces_nodes( num_faces, elem_num_nodes,
+                                                  space_dim );
+    Intrepid::FieldContainer<double> faces_node_normals(
+        num_faces, elem_num_nodes, space_dim );
+    for ( int f = 0; f < num_faces; ++f )
+    {
+        for ( int n = 0; n < elem_num_nodes; ++n )
+        {
+            for ( int d = 0; d < space_dim; ++d )
+            {
+                faces_nodes( f, n, d ) = side_nodes( n, d );
+                faces_node_normals( f, n, d ) = side_node_normals( n, d );
+            }
+            faces_nodes( f, n, 0 ) += 3.0 * f;
+        }
+    }
+    Teuchos::Array<int> face_in_volume( num_faces, -1 );
+    for ( int d = 0; d < space_dim; ++d )
+    {
+        point( d ) = points( 0, d );
+    }
+    DataTransferKit::ProjectionPrimitives::pointInFacesVolumeOfInfluence(
+        parameters, point, faces_nodes, faces_node_normals, side_topo,
+        face_in_volume() );
+    TEST_EQUALITY( face_in_volume[0], 1 );
+    TEST_EQUALITY( face_in_volume[1], 0 );
+
+    // Check the batched projection against the single point version.
+    Intrepid::FieldContainer<double> param_points( num_points, space_dim );
+    Intrepid::FieldContainer<double> proj_points( num_points, space_dim );
+    Teuchos::Array<int> edge_ids( num_points, 0 );
+    Teuchos::Array<int> node_ids( num_points, 0 );
+    DataTransferKit::ProjectionPrimitives::projectPointsToFace(
+        parameters, points, side_nodes, side_node_normals, side_topo,
+        param_points, proj_points, edge_ids(), node_ids() );
+
+    Intrepid::FieldContainer<double> proj_point( space_dim );
+    Intrepid::FieldContainer<double> param_point( 1, space_dim );
+    int edge_id = 0;
+    int node_id = 0;
+    for ( int p = 0; p < num_points; ++p )
+    {
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            point( d ) = points( p, d );
+        }
+        DataTransferKit::ProjectionPrimitives::projectPointToFace(
+            parameters, point, side_nodes, side_node_normals, side_topo,
+            param_point, proj_point, edge_id, node_id );
+        for ( int d = 0; d < space_dim; ++d )
+        {
+            TEST_EQUALITY( param_points( p, d ), param_point( 0, d ) );
+            TEST_EQUALITY( proj_points( p, d ), proj_point( d ) );
+        }
+        TEST_EQUALITY( edge_ids[p], edge_id );
+        TEST_EQUALITY( node_ids[p], node_id );
+    }
+    TEST_EQUALITY( node_ids[2], 0 );
+    TEST_EQUALITY( edge_ids[3], 2 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstProjectionPrimitives.cpp
 //---------------------------------------------------------------------------//
@@ -105,6 +105,23 @@ void STKMeshNodalShapeFunction::evaluateValue(
     d_intrepid_shape.evaluateValue( entity_topo, reference_point, values );
 }
 
+//---------------------------------------------------------------------------//
+// Given an entity and a set of reference points, evaluate the shape function
+// of the entity at all of the points at once.
+void STKMeshNodalShapeFunction::evaluateValues(
+    const Entity &entity,
+    const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+    Teuchos::Array<double> &values ) const
+{
+    const stk::mesh::Entity &stk_entity =
+        STKMeshHelpers::extractEntity( entity );
+
+    shards::CellTopology entity_topo = stk::mesh::get_cell_topology(
+        d_bulk_data->bucket( stk_entity ).topology() );
+
+    d_intrepid_shape.evaluateValues( entity_topo, reference_points, values );
+}
+
 //---------------------------------------------------------------------------//
 // Given an entity and a reference point, evaluate the gradient of the shape
 // function of the entity at that point.
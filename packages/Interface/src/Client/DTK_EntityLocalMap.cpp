@@ -92,6 +92,32 @@ bool EntityLocalMap::isSafeToMapToReferenceFrame(
     return ( in_x && in_y && in_z );
 }
 
+//---------------------------------------------------------------------------//
+// Locate a set of points in a set of entities. Default implementation
+// processes one pair at a time.
+void EntityLocalMap::locatePoints(
+    const Teuchos::ArrayView<const Entity> &entities,
+    const Teuchos::ArrayView<const double> &physical_points,
+    const Teuchos::ArrayView<double> &reference_points,
+    const Teuchos::ArrayView<int> &found ) const
+{
+    DTK_REQUIRE( physical_points.size() == reference_points.size() );
+    DTK_REQUIRE( entities.size() == found.size() );
+
+    int num_pairs = entities.size();
+    int space_dim = ( num_pairs > 0 ) ? physical_points.size() / num_pairs : 0;
+    for ( int p = 0; p < num_pairs; ++p )
+    {
+        Teuchos::ArrayView<const double> point =
+            physical_points( p * space_dim, space_dim );
+        Teuchos::ArrayView<double> ref_point =
+            reference_points( p * space_dim, space_dim );
+        found[p] = this->isSafeToMapToReferenceFrame( entities[p], point ) &&
+                   this->mapToReferenceFrame( entities[p], point, ref_point ) &&
+                   this->checkPointInclusion( entities[p], ref_point );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Compute the normal on a face (3D) or edge (2D) at a given reference point.
 void EntityLocalMap::normalAtReferencePoint(
@@ -174,6 +174,29 @@ class EntityLocalMap
         const Entity &entity,
         const Teuchos::ArrayView<const double> &reference_point ) const = 0;
 
+    /*!
+     * \brief Locate a set of points in a set of entities at once. Each point
+     * is paired with one entity and is safeguarded, mapped to the reference
+     * frame of its entity and checked for inclusion. A default
+     * implementation is provided that processes one pair at a time.
+     *
+     * \param entities The entity of each pair.
+     *
+     * \param physical_points The physical point of each pair. If there are P
+     * pairs of dimension D then this array is of size physical_points[P*D].
+     *
+     * \param reference_points An array of size reference_points[P*D] to write
+     * the reference coordinates of each mapped point.
+     *
+     * \param found An array of size P. Set to 1 if the point of a pair is in
+     * its entity and 0 if not.
+     */
+    virtual void
+    locatePoints( const Teuchos::ArrayView<const Entity> &entities,
+                  const Teuchos::ArrayView<const double> &physical_points,
+                  const Teuchos::ArrayView<double> &reference_points,
+                  const Teuchos::ArrayView<int> &found ) const;
+
     /*!
      * \brief (Forward Map) Map a reference point to the physical space of an
      * entity.
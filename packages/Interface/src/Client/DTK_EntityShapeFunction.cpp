@@ -38,7 +38,9 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
 
 #include "DTK_DBC.hpp"
@@ -54,6 +56,24 @@ EntityShapeFunction::EntityShapeFunction() { /* ... */}
 // Destructor.
 EntityShapeFunction::~EntityShapeFunction() { /* ... */}
 
+//---------------------------------------------------------------------------//
+// Evaluate the shape function at a set of points.
+void EntityShapeFunction::evaluateValues(
+    const Entity &entity,
+    const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+    Teuchos::Array<double> &values ) const
+{
+    int num_points = reference_points.size();
+    values.clear();
+    Teuchos::Array<double> point_values;
+    for ( int p = 0; p < num_points; ++p )
+    {
+        this->evaluateValue( entity, reference_points[p](), point_values );
+        std::copy( point_values.begin(), point_values.end(),
+                   std::back_inserter( values ) );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Evaluate the gradient of the shape function.
 void EntityShapeFunction::evaluateGradient(
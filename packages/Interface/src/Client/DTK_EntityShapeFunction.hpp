@@ -101,6 +101,27 @@ class EntityShapeFunction
                    const Teuchos::ArrayView<const double> &reference_point,
                    Teuchos::Array<double> &values ) const = 0;
 
+    /*!
+     * \brief Given an entity and a set of reference points, evaluate shape
+     * functions of the entity at all of the points at once. A default
+     * implementation is provided that evaluates one point at a time.
+     *
+     * \param entity Evaluate shape functions of this entity.
+     *
+     * \param reference_points Evaluate shape functions at these points
+     * given in reference coordinates. If there are P points of dimension D
+     * then this array is of size reference_points[P][D].
+     *
+     * \param values Entity shape functions evaluated at the reference
+     * points. If the entity has N support locations these are returned
+     * ordered such that values[p*N + n] gives the value of the shape
+     * function of the nth support location at the pth point.
+     */
+    virtual void evaluateValues(
+        const Entity &entity,
+        const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+        Teuchos::Array<double> &values ) const;
+
     /*!
      * \brief Given an entity and a reference point, evaluate the gradient of
      * the shape function of the entity at that point. A default
@@ -48,12 +48,14 @@
 #include "DTK_Types.hpp"
 
 #include <Teuchos_Array.hpp>
-#include <Teuchos_Ptr.hpp>
+#include <Teuchos_ArrayView.hpp>
 
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
-// IntegrationPoint container.
+// IntegrationPoint container. IntegrationPointSet stores its points in
+// contiguous arrays and only uses this container to add and extract single
+// points.
 //---------------------------------------------------------------------------//
 class IntegrationPoint
 {
@@ -85,9 +87,17 @@ class IntegrationPointEntityImpl : public EntityImpl
   public:
     /*!
      * \brief Constructor
+     *
+     * \param gid Global id of the integration point.
+     *
+     * \param physical_coordinates View of the physical coordinates of the
+     * point. The data must outlive the entity.
      */
-    IntegrationPointEntityImpl( const Teuchos::Ptr<IntegrationPoint> &ip )
-        : d_ip( ip )
+    IntegrationPointEntityImpl(
+        const EntityId gid,
+        const Teuchos::ArrayView<const double> &physical_coordinates )
+        : d_gid( gid )
+        , d_physical_coordinates( physical_coordinates )
     { /* ... */
     }
 
@@ -96,7 +106,7 @@ class IntegrationPointEntityImpl : public EntityImpl
      *
      * \return A unique global identifier for the entity.
      */
-    EntityId id() const override { return d_ip->d_gid; }
+    EntityId id() const override { return d_gid; }
 
     /*!
      * \brief Get the parallel rank that owns the entity.
@@ -121,7 +131,7 @@ class IntegrationPointEntityImpl : public EntityImpl
      */
     int physicalDimension() const override
     {
-        return d_ip->d_physical_coordinates.size();
+        return d_physical_coordinates.size();
     }
 
     /*!
@@ -134,8 +144,8 @@ class IntegrationPointEntityImpl : public EntityImpl
     {
         for ( int d = 0; d < physicalDimension(); ++d )
         {
-            bounds[d] = d_ip->d_physical_coordinates[d];
-            bounds[d + 3] = d_ip->d_physical_coordinates[d];
+            bounds[d] = d_physical_coordinates[d];
+            bounds[d + 3] = d_physical_coordinates[d];
         }
         for ( int d = physicalDimension(); d < 3; ++d )
         {
@@ -173,8 +183,11 @@ class IntegrationPointEntityImpl : public EntityImpl
     }
 
   private:
-    // Pointer to the underlying integration point.
-    Teuchos::Ptr<IntegrationPoint> d_ip;
+    // Global id of the integration point.
+    EntityId d_gid;
+
+    // Physical coordinates of the integration point.
+    Teuchos::ArrayView<const double> d_physical_coordinates;
 };
 
 //---------------------------------------------------------------------------//
@@ -183,10 +196,12 @@ class IntegrationPointEntityImpl : public EntityImpl
 class IntegrationPointEntity : public Entity
 {
   public:
-    IntegrationPointEntity( const Teuchos::Ptr<IntegrationPoint> &ip )
+    IntegrationPointEntity(
+        const EntityId gid,
+        const Teuchos::ArrayView<const double> &physical_coordinates )
     {
-        this->b_entity_impl =
-            Teuchos::rcp( new IntegrationPointEntityImpl( ip ) );
+        this->b_entity_impl = Teuchos::rcp(
+            new IntegrationPointEntityImpl( gid, physical_coordinates ) );
     }
 };
 
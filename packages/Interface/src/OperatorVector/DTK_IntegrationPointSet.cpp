@@ -38,27 +38,33 @@
  */
 //---------------------------------------------------------------------------//
 
-#include "DTK_IntegrationPointSet.hpp"
+#include <algorithm>
+#include <iterator>
+
 #include "DTK_DBC.hpp"
+#include "DTK_IntegrationPointSet.hpp"
+#include "DTK_Profiler.hpp"
 
 #include <Teuchos_CommHelpers.hpp>
 
-#include <Tpetra_Map.hpp>
-
 namespace DataTransferKit
 {
 //---------------------------------------------------------------------------//
 // IntegrationPointSetIterator implementation.
 //---------------------------------------------------------------------------//
 // Default constructor.
-IntegrationPointSetIterator::IntegrationPointSetIterator() { /* ... */}
+IntegrationPointSetIterator::IntegrationPointSetIterator()
+    : d_points( nullptr )
+    , d_lid( 0 )
+{ /* ... */
+}
 
 //---------------------------------------------------------------------------//
 // Constructor.
 IntegrationPointSetIterator::IntegrationPointSetIterator(
-    Teuchos::RCP<Teuchos::Array<IntegrationPoint>> points )
+    const IntegrationPointSet *points )
     : d_points( points )
-    , d_points_it( d_points->begin() )
+    , d_lid( 0 )
 { /* ... */
 }
 
@@ -67,7 +73,7 @@ IntegrationPointSetIterator::IntegrationPointSetIterator(
 IntegrationPointSetIterator::IntegrationPointSetIterator(
     const IntegrationPointSetIterator &rhs )
     : d_points( rhs.d_points )
-    , d_points_it( rhs.d_points_it )
+    , d_lid( rhs.d_lid )
 { /* ... */
 }
 
@@ -81,7 +87,7 @@ operator=( const IntegrationPointSetIterator &rhs )
         return *this;
     }
     d_points = rhs.d_points;
-    d_points_it = rhs.d_points_it;
+    d_lid = rhs.d_lid;
     return *this;
 }
 
@@ -89,7 +95,7 @@ operator=( const IntegrationPointSetIterator &rhs )
 // Pre-increment operator.
 EntityIterator &IntegrationPointSetIterator::operator++()
 {
-    ++d_points_it;
+    ++d_lid;
     return *this;
 }
 
@@ -106,7 +112,8 @@ Entity &IntegrationPointSetIterator::operator*( void )
 Entity *IntegrationPointSetIterator::operator->( void )
 {
     d_current_entity =
-        IntegrationPointEntity( Teuchos::ptrFromRef( *d_points_it ) );
+        IntegrationPointEntity( d_points->globalId( d_lid ),
+                                d_points->physicalCoordinates( d_lid ) );
     return &d_current_entity;
 }
 
@@ -119,7 +126,7 @@ bool IntegrationPointSetIterator::operator==( const EntityIterator &rhs ) const
     const IntegrationPointSetIterator *rhs_vec_impl =
         static_cast<const IntegrationPointSetIterator *>(
             rhs_vec->b_iterator_impl.get() );
-    return ( rhs_vec_impl->d_points_it == d_points_it );
+    return ( rhs_vec_impl->d_lid == d_lid );
 }
 
 //---------------------------------------------------------------------------//
@@ -131,7 +138,7 @@ bool IntegrationPointSetIterator::operator!=( const EntityIterator &rhs ) const
     const IntegrationPointSetIterator *rhs_vec_impl =
         static_cast<const IntegrationPointSetIterator *>(
             rhs_vec->b_iterator_impl.get() );
-    return ( rhs_vec_impl->d_points_it != d_points_it );
+    return ( rhs_vec_impl->d_lid != d_lid );
 }
 
 //---------------------------------------------------------------------------//
@@ -146,7 +153,7 @@ EntityIterator IntegrationPointSetIterator::begin() const
 EntityIterator IntegrationPointSetIterator::end() const
 {
     IntegrationPointSetIterator end_it( d_points );
-    end_it.d_points_it = d_points->end();
+    end_it.d_lid = d_points->numPoints();
     return end_it;
 }
 
@@ -166,58 +173,105 @@ std::unique_ptr<EntityIterator> IntegrationPointSetIterator::clone() const
 IntegrationPointSet::IntegrationPointSet(
     const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
     : d_comm( comm )
+    , d_physical_dim( 0 )
+    , d_start_gid( 0 )
+    , d_owner_support_offsets( 1, 0 )
+    , d_owner_point_offsets( 1, 0 )
+    , d_owner_shape_offsets( 1, 0 )
 { /* ... */
 }
 
+//---------------------------------------------------------------------------//
+// Add the integration points of an owning entity to the set.
+void IntegrationPointSet::addEntity(
+    const double owner_measure,
+    const Teuchos::ArrayView<const SupportId> &owner_support_ids,
+    const Teuchos::ArrayView<const double> &integration_weights,
+    const Teuchos::ArrayView<const double> &physical_coordinates,
+    const Teuchos::ArrayView<const double> &owner_shape_evals )
+{
+    int num_points = integration_weights.size();
+    int num_support = owner_support_ids.size();
+    if ( 0 == num_points )
+    {
+        return;
+    }
+
+    // Get the physical dimension from the first entity.
+    if ( 0 == d_physical_dim )
+    {
+        d_physical_dim = physical_coordinates.size() / num_points;
+    }
+    DTK_REQUIRE( physical_coordinates.size() == num_points * d_physical_dim );
+    DTK_REQUIRE( owner_shape_evals.size() == num_points * num_support );
+
+    // Add the owner data.
+    int owner = d_owner_measures.size();
+    d_owner_measures.push_back( owner_measure );
+    std::copy( owner_support_ids.begin(), owner_support_ids.end(),
+               std::back_inserter( d_owner_support_ids ) );
+    d_owner_support_offsets.push_back( d_owner_support_ids.size() );
+
+    // Add the point data.
+    std::copy( integration_weights.begin(), integration_weights.end(),
+               std::back_inserter( d_integration_weights ) );
+    std::copy( physical_coordinates.begin(), physical_coordinates.end(),
+               std::back_inserter( d_physical_coordinates ) );
+    std::copy( owner_shape_evals.begin(), owner_shape_evals.end(),
+               std::back_inserter( d_owner_shape_evals ) );
+    d_point_owners.resize( d_point_owners.size() + num_points, owner );
+    d_owner_point_offsets.push_back( d_integration_weights.size() );
+    d_owner_shape_offsets.push_back( d_owner_shape_evals.size() );
+}
+
 //---------------------------------------------------------------------------//
 // Add an integration point to the set.
 void IntegrationPointSet::addPoint( const IntegrationPoint &ip )
 {
-    d_points.push_back( ip );
+    addEntity( ip.d_owner_measure, ip.d_owner_support_ids(),
+               Teuchos::arrayView( &ip.d_integration_weight, 1 ),
+               ip.d_physical_coordinates(), ip.d_owner_shape_evals() );
 }
 
 //---------------------------------------------------------------------------//
 // Finalize the point set to construct global ids.
 void IntegrationPointSet::finalize()
 {
-    // Build a globally contiguous ordering of point global ids.
-    EntityId num_local_ip = d_points.size();
-
-    EntityId invalid = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid();
-    Teuchos::RCP<const Tpetra::Map<int, EntityId>> map =
-        Tpetra::createContigMap<int, EntityId>( invalid, num_local_ip, d_comm );
-
-    // Get the starting id for this node.
-    DTK_CHECK( map->isContiguous() );
-    DTK_CHECK( map->getMaxGlobalIndex() - map->getMinGlobalIndex() + 1 ==
-               num_local_ip );
-    DTK_CHECK( map->getNodeNumElements() == num_local_ip );
-    d_start_gid = map->getMinGlobalIndex();
-
-    // Assign global ids to the points.
-    Teuchos::ArrayView<const EntityId> ip_gids = map->getNodeElementList();
-    for ( EntityId p = 0; p < num_local_ip; ++p )
-    {
-        d_points[p].d_gid = ip_gids[p];
-    }
+    // Build a globally contiguous ordering of point global ids. The points
+    // on this proc start after the points of all lower ranks.
+    EntityId num_local_ip = d_integration_weights.size();
+    EntityId num_scan_ip = 0;
+    Teuchos::scan( *d_comm, Teuchos::REDUCE_SUM, num_local_ip,
+                   Teuchos::ptrFromRef( num_scan_ip ) );
+    d_start_gid = num_scan_ip - num_local_ip;
 }
 
 //---------------------------------------------------------------------------//
-// Get an integration point with the given global id.
-const IntegrationPoint &
-IntegrationPointSet::getPoint( const EntityId ip_id ) const
+// Get a copy of the integration point with the given global id.
+IntegrationPoint IntegrationPointSet::getPoint( const EntityId ip_id ) const
 {
     DTK_REQUIRE( ip_id >= d_start_gid );
     DTK_REQUIRE( ip_id - d_start_gid <
-                 Teuchos::as<EntityId>( d_points.size() ) );
-    return d_points[ip_id - d_start_gid];
+                 Teuchos::as<EntityId>( d_integration_weights.size() ) );
+    int lid = localId( ip_id );
+    IntegrationPoint ip;
+    ip.d_gid = ip_id;
+    ip.d_owner_measure = ownerMeasure( lid );
+    ip.d_integration_weight = integrationWeight( lid );
+    Teuchos::ArrayView<const double> coords = physicalCoordinates( lid );
+    ip.d_physical_coordinates.assign( coords.begin(), coords.end() );
+    Teuchos::ArrayView<const SupportId> support_ids = ownerSupportIds( lid );
+    ip.d_owner_support_ids.assign( support_ids.begin(), support_ids.end() );
+    Teuchos::ArrayView<const double> shape_evals = ownerShapeEvals( lid );
+    ip.d_owner_shape_evals.assign( shape_evals.begin(), shape_evals.end() );
+    return ip;
 }
 
 //---------------------------------------------------------------------------//
 // Get an entity iterator over the integration points.
 EntityIterator IntegrationPointSet::entityIterator() const
 {
-    return IntegrationPointSetIterator( Teuchos::rcpFromRef( d_points ) );
+    return IntegrationPointSetIterator( this );
 }
 
 //---------------------------------------------------------------------------//
@@ -225,14 +279,11 @@ EntityIterator IntegrationPointSet::entityIterator() const
 int IntegrationPointSet::globalMaxSupportSize() const
 {
     int local_max = 0;
-    if ( d_points.size() > 0 )
+    int num_owners = numOwners();
+    for ( int o = 0; o < num_owners; ++o )
     {
-        auto comp = []( const IntegrationPoint &a, const IntegrationPoint &b ) {
-            return ( a.d_owner_support_ids.size() <
-                     b.d_owner_support_ids.size() );
-        };
-        local_max = std::max_element( d_points.begin(), d_points.end(), comp )
-                        ->d_owner_support_ids.size();
+        local_max = std::max( local_max, d_owner_support_offsets[o + 1] -
+                                             d_owner_support_offsets[o] );
     }
     int global_max = 0;
     Teuchos::reduceAll( *d_comm, Teuchos::REDUCE_MAX, local_max,
@@ -240,13 +291,52 @@ int IntegrationPointSet::globalMaxSupportSize() const
     return global_max;
 }
 
+//---------------------------------------------------------------------------//
+// Get the number of bytes allocated by the point data.
+long long IntegrationPointSet::memoryBytes() const
+{
+    return containerBytes( d_owner_measures ) +
+           containerBytes( d_owner_support_offsets ) +
+           containerBytes( d_owner_support_ids ) +
+           containerBytes( d_owner_point_offsets ) +
+           containerBytes( d_owner_shape_offsets ) +
+           containerBytes( d_point_owners ) +
+           containerBytes( d_integration_weights ) +
+           containerBytes( d_physical_coordinates ) +
+           containerBytes( d_owner_shape_evals );
+}
+
+//---------------------------------------------------------------------------//
+// Get the support ids of the entity that owns a point.
+Teuchos::ArrayView<const SupportId>
+IntegrationPointSet::ownerSupportIds( const int lid ) const
+{
+    int owner = d_point_owners[lid];
+    return d_owner_support_ids.view( d_owner_support_offsets[owner],
+                                     d_owner_support_offsets[owner + 1] -
+                                         d_owner_support_offsets[owner] );
+}
+
+//---------------------------------------------------------------------------//
+// Get the shape function evaluations of a point in its owning entity.
+Teuchos::ArrayView<const double>
+IntegrationPointSet::ownerShapeEvals( const int lid ) const
+{
+    int owner = d_point_owners[lid];
+    int num_support =
+        d_owner_support_offsets[owner + 1] - d_owner_support_offsets[owner];
+    return d_owner_shape_evals.view(
+        d_owner_shape_offsets[owner] +
+            ( lid - d_owner_point_offsets[owner] ) * num_support,
+        num_support );
+}
+
 //---------------------------------------------------------------------------//
 // Get the centroid of the integration point.
 void IntegrationPointSet::centroid(
     const Entity &entity, const Teuchos::ArrayView<double> &centroid ) const
 {
-    const IntegrationPoint &point = getPoint( entity.id() );
-    centroid.assign( point.d_physical_coordinates );
+    centroid.assign( physicalCoordinates( localId( entity.id() ) ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -53,6 +53,8 @@
 
 namespace DataTransferKit
 {
+class IntegrationPointSet;
+
 //---------------------------------------------------------------------------//
 /*!
   \class IntegrationPointSetIterator
@@ -65,8 +67,7 @@ class IntegrationPointSetIterator : public EntityIterator
     IntegrationPointSetIterator();
 
     // Constructor.
-    IntegrationPointSetIterator(
-        Teuchos::RCP<Teuchos::Array<IntegrationPoint>> points );
+    IntegrationPointSetIterator( const IntegrationPointSet *points );
 
     // Copy constructor.
     IntegrationPointSetIterator( const IntegrationPointSetIterator &rhs );
@@ -103,11 +104,11 @@ class IntegrationPointSetIterator : public EntityIterator
     std::unique_ptr<EntityIterator> clone() const override;
 
   private:
-    // Map to iterate over.
-    Teuchos::RCP<Teuchos::Array<IntegrationPoint>> d_points;
+    // Set to iterate over.
+    const IntegrationPointSet *d_points;
 
-    // Iterator over the entity map.
-    Teuchos::Array<IntegrationPoint>::iterator d_points_it;
+    // Local id of the current point.
+    int d_lid;
 
     // The current entity.
     Entity d_current_entity;
@@ -117,6 +118,10 @@ class IntegrationPointSetIterator : public EntityIterator
 /*!
   \class IntegrationPointSet
   \brief EntitySet of integration points.
+
+  Integration points are stored in structure-of-arrays form. The points of
+  an owning entity are contiguous and share a single copy of the owner
+  measure and support ids.
 */
 //---------------------------------------------------------------------------//
 class IntegrationPointSet : public EntityLocalMap
@@ -127,24 +132,99 @@ class IntegrationPointSet : public EntityLocalMap
      */
     IntegrationPointSet( const Teuchos::RCP<const Teuchos::Comm<int>> &comm );
 
+    // Add the integration points of an owning entity to the set. The
+    // physical coordinates are ordered as (point, dimension) and the shape
+    // function evaluations as (point, support).
+    void
+    addEntity( const double owner_measure,
+               const Teuchos::ArrayView<const SupportId> &owner_support_ids,
+               const Teuchos::ArrayView<const double> &integration_weights,
+               const Teuchos::ArrayView<const double> &physical_coordinates,
+               const Teuchos::ArrayView<const double> &owner_shape_evals );
+
     // Add an integration point to the set.
     void addPoint( const IntegrationPoint &ip );
 
     // Finalize the point set to construct global ids.
     void finalize();
 
-    // Get an integration point with the given global id.
-    const IntegrationPoint &getPoint( const EntityId ip_id ) const;
+    // Get a copy of the integration point with the given global id.
+    IntegrationPoint getPoint( const EntityId ip_id ) const;
 
     // Get an entity iterator over the integration points.
     EntityIterator entityIterator() const;
 
     // Get the number of points.
-    int numPoints() const { return d_points.size(); }
+    int numPoints() const { return d_integration_weights.size(); }
 
     // Get the global maximum support size for all integration points.
     int globalMaxSupportSize() const;
 
+    // Get the number of bytes allocated by the point data.
+    long long memoryBytes() const;
+
+    //@{
+    //! Local point data access.
+    // Get the local id of a point from its global id.
+    int localId( const EntityId ip_id ) const
+    {
+        return Teuchos::as<int>( ip_id - d_start_gid );
+    }
+
+    // Get the global id of a point from its local id.
+    EntityId globalId( const int lid ) const { return d_start_gid + lid; }
+
+    // Get the measure of the entity that owns a point.
+    double ownerMeasure( const int lid ) const
+    {
+        return d_owner_measures[d_point_owners[lid]];
+    }
+
+    // Get the integration weight of a point.
+    double integrationWeight( const int lid ) const
+    {
+        return d_integration_weights[lid];
+    }
+
+    // Get the physical coordinates of a point.
+    Teuchos::ArrayView<const double> physicalCoordinates( const int lid ) const
+    {
+        return d_physical_coordinates.view( d_physical_dim * lid,
+                                            d_physical_dim );
+    }
+
+    // Get the support ids of the entity that owns a point.
+    Teuchos::ArrayView<const SupportId> ownerSupportIds( const int lid ) const;
+
+    // Get the shape function evaluations of a point in its owning entity.
+    Teuchos::ArrayView<const double> ownerShapeEvals( const int lid ) const;
+    //@}
+
+    //@{
+    //! Owning entity access.
+    // Get the number of owning entities.
+    int numOwners() const { return d_owner_measures.size(); }
+
+    // Get the local id of the first point of an owning entity.
+    int ownerFirstPoint( const int owner ) const
+    {
+        return d_owner_point_offsets[owner];
+    }
+
+    // Get the number of points in an owning entity.
+    int ownerNumPoints( const int owner ) const
+    {
+        return d_owner_point_offsets[owner + 1] -
+               d_owner_point_offsets[owner];
+    }
+
+    // Get the support ids of all owning entities.
+    Teuchos::ArrayView<const SupportId> allOwnerSupportIds() const
+    {
+        return d_owner_support_ids();
+    }
+    //@}
+
     //@{
     //! EntityLocalMap interface. Only implement the centroid function for the
     // search.
@@ -180,11 +260,39 @@ class IntegrationPointSet : public EntityLocalMap
     // Communicator.
     Teuchos::RCP<const Teuchos::Comm<int>> d_comm;
 
-    // Local integration points.
-    mutable Teuchos::Array<IntegrationPoint> d_points;
+    // Physical dimension of the points.
+    int d_physical_dim;
 
     // Starting global id for this proc.
     EntityId d_start_gid;
+
+    // Measure of each owning entity.
+    Teuchos::Array<double> d_owner_measures;
+
+    // Offsets into the support id array for each owning entity.
+    Teuchos::Array<int> d_owner_support_offsets;
+
+    // Support ids of the owning entities.
+    Teuchos::Array<SupportId> d_owner_support_ids;
+
+    // Offsets into the point arrays for each owning entity.
+    Teuchos::Array<int> d_owner_point_offsets;
+
+    // Offsets into the shape function evaluation array for each owning
+    // entity.
+    Teuchos::Array<int> d_owner_shape_offsets;
+
+    // Owning entity of each point.
+    Teuchos::Array<int> d_point_owners;
+
+    // Integration weight of each point.
+    Teuchos::Array<double> d_integration_weights;
+
+    // Physical coordinates of the points ordered as (point, dimension).
+    Teuchos::Array<double> d_physical_coordinates;
+
+    // Shape function evaluations of each point ordered as (point, support).
+    Teuchos::Array<double> d_owner_shape_evals;
 };
 
 //---------------------------------------------------------------------------//
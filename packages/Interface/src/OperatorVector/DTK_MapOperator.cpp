@@ -51,7 +51,9 @@ MapOperator::MapOperator( const Teuchos::RCP<const TpetraMap> &domain_map,
     : d_domain_map( domain_map )
     , d_range_map( range_map )
     , d_setup_is_complete( false )
-{ /* ... */
+    , d_domain_data_is_current( false )
+{
+    d_profiler.setEnabled( false );
 }
 
 //---------------------------------------------------------------------------//
@@ -81,6 +83,9 @@ MapOperator::getRangeMap() const
 void MapOperator::setup( const Teuchos::RCP<FunctionSpace> &domain_space,
                          const Teuchos::RCP<FunctionSpace> &range_space )
 {
+    // Route the timers and counters of the setup to this operator.
+    ProfilerScope profiler_scope( d_profiler );
+    ScopedTimer timer( "Setup" );
     setupImpl( domain_space, range_space );
     d_setup_is_complete = true;
 }
@@ -88,28 +93,83 @@ void MapOperator::setup( const Teuchos::RCP<FunctionSpace> &domain_space,
 //---------------------------------------------------------------------------//
 bool MapOperator::setupIsComplete() const { return d_setup_is_complete; }
 
+//---------------------------------------------------------------------------//
+// Declare whether the domain vectors are current with the application data.
+void MapOperator::setDomainDataIsCurrent( const bool is_current )
+{
+    d_domain_data_is_current = is_current;
+}
+
+//---------------------------------------------------------------------------//
+// Enable or disable profiling.
+void MapOperator::setProfilingEnabled( const bool enabled )
+{
+    d_profiler.setEnabled( enabled );
+}
+
+//---------------------------------------------------------------------------//
+// Turn on or off memory tracking.
+void MapOperator::setMemoryTracking( const bool track )
+{
+    d_profiler.setMemoryTracking( track );
+}
+
+//---------------------------------------------------------------------------//
+// Get the profiler.
+const Profiler &MapOperator::profiler() const { return d_profiler; }
+
+//---------------------------------------------------------------------------//
+// Clear the recorded profiling data.
+void MapOperator::resetProfile() { d_profiler.reset(); }
+
 //---------------------------------------------------------------------------//
 // Apply the map operator.
 void MapOperator::apply( const TpetraMultiVector &X, TpetraMultiVector &Y,
                          Teuchos::ETransp mode, const double alpha,
                          const double beta ) const
 {
-    // Pull data from the applications.
-    const FieldMultiVector &X_fmv = dynamic_cast<const FieldMultiVector &>( X );
-    const_cast<FieldMultiVector &>( X_fmv ).pullDataFromApplication();
-    dynamic_cast<FieldMultiVector &>( Y ).pullDataFromApplication();
+    // Route the timers and counters of the apply to this operator.
+    ProfilerScope profiler_scope( d_profiler );
+    ScopedTimer timer( "Apply" );
+
+    // Pull the domain data from the application unless the caller has
+    // declared it current.
+    const FieldMultiVector *X_fmv =
+        dynamic_cast<const FieldMultiVector *>( &X );
+    if ( nullptr != X_fmv && !d_domain_data_is_current )
+    {
+        const_cast<FieldMultiVector *>( X_fmv )->pullDataFromApplication();
+    }
+
+    // Only pull the range data from the application if it contributes to
+    // the result.
+    FieldMultiVector *Y_fmv = dynamic_cast<FieldMultiVector *>( &Y );
+    if ( nullptr != Y_fmv &&
+         ( Teuchos::ScalarTraits<double>::zero() != beta ||
+           applyUsesRangeDataImpl() ) )
+    {
+        Y_fmv->pullDataFromApplication();
+    }
 
     // Apply the operator.
     applyImpl( X, Y, mode, alpha, beta );
 
     // Push the data into the application.
-    dynamic_cast<FieldMultiVector &>( Y ).pushDataToApplication();
+    if ( nullptr != Y_fmv )
+    {
+        Y_fmv->pushDataToApplication();
+    }
 }
 
 //---------------------------------------------------------------------------//
 // Check if the map has a transpose apply option.n
 bool MapOperator::hasTransposeApply() const { return hasTransposeApplyImpl(); }
 
+//---------------------------------------------------------------------------//
+// By default the apply implementation does not read the range data when beta
+// is zero.
+bool MapOperator::applyUsesRangeDataImpl() const { return false; }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -42,6 +42,7 @@
 #define DTK_MAPOPERATOR_HPP
 
 #include "DTK_FunctionSpace.hpp"
+#include "DTK_Profiler.hpp"
 #include "DTK_Types.hpp"
 
 #include <Teuchos_ParameterList.hpp>
@@ -58,6 +59,13 @@ namespace DataTransferKit
   \brief Map operator interface.
 
   A map operator maps a field in one entity set to another entity set.
+
+  The vectors given to apply() may be FieldMultiVectors or plain
+  Tpetra::MultiVectors. For FieldMultiVectors the application data is pulled
+  into the domain vector, the operator is applied, and the result is pushed
+  back into the application. The range vector is only pulled when its
+  current values contribute to the result, i.e. when beta is nonzero or the
+  operator reads the range data.
 */
 //---------------------------------------------------------------------------//
 class MapOperator : public Tpetra::Operator<double, int, SupportId>
@@ -113,6 +121,41 @@ class MapOperator : public Tpetra::Operator<double, int, SupportId>
      */
     bool setupIsComplete() const;
 
+    /*!
+     * \brief Declare whether the domain vectors given to apply() are already
+     * current with the application data. If true, apply() will not pull data
+     * from the application into FieldMultiVector domain vectors. The default
+     * is false.
+     */
+    void setDomainDataIsCurrent( const bool is_current );
+
+    /*!
+     * \brief Enable or disable profiling. When enabled, the timers and
+     * counters of the setup and apply phases and of the searches and
+     * assembly within them are recorded in the profiler of this operator.
+     * The default is disabled.
+     */
+    void setProfilingEnabled( const bool enabled );
+
+    /*!
+     * \brief Turn on or off memory tracking. When on, the bytes of the major
+     * setup containers and the process resident set size high-water mark at
+     * the end of each timed stage are recorded with the timing data. Memory
+     * is only tracked while profiling is enabled. The default is off.
+     */
+    void setMemoryTracking( const bool track );
+
+    /*!
+     * \brief Get the profiler of this operator. Use Profiler::report() or
+     * Profiler::globalReport() to retrieve the recorded data.
+     */
+    const Profiler &profiler() const;
+
+    /*!
+     * \brief Clear the recorded profiling data.
+     */
+    void resetProfile();
+
     //@{
     //! Tpetra::Operator interface.
     Teuchos::RCP<const TpetraMap> getDomainMap() const override;
@@ -139,6 +182,10 @@ class MapOperator : public Tpetra::Operator<double, int, SupportId>
                             Teuchos::ETransp mode, double alpha,
                             double beta ) const = 0;
 
+    //! Range data option. Subclasses should override if the apply
+    //! implementation reads the range vector when beta is zero.
+    virtual bool applyUsesRangeDataImpl() const;
+
   private:
     //! Domain map.
     Teuchos::RCP<const TpetraMap> d_domain_map;
@@ -148,6 +195,12 @@ class MapOperator : public Tpetra::Operator<double, int, SupportId>
 
     //! True if setup has been completed.
     bool d_setup_is_complete;
+
+    //! True if the domain vectors are current with the application data.
+    bool d_domain_data_is_current;
+
+    //! Profiler for the setup and apply phases.
+    mutable Profiler d_profiler;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file tstIntegrationPointSet.cpp
+ * \author Stuart R. Slattery
+ * \brief IntegrationPointSet unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <DTK_IntegrationPoint.hpp>
+#include <DTK_IntegrationPointSet.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( IntegrationPointSet, add_entity )
+{
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // Add two entities. The first has 2 points and 2 supports and the second
+    // has 3 points and 1 support.
+    DataTransferKit::IntegrationPointSet ip_set( comm );
+
+    Teuchos::Array<DataTransferKit::SupportId> support_ids_1( 2 );
+    support_ids_1[0] = 3;
+    support_ids_1[1] = 7;
+    Teuchos::Array<double> weights_1( 2, 0.5 );
+    Teuchos::Array<double> coords_1( 4 );
+    coords_1[0] = 0.0;
+    coords_1[1] = 1.0;
+    coords_1[2] = 2.0;
+    coords_1[3] = 3.0;
+    Teuchos::Array<double> evals_1( 4 );
+    evals_1[0] = 0.25;
+    evals_1[1] = 0.75;
+    evals_1[2] = 0.75;
+    evals_1[3] = 0.25;
+    ip_set.addEntity( 2.0, support_ids_1(), weights_1(), coords_1(),
+                      evals_1() );
+
+    Teuchos::Array<DataTransferKit::SupportId> support_ids_2( 1, 11 );
+    Teuchos::Array<double> weights_2( 3, 1.0 / 3.0 );
+    Teuchos::Array<double> coords_2( 6, comm_rank );
+    Teuchos::Array<double> evals_2( 3, 1.0 );
+    ip_set.addEntity( 4.0, support_ids_2(), weights_2(), coords_2(),
+                      evals_2() );
+
+    ip_set.finalize();
+
+    // Check the layout.
+    TEST_EQUALITY( ip_set.numPoints(), 5 );
+    TEST_EQUALITY( ip_set.numOwners(), 2 );
+    TEST_EQUALITY( ip_set.ownerFirstPoint( 0 ), 0 );
+    TEST_EQUALITY( ip_set.ownerNumPoints( 0 ), 2 );
+    TEST_EQUALITY( ip_set.ownerFirstPoint( 1 ), 2 );
+    TEST_EQUALITY( ip_set.ownerNumPoints( 1 ), 3 );
+    TEST_EQUALITY( ip_set.allOwnerSupportIds().size(), 3 );
+    TEST_EQUALITY( ip_set.globalMaxSupportSize(), 2 );
+
+    // Check the point data.
+    TEST_EQUALITY( ip_set.ownerMeasure( 1 ), 2.0 );
+    TEST_EQUALITY( ip_set.ownerMeasure( 4 ), 4.0 );
+    TEST_EQUALITY( ip_set.integrationWeight( 1 ), 0.5 );
+    TEST_EQUALITY( ip_set.physicalCoordinates( 1 ).size(), 2 );
+    TEST_EQUALITY( ip_set.physicalCoordinates( 1 )[0], 2.0 );
+    TEST_EQUALITY( ip_set.physicalCoordinates( 1 )[1], 3.0 );
+    TEST_EQUALITY( ip_set.ownerSupportIds( 1 )[1], 7 );
+    TEST_EQUALITY( ip_set.ownerShapeEvals( 1 )[0], 0.75 );
+    TEST_EQUALITY( ip_set.ownerShapeEvals( 1 )[1], 0.25 );
+    TEST_EQUALITY( ip_set.ownerSupportIds( 3 ).size(), 1 );
+    TEST_EQUALITY( ip_set.ownerSupportIds( 3 )[0], 11 );
+    TEST_EQUALITY( ip_set.ownerShapeEvals( 3 ).size(), 1 );
+
+    // Check the global ids.
+    DataTransferKit::EntityId start_gid = 5 * comm_rank;
+    TEST_EQUALITY( ip_set.globalId( 0 ), start_gid );
+    TEST_EQUALITY( ip_set.localId( start_gid + 4 ), 4 );
+    DataTransferKit::IntegrationPoint ip = ip_set.getPoint( start_gid + 1 );
+    TEST_EQUALITY( ip.d_gid, start_gid + 1 );
+    TEST_EQUALITY( ip.d_owner_measure, 2.0 );
+    TEST_EQUALITY( ip.d_owner_support_ids.size(), 2 );
+    TEST_EQUALITY( ip.d_owner_shape_evals[0], 0.75 );
+
+    // Check the iterator.
+    DataTransferKit::EntityIterator ip_it = ip_set.entityIterator();
+    TEST_EQUALITY( ip_it.size(), 5 );
+    Teuchos::Array<double> centroid( 2 );
+    int n = 0;
+    for ( ip_it = ip_it.begin(); ip_it != ip_it.end(); ++ip_it, ++n )
+    {
+        TEST_EQUALITY( ip_it->id(), start_gid + n );
+        TEST_EQUALITY( ip_it->physicalDimension(), 2 );
+        ip_set.centroid( *ip_it, centroid() );
+        TEST_EQUALITY( centroid[0], ip_set.physicalCoordinates( n )[0] );
+    }
+
+    // Check the global number of points.
+    int global_num_points = 0;
+    int local_num_points = ip_set.numPoints();
+    Teuchos::reduceAll( *comm, Teuchos::REDUCE_SUM, local_num_points,
+                        Teuchos::ptrFromRef( global_num_points ) );
+    TEST_EQUALITY( global_num_points, 5 * comm_size );
+}
+
+//---------------------------------------------------------------------------//
+// end tstIntegrationPointSet.cpp
+//---------------------------------------------------------------------------//
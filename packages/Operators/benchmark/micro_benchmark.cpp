@@ -0,0 +1,503 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   micro_benchmark.cpp
+ * \author Stuart R. Slattery
+ * \brief  Micro-benchmarks of the innermost search and point cloud kernels.
+ *
+ * Each kernel is run over a batch of inputs repeatedly until a minimum time
+ * has elapsed. The time per batch and the throughput in items per second are
+ * reported so the kernels can be tracked as they are optimized. The
+ * benchmarks run on a single process.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "reference_implementation/DTK_ReferenceHexMesh.hpp"
+
+#include <DTK_BuhmannBasis.hpp>
+#include <DTK_CoarseLocalSearch.hpp>
+#include <DTK_FineLocalSearch.hpp>
+#include <DTK_LocalMLSProblem.hpp>
+#include <DTK_Profiler.hpp>
+#include <DTK_RadialBasisPolicy.hpp>
+#include <DTK_StaticSearchTree.hpp>
+#include <DTK_WendlandBasis.hpp>
+#include <DTK_WuBasis.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_DefaultSerialComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+
+//---------------------------------------------------------------------------//
+// Benchmark harness.
+//---------------------------------------------------------------------------//
+class MicroBenchmark
+{
+  public:
+    // Constructor.
+    MicroBenchmark( const std::string &filter, const double min_time )
+        : d_filter( filter )
+        , d_min_time( min_time )
+        , d_report( "Micro Benchmark" )
+        , d_sink( 0.0 )
+    {
+        std::cout << std::left << std::setw( 48 ) << "Benchmark" << std::right
+                  << std::setw( 10 ) << "Iters" << std::setw( 14 )
+                  << "Time (us)" << std::setw( 14 ) << "Items/s"
+                  << std::endl;
+    }
+
+    // Return true if a benchmark is selected by the filter.
+    bool selected( const std::string &name ) const
+    {
+        return d_filter.empty() || std::string::npos != name.find( d_filter );
+    }
+
+    // Run a kernel that processes a batch of items until the minimum time
+    // has elapsed and report its time per batch and throughput.
+    void run( const std::string &name, const long long items_per_batch,
+              const std::function<double()> &kernel )
+    {
+        if ( !selected( name ) )
+        {
+            return;
+        }
+
+        // Warm up.
+        d_sink += kernel();
+
+        // Time the batches.
+        int iterations = 0;
+        double elapsed = 0.0;
+        double start = Teuchos::Time::wallTime();
+        do
+        {
+            d_sink += kernel();
+            ++iterations;
+            elapsed = Teuchos::Time::wallTime() - start;
+        } while ( elapsed < d_min_time );
+
+        double batch_time = elapsed / iterations;
+        double throughput =
+            ( batch_time > 0.0 ) ? items_per_batch / batch_time : 0.0;
+        std::cout << std::left << std::setw( 48 ) << name << std::right
+                  << std::setw( 10 ) << iterations << std::setw( 14 )
+                  << std::setprecision( 4 ) << 1.0e6 * batch_time
+                  << std::setw( 14 ) << std::setprecision( 4 ) << throughput
+                  << std::endl;
+
+        Teuchos::ParameterList &result = d_report.sublist( name );
+        result.set( "Iterations", iterations );
+        result.set( "Batch Time", batch_time );
+        result.set( "Items Per Batch", items_per_batch );
+        result.set( "Items Per Second", throughput );
+    }
+
+    // Get the report of all benchmarks run.
+    const Teuchos::ParameterList &report() const { return d_report; }
+
+    // Get the accumulated kernel results. Printing this keeps the compiler
+    // from removing the kernels.
+    double sink() const { return d_sink; }
+
+  private:
+    // Benchmark name filter.
+    std::string d_filter;
+
+    // Minimum time each benchmark is run for.
+    double d_min_time;
+
+    // Results.
+    Teuchos::ParameterList d_report;
+
+    // Accumulated kernel results.
+    double d_sink;
+};
+
+//---------------------------------------------------------------------------//
+// Uniform random number in [0,1].
+//---------------------------------------------------------------------------//
+double random01() { return (double)std::rand() / (double)RAND_MAX; }
+
+//---------------------------------------------------------------------------//
+// Build uniform random points in the unit cube.
+//---------------------------------------------------------------------------//
+Teuchos::Array<double> randomPoints( const int dim, const int num_points )
+{
+    Teuchos::Array<double> points( dim * num_points );
+    for ( auto &p : points )
+    {
+        p = random01();
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------//
+// Get the radius of the ball that contains the given number of points on
+// average for uniform random points in the unit cube.
+//---------------------------------------------------------------------------//
+double neighborRadius( const int dim, const int num_points,
+                       const int num_neighbors )
+{
+    double pi = 4.0 * std::atan( 1.0 );
+    double unit_volume =
+        ( 1 == dim ) ? 2.0 : ( ( 2 == dim ) ? pi : 4.0 * pi / 3.0 );
+    return std::pow( num_neighbors / ( unit_volume * num_points ), 1.0 / dim );
+}
+
+//---------------------------------------------------------------------------//
+// kD-tree build and query benchmarks.
+//---------------------------------------------------------------------------//
+template <int DIM>
+void benchmarkSearchTree( MicroBenchmark &benchmark, const int num_points,
+                          const int num_queries, const int num_neighbors )
+{
+    std::string dim = std::to_string( DIM ) + "D";
+    Teuchos::Array<double> points = randomPoints( DIM, num_points );
+    Teuchos::Array<double> queries = randomPoints( DIM, num_queries );
+    unsigned max_leaf_size = 10;
+
+    // Tree construction.
+    benchmark.run( "StaticSearchTree build " + dim, num_points, [&]() {
+        DataTransferKit::NanoflannTree<DIM> tree( points(), max_leaf_size );
+        return 1.0;
+    } );
+
+    // Nearest neighbor queries.
+    DataTransferKit::NanoflannTree<DIM> tree( points(), max_leaf_size );
+    benchmark.run( "StaticSearchTree kNN " + dim, num_queries, [&]() {
+        double found = 0.0;
+        for ( int q = 0; q < num_queries; ++q )
+        {
+            found += tree.nnSearch( queries( DIM * q, DIM ), num_neighbors )
+                         .size();
+        }
+        return found;
+    } );
+
+    // Radius queries with the same number of neighbors on average.
+    double radius = neighborRadius( DIM, num_points, num_neighbors );
+    benchmark.run( "StaticSearchTree radius " + dim, num_queries, [&]() {
+        double found = 0.0;
+        for ( int q = 0; q < num_queries; ++q )
+        {
+            found +=
+                tree.radiusSearch( queries( DIM * q, DIM ), radius ).size();
+        }
+        return found;
+    } );
+}
+
+//---------------------------------------------------------------------------//
+// Fine local search benchmark against the cells of a reference hex mesh.
+// The candidate cells of each point are found with a coarse local search
+// before timing.
+//---------------------------------------------------------------------------//
+void benchmarkFineLocalSearch( MicroBenchmark &benchmark, const int cells,
+                               const int num_queries )
+{
+    std::string name = "FineLocalSearch reference hex";
+    if ( !benchmark.selected( name ) )
+    {
+        return;
+    }
+
+    // Build a serial mesh with randomly perturbed edges so the cells are
+    // not all the same shape.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::rcp( new Teuchos::SerialComm<int>() );
+    Teuchos::Array<Teuchos::Array<double>> edges( 3 );
+    double width = 1.0 / cells;
+    for ( auto &e : edges )
+    {
+        e.resize( cells + 1 );
+        for ( int i = 0; i < cells + 1; ++i )
+        {
+            e[i] = i * width;
+            if ( 0 < i && i < cells )
+            {
+                e[i] += 0.3 * width * ( 2.0 * random01() - 1.0 );
+            }
+        }
+    }
+    DataTransferKit::UnitTest::ReferenceHexMesh mesh( comm, edges[0],
+                                                      edges[1], edges[2] );
+    auto local_map = mesh.functionSpace()->localMap();
+    auto cell_iterator = mesh.functionSpace()->entitySet()->entityIterator( 3 );
+
+    // Find the candidate cells of each point.
+    Teuchos::ParameterList parameters;
+    DataTransferKit::CoarseLocalSearch coarse_search( cell_iterator,
+                                                      local_map, parameters );
+    Teuchos::Array<double> queries = randomPoints( 3, num_queries );
+    Teuchos::Array<Teuchos::Array<DataTransferKit::Entity>> candidates(
+        num_queries );
+    long long num_candidates = 0;
+    for ( int q = 0; q < num_queries; ++q )
+    {
+        coarse_search.search( queries( 3 * q, 3 ), parameters,
+                              candidates[q] );
+        num_candidates += candidates[q].size();
+    }
+
+    // Time the fine search.
+    DataTransferKit::FineLocalSearch fine_search( local_map );
+    Teuchos::Array<DataTransferKit::Entity> parents;
+    Teuchos::Array<double> reference_coordinates;
+    benchmark.run( name, num_candidates, [&]() {
+        double found = 0.0;
+        for ( int q = 0; q < num_queries; ++q )
+        {
+            fine_search.search( candidates[q](), queries( 3 * q, 3 ),
+                                parameters, parents, reference_coordinates );
+            found += parents.size();
+        }
+        return found;
+    } );
+}
+
+//---------------------------------------------------------------------------//
+// Local MLS problem construction benchmark for a basis with both the
+// original normal equation solve and the QRCP solve.
+//---------------------------------------------------------------------------//
+template <class Basis>
+void benchmarkLocalMLS( MicroBenchmark &benchmark,
+                        const std::string &basis_name, const int num_sources,
+                        const int num_targets, const int num_neighbors )
+{
+    typedef DataTransferKit::RadialBasisPolicy<Basis> BP;
+    const int dim = 3;
+
+    // Find the source neighbors of each target and the support radius that
+    // contains them.
+    Teuchos::Array<double> sources = randomPoints( dim, num_sources );
+    Teuchos::Array<double> targets = randomPoints( dim, num_targets );
+    DataTransferKit::NanoflannTree<dim> tree( sources(), 10 );
+    Teuchos::Array<Teuchos::Array<unsigned>> neighbors( num_targets );
+    Teuchos::Array<double> radii( num_targets, 0.0 );
+    for ( int t = 0; t < num_targets; ++t )
+    {
+        neighbors[t] = tree.nnSearch( targets( dim * t, dim ), num_neighbors );
+        for ( auto n : neighbors[t] )
+        {
+            double dist = 0.0;
+            for ( int d = 0; d < dim; ++d )
+            {
+                dist += ( sources[dim * n + d] - targets[dim * t + d] ) *
+                        ( sources[dim * n + d] - targets[dim * t + d] );
+            }
+            radii[t] = std::max( radii[t], std::sqrt( dist ) );
+        }
+        radii[t] *= 1.01;
+    }
+
+    // Time the construction with each solve.
+    Teuchos::RCP<Basis> basis = BP::create();
+    for ( int qrcp = 0; qrcp < 2; ++qrcp )
+    {
+        std::string name = "LocalMLSProblem " + basis_name +
+                           ( qrcp ? " QRCP" : " Normal" );
+        benchmark.run( name, num_targets, [&]() {
+            double sum = 0.0;
+            for ( int t = 0; t < num_targets; ++t )
+            {
+                DataTransferKit::LocalMLSProblem<Basis, dim> problem(
+                    targets( dim * t, dim ), neighbors[t](), sources(),
+                    *basis, radii[t], qrcp );
+                sum += problem.shapeFunction()[0];
+            }
+            return sum;
+        } );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Radial basis value and gradient evaluation benchmark.
+//---------------------------------------------------------------------------//
+template <class Basis>
+void benchmarkRadialBasis( MicroBenchmark &benchmark,
+                           const std::string &basis_name,
+                           const int num_evaluations )
+{
+    typedef DataTransferKit::RadialBasisPolicy<Basis> BP;
+    Teuchos::RCP<Basis> basis = BP::create();
+    double radius = 1.0;
+    Teuchos::Array<double> distances( num_evaluations );
+    for ( auto &d : distances )
+    {
+        d = 1.2 * random01();
+    }
+
+    benchmark.run( "RBF value " + basis_name, num_evaluations, [&]() {
+        double sum = 0.0;
+        for ( auto d : distances )
+        {
+            sum += BP::evaluateValue( *basis, radius, d );
+        }
+        return sum;
+    } );
+
+    Teuchos::Array<double> values( num_evaluations );
+    benchmark.run( "RBF batch value " + basis_name, num_evaluations, [&]() {
+        BP::evaluateValues( *basis, radius, distances.getRawPtr(),
+                            num_evaluations, values.getRawPtr() );
+        double sum = 0.0;
+        for ( auto v : values )
+        {
+            sum += v;
+        }
+        return sum;
+    } );
+
+    benchmark.run( "RBF gradient " + basis_name, num_evaluations, [&]() {
+        double sum = 0.0;
+        for ( auto d : distances )
+        {
+            sum += BP::evaluateGradient( *basis, radius, d );
+        }
+        return sum;
+    } );
+}
+
+//---------------------------------------------------------------------------//
+// Benchmark driver.
+//---------------------------------------------------------------------------//
+int main( int argc, char *argv[] )
+{
+    Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+
+    // Read in command line options.
+    std::string filter;
+    std::string json_output_filename;
+    double min_time = 0.5;
+    int num_points = 100000;
+    int num_queries = 10000;
+    int num_neighbors = 16;
+    int cells = 20;
+    Teuchos::CommandLineProcessor clp( false );
+    clp.setOption( "filter", &filter,
+                   "Only run the benchmarks whose name contains this" );
+    clp.setOption( "min-time", &min_time,
+                   "Minimum time in seconds each benchmark is run for" );
+    clp.setOption( "points", &num_points,
+                   "Number of points in the search trees and MLS sources" );
+    clp.setOption( "queries", &num_queries,
+                   "Number of queries or targets per batch" );
+    clp.setOption( "neighbors", &num_neighbors,
+                   "Number of neighbors per query" );
+    clp.setOption( "cells", &cells,
+                   "Number of cells per edge of the fine search mesh" );
+    clp.setOption( "json-out-file", &json_output_filename,
+                   "Optional file the results are written to in JSON" );
+    if ( Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL !=
+         clp.parse( argc, argv ) )
+    {
+        return 1;
+    }
+
+    // Run the benchmarks.
+    std::srand( 4398 );
+    MicroBenchmark benchmark( filter, min_time );
+
+    benchmarkSearchTree<1>( benchmark, num_points, num_queries,
+                            num_neighbors );
+    benchmarkSearchTree<2>( benchmark, num_points, num_queries,
+                            num_neighbors );
+    benchmarkSearchTree<3>( benchmark, num_points, num_queries,
+                            num_neighbors );
+
+    benchmarkFineLocalSearch( benchmark, cells, num_queries );
+
+    benchmarkLocalMLS<DataTransferKit::WendlandBasis<0>>(
+        benchmark, "Wendland0", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WendlandBasis<2>>(
+        benchmark, "Wendland2", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WendlandBasis<4>>(
+        benchmark, "Wendland4", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WendlandBasis<6>>(
+        benchmark, "Wendland6", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WendlandBasis<21>>(
+        benchmark, "Wendland21", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WuBasis<2>>(
+        benchmark, "Wu2", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::WuBasis<4>>(
+        benchmark, "Wu4", num_points, num_queries, num_neighbors );
+    benchmarkLocalMLS<DataTransferKit::BuhmannBasis<3>>(
+        benchmark, "Buhmann3", num_points, num_queries, num_neighbors );
+
+    benchmarkRadialBasis<DataTransferKit::WendlandBasis<0>>(
+        benchmark, "Wendland0", num_points );
+    benchmarkRadialBasis<DataTransferKit::WendlandBasis<2>>(
+        benchmark, "Wendland2", num_points );
+    benchmarkRadialBasis<DataTransferKit::WendlandBasis<4>>(
+        benchmark, "Wendland4", num_points );
+    benchmarkRadialBasis<DataTransferKit::WendlandBasis<6>>(
+        benchmark, "Wendland6", num_points );
+    benchmarkRadialBasis<DataTransferKit::WendlandBasis<21>>(
+        benchmark, "Wendland21", num_points );
+    benchmarkRadialBasis<DataTransferKit::WuBasis<2>>( benchmark, "Wu2",
+                                                       num_points );
+    benchmarkRadialBasis<DataTransferKit::WuBasis<4>>( benchmark, "Wu4",
+                                                       num_points );
+    benchmarkRadialBasis<DataTransferKit::BuhmannBasis<3>>(
+        benchmark, "Buhmann3", num_points );
+
+    std::cout << "Checksum: " << benchmark.sink() << std::endl;
+
+    // Write the results.
+    if ( !json_output_filename.empty() )
+    {
+        std::ofstream json_file( json_output_filename );
+        DataTransferKit::Profiler::writeJSON( benchmark.report(), json_file );
+    }
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end micro_benchmark.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,754 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file   scaling_benchmark.cpp
+ * \author Stuart R. Slattery
+ * \brief  Weak and strong scaling benchmark for the map operators.
+ *
+ * Generates synthetic hex meshes and point clouds, runs each map operator
+ * through setup and a number of applies, and reports the timings of each
+ * phase over all processors. For a weak scaling study the problem size per
+ * processor is fixed while for a strong scaling study the global problem
+ * size is fixed. Run the benchmark with an increasing number of processors
+ * and compare the reported times, for example:
+ *
+ *   mpirun -np 8 ./DataTransferKitOperators_ScalingBenchmark.exe \
+ *       --scaling=weak --cells=20 --applies=10 --operators=all
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "reference_implementation/DTK_ReferenceHexMesh.hpp"
+
+#include <DTK_BasicEntityPredicates.hpp>
+#include <DTK_BasicGeometryManager.hpp>
+#include <DTK_EntityCenteredField.hpp>
+#include <DTK_FieldMultiVector.hpp>
+#include <DTK_MapOperatorFactory.hpp>
+#include <DTK_Point.hpp>
+#include <DTK_Profiler.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+
+//---------------------------------------------------------------------------//
+// Benchmark configuration.
+//---------------------------------------------------------------------------//
+struct BenchmarkConfig
+{
+    // Weak or strong scaling.
+    bool weak;
+
+    // Randomly perturbed or uniform mesh edges and point locations.
+    bool random;
+
+    // Number of cells (or points) along each edge of the problem. For weak
+    // scaling this is the size of the block owned by each processor.
+    int cells;
+
+    // Number of applies timed for each operator.
+    int applies;
+
+    // Number of neighbors used by the point cloud operators.
+    int num_neighbors;
+
+    // Record container memory and the peak resident set size of each phase.
+    bool track_memory;
+
+    // Largest max error of an operator for which the benchmark passes.
+    double tolerance;
+};
+
+//---------------------------------------------------------------------------//
+// A domain and range vector pair over which an operator is benchmarked.
+//---------------------------------------------------------------------------//
+struct BenchmarkProblem
+{
+    // Function spaces.
+    Teuchos::RCP<DataTransferKit::FunctionSpace> domain_space;
+    Teuchos::RCP<DataTransferKit::FunctionSpace> range_space;
+
+    // Fields. The range field is read after apply to check the result.
+    Teuchos::RCP<DataTransferKit::Field> domain_field;
+    Teuchos::RCP<DataTransferKit::Field> range_field;
+
+    // Vectors over the fields.
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> domain_vector;
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> range_vector;
+
+    // Locally-owned range support ids and the expected result at each.
+    Teuchos::Array<DataTransferKit::SupportId> range_ids;
+    Teuchos::Array<double> range_gold;
+
+    // Objects that own the geometry of the function spaces.
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> domain_mesh;
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> range_mesh;
+    Teuchos::RCP<DataTransferKit::BasicGeometryManager> domain_manager;
+    Teuchos::RCP<DataTransferKit::BasicGeometryManager> range_manager;
+};
+
+//---------------------------------------------------------------------------//
+// Data function. Linear so the mesh-based operators reproduce it exactly.
+//---------------------------------------------------------------------------//
+double dataFunction( const Teuchos::ArrayView<const double> &coords )
+{
+    return 9.3 * coords[0] + 2.2 * coords[1] + 1.33 * coords[2];
+}
+
+//---------------------------------------------------------------------------//
+// Uniform random number in [0,1].
+//---------------------------------------------------------------------------//
+double random01() { return (double)std::rand() / (double)RAND_MAX; }
+
+//---------------------------------------------------------------------------//
+// Build the edges of one mesh dimension. Random edges are the uniform edges
+// with the interior edges perturbed by up to 40% of the cell width. The same
+// seed must be used on all processors.
+//---------------------------------------------------------------------------//
+Teuchos::Array<double> buildEdges( const double min, const double max,
+                                   const int num_cells, const bool random,
+                                   const unsigned seed )
+{
+    Teuchos::Array<double> edges( num_cells + 1 );
+    double width = ( max - min ) / num_cells;
+    for ( int i = 0; i < num_cells + 1; ++i )
+    {
+        edges[i] = min + i * width;
+    }
+    if ( random )
+    {
+        std::srand( seed );
+        for ( int i = 1; i < num_cells; ++i )
+        {
+            edges[i] += 0.4 * width * ( 2.0 * random01() - 1.0 );
+        }
+    }
+    return edges;
+}
+
+//---------------------------------------------------------------------------//
+// Build a hex mesh. The mesh is partitioned in z. For weak scaling each
+// processor gets a unit-height block of cells.
+//---------------------------------------------------------------------------//
+Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh>
+buildMesh( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+           const BenchmarkConfig &config, const int cells,
+           const unsigned seed )
+{
+    int comm_size = comm->getSize();
+    double z_max = config.weak ? comm_size : 1.0;
+    int z_cells =
+        config.weak ? cells * comm_size : std::max( cells, comm_size );
+    return Teuchos::rcp( new DataTransferKit::UnitTest::ReferenceHexMesh(
+        comm, buildEdges( 0.0, 1.0, cells, config.random, seed ),
+        buildEdges( 0.0, 1.0, cells, config.random, seed + 1 ),
+        buildEdges( 0.0, z_max, z_cells, config.random, seed + 2 ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Build the mesh problem used by the consistent interpolation and L2
+// projection operators. The range mesh is one cell finer than the domain
+// mesh in each direction.
+//---------------------------------------------------------------------------//
+BenchmarkProblem
+buildMeshProblem( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                  const BenchmarkConfig &config )
+{
+    BenchmarkProblem problem;
+    DataTransferKit::LocalEntityPredicate local_pred( comm->getRank() );
+    Teuchos::Array<double> coords( 3 );
+
+    // Build the domain mesh and put the data function on its nodes.
+    problem.domain_mesh = buildMesh( comm, config, config.cells, 3940 );
+    problem.domain_space = problem.domain_mesh->functionSpace();
+    problem.domain_field = problem.domain_mesh->nodalField( 1 );
+    problem.domain_vector = Teuchos::rcp(
+        new DataTransferKit::FieldMultiVector( comm, problem.domain_field ) );
+    auto domain_local_map = problem.domain_space->localMap();
+    auto domain_nodes = problem.domain_space->entitySet()->entityIterator(
+        0, local_pred.getFunction() );
+    auto domain_begin = domain_nodes.begin();
+    auto domain_end = domain_nodes.end();
+    for ( domain_nodes = domain_begin; domain_nodes != domain_end;
+          ++domain_nodes )
+    {
+        domain_local_map->centroid( *domain_nodes, coords() );
+        problem.domain_field->writeFieldData( domain_nodes->id(), 0,
+                                              dataFunction( coords() ) );
+    }
+
+    // Build the range mesh and compute the expected result on its nodes.
+    problem.range_mesh = buildMesh( comm, config, config.cells + 1, 2389 );
+    problem.range_space = problem.range_mesh->functionSpace();
+    problem.range_field = problem.range_mesh->nodalField( 1 );
+    problem.range_vector = Teuchos::rcp(
+        new DataTransferKit::FieldMultiVector( comm, problem.range_field ) );
+    auto range_local_map = problem.range_space->localMap();
+    auto range_nodes = problem.range_space->entitySet()->entityIterator(
+        0, local_pred.getFunction() );
+    auto range_begin = range_nodes.begin();
+    auto range_end = range_nodes.end();
+    for ( range_nodes = range_begin; range_nodes != range_end; ++range_nodes )
+    {
+        range_local_map->centroid( *range_nodes, coords() );
+        problem.range_ids.push_back( range_nodes->id() );
+        problem.range_gold.push_back( dataFunction( coords() ) );
+    }
+
+    return problem;
+}
+
+//---------------------------------------------------------------------------//
+// Build the points of one slab of a point cloud. The cloud is a lattice of
+// points_per_edge points in y and z split into slabs in x. For weak scaling
+// each slab is a unit cube with points_per_edge points in x. For strong
+// scaling the slabs split the unit cube. Random clouds have the same number
+// of points in each slab as the lattice placed uniformly at random in the
+// slab. Building the same slab with the same seed gives the same points.
+//---------------------------------------------------------------------------//
+Teuchos::Array<DataTransferKit::Entity>
+buildPointCloud( const BenchmarkConfig &config, const int slab,
+                 const int num_slabs, const int points_per_edge,
+                 const int owner_rank, const unsigned seed,
+                 Teuchos::Array<double> &coords )
+{
+    // Get the lattice planes in x owned by the slab.
+    int num_planes = config.weak ? points_per_edge * num_slabs
+                                 : std::max( points_per_edge, num_slabs );
+    double x_length = config.weak ? num_slabs : 1.0;
+    double dx = x_length / num_planes;
+    double dyz = 1.0 / points_per_edge;
+    int plane_begin = slab * num_planes / num_slabs;
+    int plane_end = ( slab + 1 ) * num_planes / num_slabs;
+    int plane_size = points_per_edge * points_per_edge;
+    int num_points = ( plane_end - plane_begin ) * plane_size;
+
+    // Build the points.
+    std::srand( seed + slab );
+    Teuchos::Array<DataTransferKit::Entity> points( num_points );
+    Teuchos::Array<double> point( 3 );
+    coords.resize( 3 * num_points );
+    DataTransferKit::EntityId point_id = 0;
+    int n = 0;
+    for ( int i = plane_begin; i < plane_end; ++i )
+    {
+        for ( int j = 0; j < points_per_edge; ++j )
+        {
+            for ( int k = 0; k < points_per_edge; ++k, ++n )
+            {
+                if ( config.random )
+                {
+                    point[0] =
+                        dx * ( plane_begin +
+                               random01() * ( plane_end - plane_begin ) );
+                    point[1] = random01();
+                    point[2] = random01();
+                }
+                else
+                {
+                    point[0] = dx * ( i + 0.5 );
+                    point[1] = dyz * ( j + 0.5 );
+                    point[2] = dyz * ( k + 0.5 );
+                }
+                point_id = i * plane_size + j * points_per_edge + k;
+                points[n] =
+                    DataTransferKit::Point( point_id, owner_rank, point );
+                std::copy( point.begin(), point.end(), &coords[3 * n] );
+            }
+        }
+    }
+    return points;
+}
+
+//---------------------------------------------------------------------------//
+// Build the point cloud problem used by the point cloud operators. Each
+// processor owns the domain slab of its rank and the range slab of the
+// inverse of its rank so data moves between processors. If the nodes match,
+// the range slab is a copy of the domain slab of the inverse rank.
+// Otherwise the range cloud is one point finer in each direction.
+//---------------------------------------------------------------------------//
+BenchmarkProblem
+buildCloudProblem( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                   const BenchmarkConfig &config, const bool matching_nodes )
+{
+    BenchmarkProblem problem;
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+    int inverse_rank = comm_size - comm_rank - 1;
+    int space_dim = 3;
+
+    // Build the domain cloud and put the data function on its points.
+    Teuchos::Array<double> coords;
+    Teuchos::Array<DataTransferKit::Entity> domain_points =
+        buildPointCloud( config, comm_rank, comm_size, config.cells,
+                         comm_rank, 3940, coords );
+    int num_domain = domain_points.size();
+    Teuchos::ArrayRCP<double> domain_data( num_domain );
+    for ( int n = 0; n < num_domain; ++n )
+    {
+        domain_data[n] = dataFunction( coords( 3 * n, 3 ) );
+    }
+    problem.domain_manager =
+        Teuchos::rcp( new DataTransferKit::BasicGeometryManager(
+            comm, space_dim, domain_points() ) );
+    problem.domain_space = problem.domain_manager->functionSpace();
+    problem.domain_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            domain_points(), 1, domain_data,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    problem.domain_vector = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+        problem.domain_field, problem.domain_space->entitySet() ) );
+
+    // Build the range cloud and compute the expected result on its points.
+    Teuchos::Array<DataTransferKit::Entity> range_points =
+        matching_nodes
+            ? buildPointCloud( config, inverse_rank, comm_size, config.cells,
+                               comm_rank, 3940, coords )
+            : buildPointCloud( config, inverse_rank, comm_size,
+                               config.cells + 1, comm_rank, 2389, coords );
+    int num_range = range_points.size();
+    Teuchos::ArrayRCP<double> range_data( num_range, 0.0 );
+    for ( int n = 0; n < num_range; ++n )
+    {
+        problem.range_ids.push_back( range_points[n].id() );
+        problem.range_gold.push_back( dataFunction( coords( 3 * n, 3 ) ) );
+    }
+    problem.range_manager =
+        Teuchos::rcp( new DataTransferKit::BasicGeometryManager(
+            comm, space_dim, range_points() ) );
+    problem.range_space = problem.range_manager->functionSpace();
+    problem.range_field =
+        Teuchos::rcp( new DataTransferKit::EntityCenteredField(
+            range_points(), 1, range_data,
+            DataTransferKit::EntityCenteredField::BLOCKED ) );
+    problem.range_vector = Teuchos::rcp( new DataTransferKit::FieldMultiVector(
+        problem.range_field, problem.range_space->entitySet() ) );
+
+    return problem;
+}
+
+//---------------------------------------------------------------------------//
+// Build the factory parameters of an operator.
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Teuchos::ParameterList>
+buildParameters( const std::string &map_type, const BenchmarkConfig &config )
+{
+    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
+
+    // Shared domain operators.
+    if ( "Consistent Interpolation" == map_type ||
+         "L2 Projection" == map_type )
+    {
+        parameters->set( "Map Type", map_type );
+        Teuchos::ParameterList &map_list = parameters->sublist( map_type );
+        if ( "L2 Projection" == map_type )
+        {
+            map_list.set( "Integration Order", 3 );
+        }
+        Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+        search_list.set( "Point Inclusion Tolerance", 1.0e-6 );
+    }
+
+    // Point cloud operators.
+    else
+    {
+        parameters->set( "Map Type", std::string( "Point Cloud" ) );
+        Teuchos::ParameterList &cloud_list =
+            parameters->sublist( "Point Cloud" );
+        cloud_list.set( "Map Type", map_type );
+        cloud_list.set( "Spatial Dimension", 3 );
+        if ( "Node To Node" == map_type )
+        {
+            cloud_list.set( "Matching Nodes", true );
+        }
+        else
+        {
+            cloud_list.set( "Basis Type", std::string( "Wendland" ) );
+            cloud_list.set( "Basis Order", 2 );
+            cloud_list.set( "Type of Search",
+                            std::string( "Nearest Neighbor" ) );
+            cloud_list.set( "Num Neighbors", config.num_neighbors );
+        }
+    }
+
+    return parameters;
+}
+
+//---------------------------------------------------------------------------//
+// Reduce a local time to its global min, max, and average and store them.
+//---------------------------------------------------------------------------//
+void reduceTime( const Teuchos::Comm<int> &comm, const double local_time,
+                 Teuchos::ParameterList &list )
+{
+    double min_time = 0.0;
+    double max_time = 0.0;
+    double sum_time = 0.0;
+    Teuchos::reduceAll( comm, Teuchos::REDUCE_MIN, local_time,
+                        Teuchos::ptrFromRef( min_time ) );
+    Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, local_time,
+                        Teuchos::ptrFromRef( max_time ) );
+    Teuchos::reduceAll( comm, Teuchos::REDUCE_SUM, local_time,
+                        Teuchos::ptrFromRef( sum_time ) );
+    list.set( "Min", min_time );
+    list.set( "Max", max_time );
+    list.set( "Average", sum_time / comm.getSize() );
+}
+
+//---------------------------------------------------------------------------//
+// Run an operator through setup and the applies and return its report.
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Teuchos::ParameterList>
+runOperator( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+             const std::string &map_type, const BenchmarkConfig &config,
+             const BenchmarkProblem &problem )
+{
+    // Create the operator and turn on its profiler.
+    DataTransferKit::MapOperatorFactory factory;
+    Teuchos::RCP<DataTransferKit::MapOperator> map_op = factory.create(
+        problem.domain_vector->getMap(), problem.range_vector->getMap(),
+        *buildParameters( map_type, config ) );
+    map_op->setProfilingEnabled( true );
+    map_op->setMemoryTracking( config.track_memory );
+
+    // Time the setup.
+    comm->barrier();
+    double start = Teuchos::Time::wallTime();
+    map_op->setup( problem.domain_space, problem.range_space );
+    double setup_time = Teuchos::Time::wallTime() - start;
+
+    // Time the applies.
+    comm->barrier();
+    start = Teuchos::Time::wallTime();
+    for ( int n = 0; n < config.applies; ++n )
+    {
+        map_op->apply( *problem.domain_vector, *problem.range_vector );
+    }
+    double apply_time =
+        ( Teuchos::Time::wallTime() - start ) / config.applies;
+
+    // Compute the error of the result.
+    double local_error = 0.0;
+    int num_range = problem.range_ids.size();
+    for ( int n = 0; n < num_range; ++n )
+    {
+        local_error = std::max(
+            local_error,
+            std::abs( problem.range_field->readFieldData(
+                          problem.range_ids[n], 0 ) -
+                      problem.range_gold[n] ) );
+    }
+    double max_error = 0.0;
+    Teuchos::reduceAll( *comm, Teuchos::REDUCE_MAX, local_error,
+                        Teuchos::ptrFromRef( max_error ) );
+
+    // Build the report.
+    Teuchos::RCP<Teuchos::ParameterList> report =
+        Teuchos::parameterList( map_type );
+    long long domain_size =
+        problem.domain_vector->getMap()->getGlobalNumElements();
+    long long range_size =
+        problem.range_vector->getMap()->getGlobalNumElements();
+    report->set( "Global Domain Size", domain_size );
+    report->set( "Global Range Size", range_size );
+    reduceTime( *comm, setup_time, report->sublist( "Setup Time" ) );
+    reduceTime( *comm, apply_time, report->sublist( "Apply Time" ) );
+    report->set( "Max Error", max_error );
+    report->set( "Profile", *map_op->profiler().globalReport( *comm ) );
+    return report;
+}
+
+//---------------------------------------------------------------------------//
+// Print the report of an operator.
+//---------------------------------------------------------------------------//
+void printReport( const Teuchos::ParameterList &report, std::ostream &os )
+{
+    const Teuchos::ParameterList &setup = report.sublist( "Setup Time" );
+    const Teuchos::ParameterList &apply = report.sublist( "Apply Time" );
+    os << "--------------------------------------------------" << std::endl;
+    os << report.name() << std::endl;
+    os << "Global domain size:  "
+       << report.get<long long>( "Global Domain Size" ) << std::endl;
+    os << "Global range size:   "
+       << report.get<long long>( "Global Range Size" ) << std::endl;
+    os << "Max error:           " << report.get<double>( "Max Error" )
+       << std::endl;
+    os << "Setup time (s) min/max/average: " << setup.get<double>( "Min" )
+       << " / " << setup.get<double>( "Max" ) << " / "
+       << setup.get<double>( "Average" ) << std::endl;
+    os << "Apply time (s) min/max/average: " << apply.get<double>( "Min" )
+       << " / " << apply.get<double>( "Max" ) << " / "
+       << apply.get<double>( "Average" ) << std::endl;
+
+    // Print the phase timers and counters.
+    const Teuchos::ParameterList &profile = report.sublist( "Profile" );
+    const Teuchos::ParameterList &timers = profile.sublist( "Timers" );
+    os << "Phase                                   Max (s)       Calls"
+       << "  Peak RSS (MB)" << std::endl;
+    for ( auto it = timers.begin(); it != timers.end(); ++it )
+    {
+        const std::string &name = timers.name( it );
+        const Teuchos::ParameterList &timer = timers.sublist( name );
+        os << std::left << std::setw( 40 ) << name << std::right
+           << std::setw( 12 ) << timer.get<double>( "Max Time" )
+           << std::setw( 12 ) << timer.get<int>( "Calls" );
+        if ( timer.isParameter( "Max Peak RSS" ) )
+        {
+            os << std::setw( 15 )
+               << timer.get<long long>( "Max Peak RSS" ) / 1048576.0;
+        }
+        os << std::endl;
+    }
+    const Teuchos::ParameterList &counters = profile.sublist( "Counters" );
+    for ( auto it = counters.begin(); it != counters.end(); ++it )
+    {
+        const std::string &name = counters.name( it );
+        const Teuchos::ParameterList &counter = counters.sublist( name );
+        os << std::left << std::setw( 52 ) << name << std::right
+           << std::setw( 12 ) << counter.get<long long>( "Total" )
+           << std::endl;
+    }
+    if ( profile.isSublist( "Memory" ) )
+    {
+        const Teuchos::ParameterList &memory = profile.sublist( "Memory" );
+        os << "Container                                      Max (MB)"
+           << "  Total (MB)" << std::endl;
+        for ( auto it = memory.begin(); it != memory.end(); ++it )
+        {
+            const std::string &name = memory.name( it );
+            const Teuchos::ParameterList &bytes = memory.sublist( name );
+            os << std::left << std::setw( 52 ) << name << std::right
+               << std::setw( 12 ) << bytes.get<long long>( "Max" ) / 1048576.0
+               << std::setw( 12 )
+               << bytes.get<long long>( "Total" ) / 1048576.0 << std::endl;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Benchmark driver.
+//---------------------------------------------------------------------------//
+int main( int argc, char *argv[] )
+{
+    // Setup communication.
+    Teuchos::GlobalMPISession mpiSession( &argc, &argv );
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // Read in command line options.
+    std::string scaling = "weak";
+    std::string distribution = "uniform";
+    std::string operators = "all";
+    std::string json_output_filename;
+    BenchmarkConfig config;
+    config.cells = 10;
+    config.applies = 10;
+    config.num_neighbors = 12;
+    config.track_memory = false;
+    config.tolerance = 1.0e-6;
+    Teuchos::CommandLineProcessor clp( false );
+    clp.setOption( "scaling", &scaling,
+                   "weak: fixed size per processor, strong: fixed global "
+                   "size" );
+    clp.setOption( "distribution", &distribution,
+                   "uniform or random mesh edges and point locations" );
+    clp.setOption( "cells", &config.cells,
+                   "Number of cells or points along each problem edge" );
+    clp.setOption( "applies", &config.applies,
+                   "Number of applies timed for each operator" );
+    clp.setOption( "neighbors", &config.num_neighbors,
+                   "Number of neighbors for the point cloud operators" );
+    clp.setOption( "operators", &operators,
+                   "Comma-separated list of operators to run (ci, l2, "
+                   "spline, mls, n2n) or all" );
+    clp.setOption( "track-memory", "no-track-memory", &config.track_memory,
+                   "Record container memory and peak RSS of each phase" );
+    clp.setOption( "tolerance", &config.tolerance,
+                   "Max error allowed for each operator before the benchmark "
+                   "fails" );
+    clp.setOption( "json-out-file", &json_output_filename,
+                   "Optional file the report is written to in JSON" );
+    if ( Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL !=
+         clp.parse( argc, argv ) )
+    {
+        return 1;
+    }
+    config.weak = ( "strong" != scaling );
+    config.random = ( "random" == distribution );
+    config.applies = std::max( config.applies, 1 );
+
+    // Get the operators to run.
+    typedef std::pair<std::string, std::string> OperatorName;
+    Teuchos::Array<OperatorName> all_operators;
+    all_operators.push_back( OperatorName( "ci", "Consistent Interpolation" ) );
+    all_operators.push_back( OperatorName( "l2", "L2 Projection" ) );
+    all_operators.push_back( OperatorName( "spline", "Spline Interpolation" ) );
+    all_operators.push_back(
+        OperatorName( "mls", "Moving Least Square Reconstruction" ) );
+    all_operators.push_back( OperatorName( "n2n", "Node To Node" ) );
+    std::string operator_list = "," + operators + ",";
+    Teuchos::Array<std::string> map_types;
+    for ( auto &op : all_operators )
+    {
+        if ( "all" == operators ||
+             std::string::npos != operator_list.find( "," + op.first + "," ) )
+        {
+            map_types.push_back( op.second );
+        }
+    }
+
+    // Print the configuration.
+    if ( 0 == comm_rank )
+    {
+        std::cout << "=================================================="
+                  << std::endl;
+        std::cout << "DTK " << ( config.weak ? "weak" : "strong" )
+                  << " scaling benchmark" << std::endl;
+        std::cout << "Number of processors:      " << comm_size << std::endl;
+        std::cout << "Distribution:              "
+                  << ( config.random ? "random" : "uniform" ) << std::endl;
+        std::cout << "Cells per edge:            " << config.cells
+                  << std::endl;
+        std::cout << "Number of applies:         " << config.applies
+                  << std::endl;
+    }
+
+    // Run the operators. The mesh problem is shared by the shared domain
+    // operators and the point cloud problem by the point cloud operators.
+    Teuchos::ParameterList benchmark_report( "Scaling Benchmark" );
+    benchmark_report.set( "Scaling", std::string( config.weak ? "weak"
+                                                              : "strong" ) );
+    benchmark_report.set( "Distribution", distribution );
+    benchmark_report.set( "Number of Processors", comm_size );
+    benchmark_report.set( "Cells Per Edge", config.cells );
+    benchmark_report.set( "Applies", config.applies );
+    Teuchos::RCP<BenchmarkProblem> mesh_problem;
+    Teuchos::RCP<BenchmarkProblem> cloud_problem;
+    Teuchos::RCP<BenchmarkProblem> matching_problem;
+    Teuchos::RCP<BenchmarkProblem> problem;
+    int num_failed = 0;
+    for ( auto &map_type : map_types )
+    {
+        // Get the problem for the operator.
+        if ( "Consistent Interpolation" == map_type ||
+             "L2 Projection" == map_type )
+        {
+            if ( Teuchos::is_null( mesh_problem ) )
+            {
+                mesh_problem = Teuchos::rcp(
+                    new BenchmarkProblem( buildMeshProblem( comm, config ) ) );
+            }
+            problem = mesh_problem;
+        }
+        else if ( "Node To Node" == map_type )
+        {
+            if ( Teuchos::is_null( matching_problem ) )
+            {
+                matching_problem = Teuchos::rcp( new BenchmarkProblem(
+                    buildCloudProblem( comm, config, true ) ) );
+            }
+            problem = matching_problem;
+        }
+        else
+        {
+            if ( Teuchos::is_null( cloud_problem ) )
+            {
+                cloud_problem = Teuchos::rcp( new BenchmarkProblem(
+                    buildCloudProblem( comm, config, false ) ) );
+            }
+            problem = cloud_problem;
+        }
+
+        // Run the operator and report the results.
+        Teuchos::RCP<Teuchos::ParameterList> report =
+            runOperator( comm, map_type, config, *problem );
+        if ( 0 == comm_rank )
+        {
+            printReport( *report, std::cout );
+        }
+        benchmark_report.set( map_type, *report );
+
+        // Check the error. The error is reduced so all processors agree.
+        if ( report->get<double>( "Max Error" ) > config.tolerance )
+        {
+            ++num_failed;
+            if ( 0 == comm_rank )
+            {
+                std::cout << "FAILED: max error exceeds the tolerance "
+                          << config.tolerance << std::endl;
+            }
+        }
+    }
+    benchmark_report.set( "Tolerance", config.tolerance );
+    benchmark_report.set( "Failed Operators", num_failed );
+
+    if ( 0 == comm_rank )
+    {
+        std::cout << "=================================================="
+                  << std::endl;
+
+        // Write the report.
+        if ( !json_output_filename.empty() )
+        {
+            std::ofstream json_file( json_output_filename );
+            DataTransferKit::Profiler::writeJSON( benchmark_report,
+                                                  json_file );
+        }
+    }
+
+    comm->barrier();
+
+    return ( 0 == num_failed ) ? 0 : 1;
+}
+
+//---------------------------------------------------------------------------//
+// end scaling_benchmark.cpp
+//---------------------------------------------------------------------------//
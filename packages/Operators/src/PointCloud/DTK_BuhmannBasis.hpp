@@ -85,6 +85,13 @@ class RadialBasisPolicy<BuhmannBasis<ORDER>>
         return basis.evaluateValue( radius, x );
     }
 
+    static inline void evaluateValues( const BuhmannBasis<ORDER> &basis,
+                                       const double radius, const double *x,
+                                       const int num, double *values )
+    {
+        evaluateRadialBasisValues( basis, radius, x, num, values );
+    }
+
     static inline double evaluateGradient( const BuhmannBasis<ORDER> &basis,
                                            const double radius, const double x )
     {
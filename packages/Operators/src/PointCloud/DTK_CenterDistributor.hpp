@@ -73,6 +73,41 @@ class CenterDistributor
                        const double radius,
                        Teuchos::Array<double> &target_decomp_source_centers );
 
+    // Constructor for the union of the neighborhoods of two sets of target
+    // centers. Source centers in both neighborhoods are sent once.
+    CenterDistributor( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+                       const Teuchos::ArrayView<const double> &source_centers,
+                       const Teuchos::ArrayView<const double> &target_centers_1,
+                       const double radius_1,
+                       const Teuchos::ArrayView<const double> &target_centers_2,
+                       const double radius_2,
+                       Teuchos::Array<double> &target_decomp_source_centers );
+
+    // Constructor from already expanded local target domains. Every process
+    // must give the same number of domains.
+    CenterDistributor(
+        const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+        const Teuchos::ArrayView<const double> &source_centers,
+        const Teuchos::ArrayView<const CloudDomain<DIM>> &target_domains,
+        Teuchos::Array<double> &target_decomp_source_centers );
+
+    // Compute the local target domain that contains the k-nearest source
+    // neighbors of every local target center.
+    static CloudDomain<DIM> nearestNeighborDomain(
+        const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+        const Teuchos::ArrayView<const double> &source_centers,
+        const Teuchos::ArrayView<const double> &target_centers,
+        const unsigned num_neighbors, const double radius_scale = 1.0 );
+
+    // Compute the local target domains of two sets of target centers. The
+    // source domains are gathered once for both sets.
+    static Teuchos::Array<CloudDomain<DIM>> nearestNeighborDomains(
+        const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+        const Teuchos::ArrayView<const double> &source_centers,
+        const Teuchos::ArrayView<const double> &target_centers_1,
+        const Teuchos::ArrayView<const double> &target_centers_2,
+        const unsigned num_neighbors, const double radius_scale = 1.0 );
+
     // Get the number of source centers that will be distributed from this
     // process.
     int getNumExports() const { return d_num_exports; }
@@ -88,9 +123,38 @@ class CenterDistributor
                      const Teuchos::ArrayView<T> &target_decomp_data ) const;
 
   private:
+    // Build the communication plan from the expanded local target domains
+    // and distribute the source centers.
+    void
+    build( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+           const Teuchos::ArrayView<const double> &source_centers,
+           const Teuchos::ArrayView<const CloudDomain<DIM>> &target_domains,
+           Teuchos::Array<double> &target_decomp_source_centers );
+
+    // Gather the source domains and the number of sources in each.
+    static void
+    gatherSourceDomains( const Teuchos::Comm<int> &comm,
+                         const Teuchos::ArrayView<const double> &source_centers,
+                         Teuchos::Array<CloudDomain<DIM>> &source_domains,
+                         Teuchos::Array<int> &source_counts );
+
+    // Compute the k-nearest neighbor domain of a set of target centers from
+    // the gathered source domains.
+    static CloudDomain<DIM> boundNeighborDomain(
+        const Teuchos::ArrayView<const double> &source_centers,
+        const Teuchos::ArrayView<const double> &target_centers,
+        const unsigned num_neighbors, const double radius_scale,
+        const Teuchos::Array<CloudDomain<DIM>> &source_domains,
+        const Teuchos::Array<int> &source_counts );
+
+    // Expand the domain of a local set of target centers by a search radius.
+    static CloudDomain<DIM>
+    expandedCloudDomain( const Teuchos::ArrayView<const double> &target_centers,
+                         const double radius );
+
     // Compute the domain of the local set of centers.
-    CloudDomain<DIM> localCloudDomain(
-        const Teuchos::ArrayView<const double> &target_centers ) const;
+    static CloudDomain<DIM>
+    localCloudDomain( const Teuchos::ArrayView<const double> &target_centers );
 
   private:
     // Distributor.
@@ -42,12 +42,15 @@
 #define DTK_CENTERDISTRIBUTOR_IMPL_HPP
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <utility>
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_CommHelpers.hpp>
 
 #include "DTK_DBC.hpp"
+#include "DTK_StaticSearchTree.hpp"
 
 namespace DataTransferKit
 {
@@ -63,25 +66,184 @@ CenterDistributor<DIM>::CenterDistributor(
     Teuchos::Array<double> &target_decomp_source_centers )
     : d_distributor( new Tpetra::Distributor( comm ) )
 {
-    DTK_REQUIRE( 0 == source_centers.size() % DIM );
     DTK_REQUIRE( 0 == target_centers.size() % DIM );
 
+    Teuchos::Array<CloudDomain<DIM>> target_domains(
+        1, expandedCloudDomain( target_centers, radius ) );
+    build( comm, source_centers, target_domains(),
+           target_decomp_source_centers );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor for the union of the neighborhoods of two sets of target
+ * centers.
+ *
+ * A source center is sent to a process if it is in the neighborhood of
+ * either set of target centers on that process. Source centers in both
+ * neighborhoods are only sent once so the two sets of targets can share the
+ * distributed sources.
+ */
+template <int DIM>
+CenterDistributor<DIM>::CenterDistributor(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const double> &target_centers_1,
+    const double radius_1,
+    const Teuchos::ArrayView<const double> &target_centers_2,
+    const double radius_2,
+    Teuchos::Array<double> &target_decomp_source_centers )
+    : d_distributor( new Tpetra::Distributor( comm ) )
+{
+    DTK_REQUIRE( 0 == target_centers_1.size() % DIM );
+    DTK_REQUIRE( 0 == target_centers_2.size() % DIM );
+
+    Teuchos::Array<CloudDomain<DIM>> target_domains( 2 );
+    target_domains[0] = expandedCloudDomain( target_centers_1, radius_1 );
+    target_domains[1] = expandedCloudDomain( target_centers_2, radius_2 );
+    build( comm, source_centers, target_domains(),
+           target_decomp_source_centers );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor from already expanded local target domains.
+ *
+ * \param target_domains The local target domains. Every process must give
+ * the same number of domains. A source center is sent to a process if it is
+ * in any of the domains of that process.
+ */
+template <int DIM>
+CenterDistributor<DIM>::CenterDistributor(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const CloudDomain<DIM>> &target_domains,
+    Teuchos::Array<double> &target_decomp_source_centers )
+    : d_distributor( new Tpetra::Distributor( comm ) )
+{
+    build( comm, source_centers, target_domains,
+           target_decomp_source_centers );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the local target domain that contains the k-nearest source
+ * neighbors of every local target center.
+ *
+ * The k-th neighbor distance of each target is bounded from above before
+ * any source centers are moved. If this process has at least k sources, the
+ * bound is the k-th distance to the local sources. Otherwise the bound comes
+ * from the gathered source domains and counts of all processes: the distance
+ * to the farthest corner of the nearest domains that together hold k
+ * sources. The returned domain is the bounding box of the balls of the
+ * bounded radius around the targets, so the halo follows the local point
+ * density instead of the extent of the partition.
+ *
+ * \param radius_scale Factor applied to each bound. Use this when the
+ * pairing searches a multiple of the k-th neighbor distance.
+ */
+template <int DIM>
+CloudDomain<DIM> CenterDistributor<DIM>::nearestNeighborDomain(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const double> &target_centers,
+    const unsigned num_neighbors, const double radius_scale )
+{
+    Teuchos::Array<CloudDomain<DIM>> source_domains;
+    Teuchos::Array<int> source_counts;
+    gatherSourceDomains( *comm, source_centers, source_domains,
+                         source_counts );
+    return boundNeighborDomain( source_centers, target_centers, num_neighbors,
+                                radius_scale, source_domains, source_counts );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the local target domains that contain the k-nearest source
+ * neighbors of two sets of target centers.
+ *
+ * This is the same as calling nearestNeighborDomain() for each set but the
+ * source domains and counts are only gathered once.
+ */
+template <int DIM>
+Teuchos::Array<CloudDomain<DIM>>
+CenterDistributor<DIM>::nearestNeighborDomains(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const double> &target_centers_1,
+    const Teuchos::ArrayView<const double> &target_centers_2,
+    const unsigned num_neighbors, const double radius_scale )
+{
+    Teuchos::Array<CloudDomain<DIM>> source_domains;
+    Teuchos::Array<int> source_counts;
+    gatherSourceDomains( *comm, source_centers, source_domains,
+                         source_counts );
+
+    Teuchos::Array<CloudDomain<DIM>> target_domains( 2 );
+    target_domains[0] =
+        boundNeighborDomain( source_centers, target_centers_1, num_neighbors,
+                             radius_scale, source_domains, source_counts );
+    target_domains[1] =
+        boundNeighborDomain( source_centers, target_centers_2, num_neighbors,
+                             radius_scale, source_domains, source_counts );
+    return target_domains;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Given a set of scalar values at the given source centers in the
+ * source decomposition, distribute them to the target decomposition.
+ */
+template <int DIM>
+template <class T>
+void CenterDistributor<DIM>::distribute(
+    const Teuchos::ArrayView<const T> &source_decomp_data,
+    const Teuchos::ArrayView<T> &target_decomp_data ) const
+{
+    DTK_REQUIRE( d_num_imports == target_decomp_data.size() );
+
+    // Unroll the source data to handle cases where single data points may
+    // have multiple destinations.
+    Teuchos::Array<unsigned>::const_iterator export_id_it;
+    Teuchos::Array<T> src_data( d_num_exports );
+    typename Teuchos::Array<T>::iterator src_it;
+    for ( export_id_it = d_export_ids.begin(), src_it = src_data.begin();
+          export_id_it != d_export_ids.end(); ++export_id_it, ++src_it )
+    {
+        DTK_CHECK( *export_id_it < source_decomp_data.size() );
+        *src_it = source_decomp_data[*export_id_it];
+    }
+
+    // Distribute.
+    Teuchos::ArrayView<const T> src_view = src_data();
+    d_distributor->doPostsAndWaits( src_view, 1, target_decomp_data );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Build the communication plan from the expanded local target domains
+ * and distribute the source centers.
+ */
+template <int DIM>
+void CenterDistributor<DIM>::build(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const CloudDomain<DIM>> &target_domains,
+    Teuchos::Array<double> &target_decomp_source_centers )
+{
+    DTK_REQUIRE( 0 == source_centers.size() % DIM );
+
     // Build the import/export data.
     Teuchos::Array<int> export_procs;
     {
-        // Compute the radius to expand the local domain with.
-        double radius_tol = 1.0e-2;
-        double radius_expand = radius * ( 1.0 + radius_tol );
-
-        // Gather the bounding domains for each target proc.
-        CloudDomain<DIM> local_target_domain =
-            localCloudDomain( target_centers );
-        local_target_domain.expand( radius_expand );
+        // Gather the bounding domains for each target proc. Every process
+        // contributes the same number of domains.
+        int num_domains = target_domains.size();
         Teuchos::Array<CloudDomain<DIM>> global_target_domains(
-            comm->getSize() );
+            num_domains * comm->getSize() );
         Teuchos::gatherAll<int, CloudDomain<DIM>>(
-            *comm, 1, &local_target_domain, global_target_domains.size(),
-            global_target_domains.getRawPtr() );
+            *comm, num_domains, target_domains.getRawPtr(),
+            global_target_domains.size(), global_target_domains.getRawPtr() );
 
         // Get those that are neighbors to this source proc.
         CloudDomain<DIM> local_source_domain =
@@ -94,23 +256,32 @@ CenterDistributor<DIM>::CenterDistributor(
                      global_target_domains[i] ) )
             {
                 neighbor_target_domains.push_back( global_target_domains[i] );
-                neighbor_ranks.push_back( i );
+                neighbor_ranks.push_back( i / num_domains );
             }
         }
         global_target_domains.clear();
 
-        // Find the procs to which the sources will be sent.
+        // Find the procs to which the sources will be sent. The domains of a
+        // proc are adjacent so a source is sent to a proc at most once.
         Teuchos::ArrayView<const double> source_point;
+        int num_neighbors = neighbor_target_domains.size();
         for ( unsigned source_id = 0; source_id < source_centers.size() / DIM;
               ++source_id )
         {
             source_point = source_centers.view( DIM * source_id, DIM );
-            for ( unsigned b = 0; b < neighbor_target_domains.size(); ++b )
+            for ( int b = 0; b < num_neighbors; ++b )
             {
                 if ( neighbor_target_domains[b].pointInDomain( source_point ) )
                 {
                     export_procs.push_back( neighbor_ranks[b] );
                     d_export_ids.push_back( source_id );
+
+                    // Skip the remaining domains of this proc.
+                    while ( b + 1 < num_neighbors &&
+                            neighbor_ranks[b + 1] == neighbor_ranks[b] )
+                    {
+                        ++b;
+                    }
                 }
             }
         }
@@ -125,7 +296,6 @@ CenterDistributor<DIM>::CenterDistributor(
 
     // Unroll the coordinates to handle cases where single source centers
     // may have multiple destinations.
-    Teuchos::Array<unsigned>::const_iterator export_id_it;
     Teuchos::Array<double> src_coords( d_num_exports * DIM );
     for ( int n = 0; n < d_num_exports; ++n )
     {
@@ -142,32 +312,183 @@ CenterDistributor<DIM>::CenterDistributor(
 
 //---------------------------------------------------------------------------//
 /*!
- * \brief Given a set of scalar values at the given source centers in the
- * source decomposition, distribute them to the target decomposition.
+ * \brief Gather the source domains and the number of sources in each.
  */
 template <int DIM>
-template <class T>
-void CenterDistributor<DIM>::distribute(
-    const Teuchos::ArrayView<const T> &source_decomp_data,
-    const Teuchos::ArrayView<T> &target_decomp_data ) const
+void CenterDistributor<DIM>::gatherSourceDomains(
+    const Teuchos::Comm<int> &comm,
+    const Teuchos::ArrayView<const double> &source_centers,
+    Teuchos::Array<CloudDomain<DIM>> &source_domains,
+    Teuchos::Array<int> &source_counts )
 {
-    DTK_REQUIRE( d_num_imports == target_decomp_data.size() );
+    DTK_REQUIRE( 0 == source_centers.size() % DIM );
 
-    // Unroll the source data to handle cases where single data points may
-    // have multiple destinations.
-    Teuchos::Array<unsigned>::const_iterator export_id_it;
-    Teuchos::Array<T> src_data( d_num_exports );
-    typename Teuchos::Array<T>::iterator src_it;
-    for ( export_id_it = d_export_ids.begin(), src_it = src_data.begin();
-          export_id_it != d_export_ids.end(); ++export_id_it, ++src_it )
+    int comm_size = comm.getSize();
+    CloudDomain<DIM> local_source_domain = localCloudDomain( source_centers );
+    source_domains.resize( comm_size );
+    Teuchos::gatherAll<int, CloudDomain<DIM>>(
+        comm, 1, &local_source_domain, comm_size,
+        source_domains.getRawPtr() );
+    int num_local_sources = source_centers.size() / DIM;
+    source_counts.resize( comm_size );
+    Teuchos::gatherAll<int, int>( comm, 1, &num_local_sources, comm_size,
+                                  source_counts.getRawPtr() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the k-nearest neighbor domain of a set of target centers
+ * from the gathered source domains.
+ *
+ * When the local sources cannot bound the k-th neighbor distance, the source
+ * domains that bound it are chosen once for all local targets: the nearest
+ * domains, by their farthest distance from the local target bounding box,
+ * that together hold at least k sources. Each target then only measures the
+ * distance to the farthest corner of the chosen domains.
+ */
+template <int DIM>
+CloudDomain<DIM> CenterDistributor<DIM>::boundNeighborDomain(
+    const Teuchos::ArrayView<const double> &source_centers,
+    const Teuchos::ArrayView<const double> &target_centers,
+    const unsigned num_neighbors, const double radius_scale,
+    const Teuchos::Array<CloudDomain<DIM>> &source_domains,
+    const Teuchos::Array<int> &source_counts )
+{
+    DTK_REQUIRE( 0 == source_centers.size() % DIM );
+    DTK_REQUIRE( 0 == target_centers.size() % DIM );
+    DTK_REQUIRE( radius_scale >= 1.0 );
+    DTK_REQUIRE( source_domains.size() == source_counts.size() );
+
+    int num_targets = target_centers.size() / DIM;
+    if ( 0 == num_targets )
     {
-        DTK_CHECK( *export_id_it < source_decomp_data.size() );
-        *src_it = source_decomp_data[*export_id_it];
+        return localCloudDomain( target_centers );
     }
 
-    // Distribute.
-    Teuchos::ArrayView<const T> src_view = src_data();
-    d_distributor->doPostsAndWaits( src_view, 1, target_decomp_data );
+    // Build a tree over the local sources if there are enough of them to
+    // bound the k-th neighbor distance locally.
+    int num_local_sources = source_centers.size() / DIM;
+    bool local_bound =
+        ( num_neighbors > 0 &&
+          num_local_sources >= static_cast<int>( num_neighbors ) );
+    Teuchos::RCP<NanoflannTree<DIM>> local_tree;
+    Teuchos::Array<int> bound_ranks;
+    if ( local_bound )
+    {
+        local_tree = Teuchos::rcp( new NanoflannTree<DIM>(
+            source_centers, NanoflannTree<DIM>::default_leaf_size ) );
+    }
+
+    // Otherwise choose the nearest source domains that together hold at
+    // least k sources. If there are fewer than k sources in total all of
+    // them are chosen.
+    else
+    {
+        CloudDomain<DIM> target_domain = localCloudDomain( target_centers );
+        Teuchos::ArrayView<const double> target_box = target_domain.bounds();
+        Teuchos::Array<std::pair<double, int>> farthest;
+        int comm_size = source_domains.size();
+        for ( int p = 0; p < comm_size; ++p )
+        {
+            if ( source_counts[p] > 0 )
+            {
+                Teuchos::ArrayView<const double> box =
+                    source_domains[p].bounds();
+                double dist2 = 0.0;
+                for ( int d = 0; d < DIM; ++d )
+                {
+                    double dx = std::max(
+                        std::abs( target_box[2 * d + 1] - box[2 * d] ),
+                        std::abs( box[2 * d + 1] - target_box[2 * d] ) );
+                    dist2 += dx * dx;
+                }
+                farthest.push_back( std::make_pair( dist2, p ) );
+            }
+        }
+        std::sort( farthest.begin(), farthest.end() );
+        unsigned num_found = 0;
+        for ( auto f = farthest.begin();
+              f != farthest.end() && num_found < num_neighbors; ++f )
+        {
+            bound_ranks.push_back( f->second );
+            num_found += source_counts[f->second];
+        }
+    }
+
+    double bounds[2 * DIM];
+    for ( int d = 0; d < DIM; ++d )
+    {
+        bounds[2 * d] = std::numeric_limits<double>::max();
+        bounds[2 * d + 1] = -std::numeric_limits<double>::max();
+    }
+    Teuchos::Array<unsigned> neighbors;
+    Teuchos::Array<double> neighbor_dists;
+    for ( int t = 0; t < num_targets; ++t )
+    {
+        const double *target = target_centers.getRawPtr() + DIM * t;
+        double radius = 0.0;
+
+        // Bound the k-th distance with the local sources.
+        if ( local_bound )
+        {
+            local_tree->nnSearch( target, num_neighbors, neighbors,
+                                  neighbor_dists );
+            radius = std::sqrt( neighbor_dists.back() );
+        }
+
+        // Otherwise bound it with the farthest corner of the chosen source
+        // domains.
+        else
+        {
+            double max_dist2 = 0.0;
+            for ( auto p : bound_ranks )
+            {
+                Teuchos::ArrayView<const double> box =
+                    source_domains[p].bounds();
+                double dist2 = 0.0;
+                for ( int d = 0; d < DIM; ++d )
+                {
+                    double dx = std::max( std::abs( target[d] - box[2 * d] ),
+                                          std::abs( target[d] -
+                                                    box[2 * d + 1] ) );
+                    dist2 += dx * dx;
+                }
+                max_dist2 = std::max( max_dist2, dist2 );
+            }
+            radius = std::sqrt( max_dist2 );
+        }
+
+        // Add the ball around the target to the domain with the same
+        // tolerance as a fixed radius.
+        radius *= radius_scale * ( 1.0 + 1.0e-2 );
+        for ( int d = 0; d < DIM; ++d )
+        {
+            bounds[2 * d] = std::min( bounds[2 * d], target[d] - radius );
+            bounds[2 * d + 1] =
+                std::max( bounds[2 * d + 1], target[d] + radius );
+        }
+    }
+
+    return CloudDomain<DIM>( bounds );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Expand the domain of a local set of target centers by a search
+ * radius.
+ */
+template <int DIM>
+CloudDomain<DIM> CenterDistributor<DIM>::expandedCloudDomain(
+    const Teuchos::ArrayView<const double> &target_centers,
+    const double radius )
+{
+    // Compute the radius to expand the local domain with.
+    double radius_tol = 1.0e-2;
+    double radius_expand = radius * ( 1.0 + radius_tol );
+
+    CloudDomain<DIM> domain = localCloudDomain( target_centers );
+    domain.expand( radius_expand );
+    return domain;
 }
 
 //---------------------------------------------------------------------------//
@@ -176,7 +497,7 @@ void CenterDistributor<DIM>::distribute(
  */
 template <int DIM>
 CloudDomain<DIM> CenterDistributor<DIM>::localCloudDomain(
-    const Teuchos::ArrayView<const double> &centers ) const
+    const Teuchos::ArrayView<const double> &centers )
 {
     Teuchos::Array<double> bounds( 2 * DIM, 0.0 );
 
@@ -55,6 +55,12 @@ class EuclideanDistance
   public:
     // Compute the Euclidean distance between the given set of coordinates.
     static double distance( const double *x1, const double *x2 );
+
+    // Compute the Euclidean distances between a point and a gathered set of
+    // points.
+    static void distances( const double *x1, const double *points,
+                           const unsigned *ids, const int num,
+                           double *dists );
 };
 
 //---------------------------------------------------------------------------//
@@ -86,6 +86,50 @@ inline double EuclideanDistance<3>::distance( const double *x1,
     return std::sqrt( xx * xx + xy * xy + xz * xz );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the Euclidean distances between a point and a gathered set
+ * of points.
+ *
+ * \param x1 The DIM coordinates of the point.
+ *
+ * \param points The interleaved coordinates of the point set.
+ *
+ * \param ids The local ids of the points in the set to compute the distance
+ * to.
+ *
+ * \param num The number of ids.
+ *
+ * \param dists The num distances.
+ *
+ * The squared distances are accumulated one dimension at a time so each pass
+ * is a unit-stride loop over the output that the compiler can vectorize.
+ */
+template <int DIM>
+inline void EuclideanDistance<DIM>::distances( const double *x1,
+                                               const double *points,
+                                               const unsigned *ids,
+                                               const int num, double *dists )
+{
+    for ( int i = 0; i < num; ++i )
+    {
+        double dx = x1[0] - points[DIM * ids[i]];
+        dists[i] = dx * dx;
+    }
+    for ( int d = 1; d < DIM; ++d )
+    {
+        for ( int i = 0; i < num; ++i )
+        {
+            double dx = x1[d] - points[DIM * ids[i] + d];
+            dists[i] += dx * dx;
+        }
+    }
+    for ( int i = 0; i < num; ++i )
+    {
+        dists[i] = std::sqrt( dists[i] );
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
@@ -179,11 +179,13 @@ LocalMLSProblem<Basis, DIM>::LocalMLSProblem(
             for ( int dim = 0; dim < DIM; ++dim )
                 s = std::max( s, std::abs( source_center_view[dim] -
                                            target_center[dim] ) );
-            // compute row weights
-            const double dist = EuclideanDistance<DIM>::distance(
-                target_center.getRawPtr(), source_center_view.getRawPtr() );
-            w[i] = BP::evaluateValue( basis, radius, dist );
         }
+        // compute row weights for the whole neighbor list at once
+        EuclideanDistance<DIM>::distances(
+            target_center.getRawPtr(), source_centers.getRawPtr(),
+            source_lids.getRawPtr(), num_sources, w.values() );
+        BP::evaluateValues( basis, radius, w.values(), num_sources,
+                            w.values() );
 
         if ( s == 0.0 )
             s = 1.0;
@@ -309,17 +311,19 @@ LocalMLSProblem<Basis, DIM>::LocalMLSProblem(
 
         // Make Phi.
         Teuchos::SerialDenseMatrix<int, double> phi( num_sources, num_sources );
-        Teuchos::ArrayView<const double> source_center_view;
-        double dist = 0.0;
+        Teuchos::Array<double> phi_diag( num_sources );
+        EuclideanDistance<DIM>::distances(
+            target_center.getRawPtr(), source_centers.getRawPtr(),
+            source_lids.getRawPtr(), num_sources, phi_diag.getRawPtr() );
+        BP::evaluateValues( basis, radius, phi_diag.getRawPtr(), num_sources,
+                            phi_diag.getRawPtr() );
         for ( int i = 0; i < num_sources; ++i )
         {
-            source_center_view = source_centers( DIM * source_lids[i], DIM );
-            dist = EuclideanDistance<DIM>::distance(
-                target_center.getRawPtr(), source_center_view.getRawPtr() );
-            phi( i, i ) = BP::evaluateValue( basis, radius, dist );
+            phi( i, i ) = phi_diag[i];
         }
 
         // Make P.
+        Teuchos::ArrayView<const double> source_center_view;
         Teuchos::Array<int> poly_ids( 1, 0 );
         int poly_id = 0;
         P.reshape( num_sources, poly_id + 1 );
@@ -47,6 +47,7 @@
 
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_CenterDistributor.hpp"
+#include "DTK_CouplingMatrixBuilder.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_LocalMLSProblem.hpp"
 #include "DTK_MovingLeastSquareReconstructionOperator.hpp"
@@ -201,44 +202,34 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::setupImpl(
     getNodeCoordsAndIds( range_space, d_range_entity_dim, target_centers,
                          target_support_ids );
 
-    // Calculate an approximate neighborhood distance for the local target
-    // centers. If using kNN, compute an approximation. If doing a radial
-    // search, use the radius. We will use these distances to expand the local
-    // bounding box to ensure we find all of our neighbors in parallel.
-    double target_proximity = 0.0;
+    // Gather the source centers that are in the proximity of the target
+    // centers on this proc. If using kNN, bound the distance to the k-th
+    // neighbor of each target before moving any sources so the halo follows
+    // the point density. If doing a radial search, use the radius.
+    Teuchos::Array<double> dist_sources;
     if ( d_use_knn )
     {
-        // Get the local bounding box.
-        Teuchos::Tuple<double, 6> local_box;
-        range_space->entitySet()->localBoundingBox( local_box );
-
-        // Calculate the largest span of the cardinal directions.
-        target_proximity = local_box[3] - local_box[0];
-        for ( int d = 1; d < DIM; ++d )
-        {
-            target_proximity =
-                std::max( target_proximity, local_box[d + 3] - local_box[d] );
-        }
-
-        // Take the proximity to be 10% of the largest distance.
-        target_proximity *= 0.1;
+        // The new search pairs by a multiple of the local spacing instead of
+        // by kNN.
+        typedef SplineInterpolationPairing<DIM> Pairing;
+        Teuchos::Array<CloudDomain<DIM>> target_domain(
+            1, d_use_qrcp
+                   ? CenterDistributor<DIM>::nearestNeighborDomain(
+                         comm, source_centers(), target_centers(),
+                         Pairing::spacingNeighbors(),
+                         Pairing::spacingExpansion() )
+                   : CenterDistributor<DIM>::nearestNeighborDomain(
+                         comm, source_centers(), target_centers(), d_knn ) );
+        d_dist = Teuchos::rcp( new CenterDistributor<DIM>(
+            comm, source_centers(), target_domain(), dist_sources ) );
     }
     else
     {
-        target_proximity = d_radius;
+        d_dist = Teuchos::rcp( new CenterDistributor<DIM>(
+            comm, source_centers(), target_centers(), d_radius,
+            dist_sources ) );
     }
-
-    // Gather the source centers that are in the proximity of the target
-    // centers on this proc.
-    Teuchos::Array<double> dist_sources;
-    // added by QC
-    d_dist = Teuchos::rcp(
-        new CenterDistributor<DIM>( comm, source_centers(), target_centers(),
-                                    target_proximity, dist_sources ) );
     CenterDistributor<DIM> &distributor = *d_dist;
-    // CenterDistributor<DIM> distributor( comm, source_centers(),
-    //                                     target_centers(), target_proximity,
-    //                                     dist_sources );
 
     // Gather the global ids of the source centers that are within the proximity
     // of
@@ -266,8 +257,7 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::setupImpl(
     // SupportId is unsigned long
     SupportId max_entries_per_row = *std::max_element(
         children_per_parent.begin(), children_per_parent.end() );
-    d_coupling_matrix = Teuchos::rcp( new Tpetra::CrsMatrix<Scalar, LO, GO>(
-        range_map, max_entries_per_row ) );
+    CouplingMatrixBuilder matrix_builder( domain_map, range_map );
     Teuchos::ArrayView<const double> target_view;
     Teuchos::Array<GO> indices( max_entries_per_row );
     Teuchos::ArrayView<const double> values;
@@ -304,11 +294,11 @@ void MovingLeastSquareReconstructionOperator<Basis, DIM>::setupImpl(
             {
                 indices[j] = dist_source_support_ids[pair_gids[j]];
             }
-            d_coupling_matrix->insertGlobalValues( target_support_ids[i],
-                                                   indices( 0, nn ), values );
+            matrix_builder.addRow( target_support_ids[i], indices( 0, nn ),
+                                   values );
         }
     }
-    d_coupling_matrix->fillComplete( domain_map, range_map );
+    d_coupling_matrix = matrix_builder.build();
     DTK_ENSURE( d_coupling_matrix->isFillComplete() );
 }
 
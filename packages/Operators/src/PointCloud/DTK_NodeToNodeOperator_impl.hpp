@@ -43,6 +43,7 @@
 
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_CenterDistributor.hpp"
+#include "DTK_CouplingMatrixBuilder.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_EuclideanDistance.hpp"
 #include "DTK_NodeToNodeOperator.hpp"
@@ -128,8 +129,7 @@ void NodeToNodeOperator<DIM>::setupImpl(
                                               true, 1, 0.0 );
 
     // Build the coupling matrix.
-    d_coupling_matrix =
-        Teuchos::rcp( new Tpetra::CrsMatrix<Scalar, LO, GO>( range_map, 1 ) );
+    CouplingMatrixBuilder matrix_builder( domain_map, range_map );
     Teuchos::Array<GO> indices( 1 );
     Teuchos::Array<double> values( 1, 1.0 );
     int nn = 0;
@@ -160,11 +160,11 @@ void NodeToNodeOperator<DIM>::setupImpl(
                 dist_source_support_ids[pairings.childCenterIds( i )[0]];
 
             // Populate the coupling matrix row.
-            d_coupling_matrix->insertGlobalValues( target_support_ids[i],
-                                                   indices(), values() );
+            matrix_builder.addRow( target_support_ids[i], indices(),
+                                   values() );
         }
     }
-    d_coupling_matrix->fillComplete( domain_map, range_map );
+    d_coupling_matrix = matrix_builder.build();
     DTK_ENSURE( d_coupling_matrix->isFillComplete() );
 }
 
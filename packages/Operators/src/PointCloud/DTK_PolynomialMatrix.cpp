@@ -54,6 +54,22 @@
 
 namespace DataTransferKit
 {
+//---------------------------------------------------------------------------//
+#ifdef HAVE_MPI
+namespace
+{
+// Get the raw MPI communicator.
+MPI_Comm rawMpiComm( const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
+{
+    Teuchos::RCP<const Teuchos::MpiComm<int>> mpi_comm =
+        Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>( comm );
+    Teuchos::RCP<const Teuchos::OpaqueWrapper<MPI_Comm>> opaque_comm =
+        mpi_comm->getRawMpiComm();
+    return ( *opaque_comm )();
+}
+} // end anonymous namespace
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Constructor.
@@ -67,7 +83,10 @@ PolynomialMatrix::PolynomialMatrix(
     , d_polynomial( polynomial )
     , d_domain_map( domain_map )
     , d_range_map( range_map )
-{ /* ... */
+{
+    // Build the transpose exporter once as the maps do not change.
+    d_exporter = Teuchos::rcp(
+        new Tpetra::Export<int, SupportId>( d_domain_map, d_range_map ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -87,15 +106,12 @@ void PolynomialMatrix::apply(
     int local_length = d_polynomial->getLocalLength();
     Teuchos::ArrayRCP<Teuchos::ArrayRCP<const double>> poly_view =
         d_polynomial->get2dView();
-    Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>> y_view = Y.get2dViewNonConst();
-
-    // Scale Y by beta.
-    Y.scale( beta );
 
     // No transpose.
     if ( Teuchos::NO_TRANS == mode )
     {
-        // Broadcast the polynomial components of X from the root rank.
+        // Start the broadcast of the polynomial components of X from the
+        // root rank.
         Teuchos::Array<double> x_poly( poly_size * num_vec, 0.0 );
         if ( 0 == d_comm()->getRank() )
         {
@@ -107,7 +123,22 @@ void PolynomialMatrix::apply(
                            &x_poly[n * poly_size] );
             }
         }
+#if defined( HAVE_MPI ) && MPI_VERSION >= 3
+        MPI_Request bcast_request;
+        MPI_Ibcast( x_poly.getRawPtr(), poly_size * num_vec, MPI_DOUBLE, 0,
+                    rawMpiComm( d_comm ), &bcast_request );
+#else
         Teuchos::broadcast( *d_comm, 0, x_poly() );
+#endif
+
+        // Scale Y by beta while the broadcast completes.
+        Y.scale( beta );
+        Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>> y_view =
+            Y.get2dViewNonConst();
+
+#if defined( HAVE_MPI ) && MPI_VERSION >= 3
+        MPI_Wait( &bcast_request, MPI_STATUS_IGNORE );
+#endif
 
         // Do the local mat-vec.
         int stride = 0;
@@ -129,17 +160,28 @@ void PolynomialMatrix::apply(
     // Transpose.
     else if ( Teuchos::TRANS == mode )
     {
-        // Make a work vector.
-        Tpetra::MultiVector<double, int, SupportId> work( Y.getMap(),
-                                                          Y.getNumVectors() );
+        // Scale Y by beta.
+        Y.scale( beta );
+        Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>> y_view =
+            Y.get2dViewNonConst();
+
+        // Reuse the work vector unless the number of vectors changed.
+        if ( Teuchos::is_null( d_work ) ||
+             d_work->getNumVectors() != Y.getNumVectors() )
+        {
+            d_work =
+                Teuchos::rcp( new Tpetra::MultiVector<double, int, SupportId>(
+                    d_range_map, Y.getNumVectors() ) );
+        }
 
-        // Export X to the polynomial decomposition.
-        Tpetra::Export<int, SupportId> exporter( X.getMap(), work.getMap() );
-        work.doExport( X, exporter, Tpetra::INSERT );
+        // Export X to the polynomial decomposition. Entries that do not
+        // receive data from X must be zero.
+        d_work->putScalar( 0.0 );
+        d_work->doExport( X, *d_exporter, Tpetra::INSERT );
 
         // Do the local mat-vec.
-        Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>> work_view =
-            work.get2dViewNonConst();
+        Teuchos::ArrayRCP<Teuchos::ArrayRCP<const double>> work_view =
+            d_work->get2dView();
         Teuchos::Array<double> products( poly_size * num_vec, 0.0 );
         int stride = 0;
         for ( int n = 0; n < num_vec; ++n )
@@ -157,13 +199,9 @@ void PolynomialMatrix::apply(
         // Reduce the results back to the root rank.
         Teuchos::Array<double> product_sums( poly_size * num_vec, 0.0 );
 #ifdef HAVE_MPI
-        Teuchos::RCP<const Teuchos::MpiComm<int>> mpi_comm =
-            Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>( d_comm );
-        Teuchos::RCP<const Teuchos::OpaqueWrapper<MPI_Comm>> opaque_comm =
-            mpi_comm->getRawMpiComm();
-        MPI_Comm raw_comm = ( *opaque_comm )();
         MPI_Reduce( products.getRawPtr(), product_sums.getRawPtr(),
-                    poly_size * num_vec, MPI_DOUBLE, MPI_SUM, 0, raw_comm );
+                    poly_size * num_vec, MPI_DOUBLE, MPI_SUM, 0,
+                    rawMpiComm( d_comm ) );
 #else
         product_sums = products;
 #endif
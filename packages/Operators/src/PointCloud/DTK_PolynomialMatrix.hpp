@@ -47,6 +47,7 @@
 #include <Teuchos_RCP.hpp>
 
 #include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Export.hpp>
 #include <Tpetra_Map.hpp>
 #include <Tpetra_MultiVector.hpp>
 #include <Tpetra_Operator.hpp>
@@ -57,6 +58,11 @@ namespace DataTransferKit
 /*!
  * \class PolynomialMatrix
  * \brief Vector apply implementation for polynomial matrices.
+ *
+ * The polynomial coefficients are owned by the root rank. The transpose
+ * exporter is built at construction and the work vector is kept between
+ * applies so repeated applies (e.g. within a Krylov solve) only perform the
+ * communication of the coefficients.
  */
 //---------------------------------------------------------------------------//
 class PolynomialMatrix : public Tpetra::Operator<double, int, SupportId>
@@ -117,6 +123,12 @@ class PolynomialMatrix : public Tpetra::Operator<double, int, SupportId>
 
     // Range map.
     Teuchos::RCP<const Tpetra::Map<int, SupportId>> d_range_map;
+
+    // Domain to range exporter for transpose applies.
+    Teuchos::RCP<const Tpetra::Export<int, SupportId>> d_exporter;
+
+    // Work vector in the range decomposition for transpose applies.
+    mutable Teuchos::RCP<Tpetra::MultiVector<double, int, SupportId>> d_work;
 };
 
 //---------------------------------------------------------------------------//
@@ -59,6 +59,23 @@ struct UndefinedRadialBasisPolicy
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Compute the values of a basis at a set of values. Basis policies
+ * implement evaluateValues() with this so the basis is only evaluated in one
+ * loop over the values.
+ */
+template <typename RadialBasis>
+inline void evaluateRadialBasisValues( const RadialBasis &basis,
+                                       const double radius, const double *x,
+                                       const int num, double *values )
+{
+    for ( int i = 0; i < num; ++i )
+    {
+        values[i] = basis.evaluateValue( radius, x[i] );
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \class RadialBasisPolicy \brief Traits/policy class for compactly supported
@@ -87,6 +104,14 @@ class RadialBasisPolicy
         return 0.0;
     }
 
+    //! Compute the values of the basis at a set of values.
+    static inline void evaluateValues( const RadialBasis &basis,
+                                       const double radius, const double *x,
+                                       const int num, double *values )
+    {
+        UndefinedRadialBasisPolicy<RadialBasis>::notDefined();
+    }
+
     //! Compute the gradient of the basis at the given value.
     static inline double evaluateGradient( const RadialBasis &basis,
                                            const double radius, const double x )
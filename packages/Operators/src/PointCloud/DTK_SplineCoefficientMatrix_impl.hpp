@@ -99,9 +99,8 @@ SplineCoefficientMatrix<Basis, DIM>::SplineCoefficientMatrix(
         operator_map, max_entries_per_row ) );
     Teuchos::Array<SupportId> M_indices( max_entries_per_row );
     Teuchos::Array<double> values( max_entries_per_row );
-    int dj = 0;
+    Teuchos::Array<double> dists( max_entries_per_row );
     Teuchos::ArrayView<const unsigned> source_neighbors;
-    double dist = 0.0;
     int nsn = 0;
     double radius = 0.0;
     for ( unsigned i = 0; i < num_source_centers; ++i )
@@ -112,17 +111,17 @@ SplineCoefficientMatrix<Basis, DIM>::SplineCoefficientMatrix(
         nsn = source_neighbors.size();
         radius = source_pairings.parentSupportRadius( i );
 
-        // Add the local basis contributions.
+        // Add the local basis contributions. The distances and basis values
+        // are computed for the whole neighbor list at once.
         for ( int j = 0; j < nsn; ++j )
         {
-            dj = DIM * source_neighbors[j];
             M_indices[j] = dist_source_center_gids[source_neighbors[j]];
-
-            dist = EuclideanDistance<DIM>::distance( &source_centers[di],
-                                                     &dist_source_centers[dj] );
-
-            values[j] = BP::evaluateValue( basis, radius, dist );
         }
+        EuclideanDistance<DIM>::distances(
+            &source_centers[di], dist_source_centers.getRawPtr(),
+            source_neighbors.getRawPtr(), nsn, dists.getRawPtr() );
+        BP::evaluateValues( basis, radius, dists.getRawPtr(), nsn,
+                            values.getRawPtr() );
         d_M->insertGlobalValues( source_center_gids[i], M_indices( 0, nsn ),
                                  values( 0, nsn ) );
     }
@@ -98,9 +98,8 @@ SplineEvaluationMatrix<Basis, DIM>::SplineEvaluationMatrix(
         range_map, max_entries_per_row ) );
     Teuchos::Array<SupportId> N_indices( max_entries_per_row );
     Teuchos::Array<double> values( max_entries_per_row );
-    int dj = 0;
+    Teuchos::Array<double> dists( max_entries_per_row );
     Teuchos::ArrayView<const unsigned> target_neighbors;
-    double dist = 0.0;
     int ntn = 0;
     double radius = 0.0;
     for ( unsigned i = 0; i < num_target_centers; ++i )
@@ -112,18 +111,17 @@ SplineEvaluationMatrix<Basis, DIM>::SplineEvaluationMatrix(
         ntn = target_neighbors.size();
         radius = target_pairings.parentSupportRadius( i );
 
-        // Add the local basis contributions.
+        // Add the local basis contributions. The distances and basis values
+        // are computed for the whole neighbor list at once.
         for ( int j = 0; j < ntn; ++j )
         {
-            dj = DIM * target_neighbors[j];
-
             N_indices[j] = dist_source_center_gids[target_neighbors[j]];
-
-            dist = EuclideanDistance<DIM>::distance( &target_centers[di],
-                                                     &dist_source_centers[dj] );
-
-            values[j] = BP::evaluateValue( basis, radius, dist );
         }
+        EuclideanDistance<DIM>::distances(
+            &target_centers[di], dist_source_centers.getRawPtr(),
+            target_neighbors.getRawPtr(), ntn, dists.getRawPtr() );
+        BP::evaluateValues( basis, radius, dists.getRawPtr(), ntn,
+                            values.getRawPtr() );
 
         d_N->insertGlobalValues( target_center_gids[i], N_indices( 0, ntn ),
                                  values( 0, ntn ) );
@@ -52,6 +52,7 @@
 #include <Tpetra_Map.hpp>
 
 #include <Thyra_LinearOpBase.hpp>
+#include <Thyra_LinearOpWithSolveBase.hpp>
 
 namespace DataTransferKit
 {
@@ -153,6 +154,10 @@ class SplineInterpolationOperator : virtual public MapOperator
     // Basis radius.
     double d_radius;
 
+    // Leaf size for the kD-tree over the distributed sources. The default
+    // leaf size is used if this is not positive.
+    int d_leaf;
+
     // Domain entity topological dimension. Default is 0 (vertex).
     int d_domain_entity_dim;
 
@@ -162,8 +167,15 @@ class SplineInterpolationOperator : virtual public MapOperator
     // Stratimikos parameter list.
     Teuchos::RCP<Teuchos::ParameterList> d_stratimikos_list;
 
-    // Coupling matrix.
-    Teuchos::RCP<const Thyra::LinearOpBase<double>> d_coupling_matrix;
+    // Prolongation operator S.
+    Teuchos::RCP<const Thyra::LinearOpBase<double>> d_prolongation;
+
+    // Solver for the interpolation matrix C = (P + M + P^T).
+    Teuchos::RCP<const Thyra::LinearOpWithSolveBase<double>>
+        d_coefficient_solver;
+
+    // Evaluation matrix B = (Q + N).
+    Teuchos::RCP<const Thyra::LinearOpBase<double>> d_evaluation_matrix;
 };
 
 //---------------------------------------------------------------------------//
@@ -45,11 +45,13 @@
 #include "DTK_CenterDistributor.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_PredicateComposition.hpp"
+#include "DTK_Profiler.hpp"
 #include "DTK_SplineCoefficientMatrix.hpp"
 #include "DTK_SplineEvaluationMatrix.hpp"
 #include "DTK_SplineInterpolationOperator.hpp"
 #include "DTK_SplineInterpolationPairing.hpp"
 #include "DTK_SplineProlongationOperator.hpp"
+#include "DTK_StaticSearchTree.hpp"
 
 #include <Teuchos_ArrayRCP.hpp>
 #include <Teuchos_CommHelpers.hpp>
@@ -60,9 +62,9 @@
 #include <BelosPseudoBlockGmresSolMgr.hpp>
 
 #include <Thyra_DefaultAddedLinearOp.hpp>
-#include <Thyra_DefaultMultipliedLinearOp.hpp>
 #include <Thyra_DefaultScaledAdjointLinearOp.hpp>
 #include <Thyra_LinearOpWithSolveFactoryHelpers.hpp>
+#include <Thyra_MultiVectorStdOps.hpp>
 #include <Thyra_TpetraThyraWrappers.hpp>
 
 #include <Stratimikos_DefaultLinearSolverBuilder.hpp>
@@ -80,6 +82,7 @@ SplineInterpolationOperator<Basis, DIM>::SplineInterpolationOperator(
     , d_use_knn( false )
     , d_knn( 0 )
     , d_radius( 0.0 )
+    , d_leaf( 0 )
     , d_domain_entity_dim( 0 )
     , d_range_entity_dim( 0 )
 {
@@ -126,6 +129,12 @@ SplineInterpolationOperator<Basis, DIM>::SplineInterpolationOperator(
     {
         d_range_entity_dim = parameters.get<int>( "Range Entity Dimension" );
     }
+
+    // Get the leaf size of the kD-tree.
+    if ( parameters.isParameter( "Leaf Size" ) )
+    {
+        d_leaf = parameters.get<int>( "Leaf Size" );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -238,7 +247,7 @@ void SplineInterpolationOperator<Basis, DIM>::setupImpl(
     Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_C =
         Thyra::add<Scalar>( thyra_PpM, thyra_P_T );
 
-    // Create parameters for stratimikos to setup the inverse operator.
+    // Create parameters for stratimikos to setup the solver.
     d_stratimikos_list = Teuchos::parameterList( "Stratimikos" );
 
     d_stratimikos_list->set( "Linear Solver Type", "Belos" );
@@ -256,22 +265,22 @@ void SplineInterpolationOperator<Basis, DIM>::setupImpl(
                         Belos::FinalSummary + Belos::StatusTestDetails );
     gmres_list.set( "Output Frequency", 1 );
 
-    // Create the inverse of the composite operator C.
+    // Create a solver for the composite operator C. The solve is done
+    // explicitly on apply so the iteration count can be recorded.
     Stratimikos::DefaultLinearSolverBuilder builder;
     builder.setParameterList( d_stratimikos_list );
     Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<Scalar>> factory =
         Thyra::createLinearSolveStrategy( builder );
-    Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_C_inv =
-        Thyra::inverse<Scalar>( *factory, thyra_C );
+    d_coefficient_solver =
+        Thyra::linearOpWithSolve<Scalar>( *factory, thyra_C );
 
     // Create the composite operator B = (Q + N);
-    Teuchos::RCP<const Thyra::LinearOpBase<Scalar>> thyra_B =
-        Thyra::add<Scalar>( thyra_Q, thyra_N );
+    d_evaluation_matrix = Thyra::add<Scalar>( thyra_Q, thyra_N );
 
-    // Create the coupling matrix A = (B * C^-1 * S).
-    d_coupling_matrix =
-        Thyra::multiply<Scalar>( thyra_B, thyra_C_inv, thyra_S );
-    DTK_ENSURE( Teuchos::nonnull( d_coupling_matrix ) );
+    // The coupling matrix is A = (B * C^-1 * S).
+    d_prolongation = thyra_S;
+    DTK_ENSURE( Teuchos::nonnull( d_coefficient_solver ) );
+    DTK_ENSURE( Teuchos::nonnull( d_evaluation_matrix ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -286,8 +295,31 @@ void SplineInterpolationOperator<Basis, DIM>::applyImpl(
         Thyra::createConstMultiVector<Scalar>( Teuchos::rcpFromRef( X ) );
     Teuchos::RCP<Thyra::MultiVectorBase<Scalar>> thyra_Y =
         Thyra::createMultiVector<Scalar>( Teuchos::rcpFromRef( Y ) );
-    d_coupling_matrix->apply( Thyra::NOTRANS, *thyra_X, thyra_Y.ptr(), alpha,
-                              beta );
+
+    // Prolong the domain data: SX = S * X.
+    int num_vecs = thyra_X->domain()->dim();
+    Teuchos::RCP<Thyra::MultiVectorBase<Scalar>> thyra_SX =
+        Thyra::createMembers( d_prolongation->range(), num_vecs );
+    d_prolongation->apply( Thyra::NOTRANS, *thyra_X, thyra_SX.ptr(), 1.0,
+                           0.0 );
+
+    // Solve for the spline coefficients: C * Z = SX.
+    Teuchos::RCP<Thyra::MultiVectorBase<Scalar>> thyra_Z =
+        Thyra::createMembers( d_coefficient_solver->domain(), num_vecs );
+    Thyra::assign( thyra_Z.ptr(), 0.0 );
+    Thyra::SolveStatus<Scalar> status = d_coefficient_solver->solve(
+        Thyra::NOTRANS, *thyra_SX, thyra_Z.ptr() );
+    if ( Teuchos::nonnull( status.extraParameters ) &&
+         status.extraParameters->isType<int>( "Belos/Iteration Count" ) )
+    {
+        Profiler::recordCount(
+            "Spline Interpolation: Krylov Iterations",
+            status.extraParameters->get<int>( "Belos/Iteration Count" ) );
+    }
+
+    // Evaluate the spline: Y = alpha * B * Z + beta * Y.
+    d_evaluation_matrix->apply( Thyra::NOTRANS, *thyra_Z, thyra_Y.ptr(),
+                                alpha, beta );
 }
 
 //---------------------------------------------------------------------------//
@@ -334,49 +366,49 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
     getNodeCoordsAndIds( range_space, d_range_entity_dim, target_centers,
                          target_support_ids );
 
-    // Calculate an approximate neighborhood distance for the local source
-    // centers. If using kNN, compute an approximation. If doing a radial
+    // Gather the source centers that are in the proximity of either the
+    // source or the target centers on this proc. Both pairings share the
+    // distributed sources so they are only communicated once. If using kNN,
+    // bound the distance to the k-th neighbor of each center before moving
+    // any sources so the halo follows the point density. If doing a radial
     // search, use the radius.
-    double source_proximity = 0.0;
+    Teuchos::Array<double> dist_sources;
+    Teuchos::RCP<CenterDistributor<DIM>> distributor_rcp;
     if ( d_use_knn )
     {
-        // Get the local bounding box.
-        Teuchos::Tuple<double, 6> local_box;
-        domain_space->entitySet()->localBoundingBox( local_box );
-
-        // Calculate the largest span of the cardinal directions.
-        source_proximity = local_box[3] - local_box[0];
-        for ( int d = 1; d < DIM; ++d )
-        {
-            source_proximity =
-                std::max( source_proximity, local_box[d + 3] - local_box[d] );
-        }
-
-        // Take the proximity to be 10% of the largest distance.
-        source_proximity *= 0.1;
+        Teuchos::Array<CloudDomain<DIM>> domains =
+            CenterDistributor<DIM>::nearestNeighborDomains(
+                comm, source_centers(), source_centers(), target_centers(),
+                d_knn );
+        distributor_rcp = Teuchos::rcp( new CenterDistributor<DIM>(
+            comm, source_centers(), domains(), dist_sources ) );
     }
     else
     {
-        source_proximity = d_radius;
+        distributor_rcp = Teuchos::rcp( new CenterDistributor<DIM>(
+            comm, source_centers(), source_centers(), d_radius,
+            target_centers(), d_radius, dist_sources ) );
     }
-
-    // Gather the source centers that are in the proximity of the source
-    // centers on this proc.
-    Teuchos::Array<double> dist_sources;
-    CenterDistributor<DIM> source_distributor( comm, source_centers(),
-                                               source_centers(),
-                                               source_proximity, dist_sources );
+    CenterDistributor<DIM> &distributor = *distributor_rcp;
 
     // Distribute the global source ids.
-    Teuchos::Array<GO> dist_source_support_ids(
-        source_distributor.getNumImports() );
+    Teuchos::Array<GO> dist_source_support_ids( distributor.getNumImports() );
     Teuchos::ArrayView<const GO> source_support_ids_view = source_support_ids();
     Teuchos::ArrayView<GO> dist_gids_view = dist_source_support_ids();
-    source_distributor.distribute( source_support_ids_view, dist_gids_view );
-
-    // Build the source/source pairings.
+    distributor.distribute( source_support_ids_view, dist_gids_view );
+
+    // Build a single tree over the distributed sources and the source/source
+    // and source/target pairings from it.
+    unsigned leaf_size = ( d_leaf > 0 )
+                             ? static_cast<unsigned>( d_leaf )
+                             : NanoflannTree<DIM>::default_leaf_size;
+    NanoflannTree<DIM> dist_source_tree( dist_sources(), leaf_size );
     SplineInterpolationPairing<DIM> source_pairings(
-        dist_sources(), source_centers(), d_use_knn, d_knn, d_radius );
+        dist_source_tree, dist_sources(), source_centers(), d_use_knn, d_knn,
+        d_radius );
+    SplineInterpolationPairing<DIM> target_pairings(
+        dist_source_tree, dist_sources(), target_centers(), d_use_knn, d_knn,
+        d_radius );
 
     // Build the basis.
     Teuchos::RCP<Basis> basis = BP::create();
@@ -396,52 +428,7 @@ void SplineInterpolationOperator<Basis, DIM>::buildConcreteOperators(
     P = C.getP();
     M = C.getM();
 
-    // Cleanup.
-    dist_source_support_ids.clear();
-
     // EVALUATION OPERATORS.
-    // Calculate an approximate neighborhood distance for the local target
-    // centers. If using kNN, compute an approximation. If doing a radial
-    // search, use the radius.
-    double target_proximity = 0.0;
-    if ( d_use_knn )
-    {
-        // Get the local bounding box.
-        Teuchos::Tuple<double, 6> local_box;
-        range_space->entitySet()->localBoundingBox( local_box );
-
-        // Calculate the largest span of the cardinal directions.
-        target_proximity = local_box[3] - local_box[0];
-        for ( int d = 1; d < DIM; ++d )
-        {
-            target_proximity =
-                std::max( target_proximity, local_box[d + 3] - local_box[d] );
-        }
-
-        // Take the proximity to be 10% of the largest distance.
-        target_proximity *= 0.1;
-    }
-    else
-    {
-        target_proximity = d_radius;
-    }
-
-    // Gather the source centers that are in the proximity of the target
-    // centers on this proc.
-    CenterDistributor<DIM> target_distributor( comm, source_centers(),
-                                               target_centers(),
-                                               target_proximity, dist_sources );
-
-    // Distribute the global source ids.
-    dist_source_support_ids.resize( target_distributor.getNumImports() );
-    source_support_ids_view = source_support_ids();
-    dist_gids_view = dist_source_support_ids();
-    target_distributor.distribute( source_support_ids_view, dist_gids_view );
-
-    // Build the source/target pairings.
-    SplineInterpolationPairing<DIM> target_pairings(
-        dist_sources(), target_centers(), d_use_knn, d_knn, d_radius );
-
     // Build the transformation operators.
     SplineEvaluationMatrix<Basis, DIM> B(
         prolongated_map, range_map, target_centers(), target_support_ids(),
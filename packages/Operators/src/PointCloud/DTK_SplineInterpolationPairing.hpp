@@ -44,6 +44,7 @@
 #include <Teuchos_Array.hpp>
 #include <Teuchos_ArrayView.hpp>
 
+#include <DTK_StaticSearchTree.hpp>
 #include <DTK_Types.hpp>
 
 namespace DataTransferKit
@@ -71,6 +72,27 @@ class SplineInterpolationPairing
         const bool use_knn, const unsigned num_neighbors, const double radius,
         const int leaf = 0, const bool use_new_search = false );
 
+    // Constructor with a kD-tree already built over the child centers. This
+    // allows several sets of parent centers to share one tree.
+    SplineInterpolationPairing(
+        const NanoflannTree<DIM> &child_tree,
+        const Teuchos::ArrayView<const double> &child_centers,
+        const Teuchos::ArrayView<const double> &parent_centers,
+        const bool use_knn, const unsigned num_neighbors, const double radius,
+        const bool use_new_search = false );
+
+    // Number of nearest children the new search uses to estimate the local
+    // spacing of a parent.
+    static unsigned spacingNeighbors()
+    {
+        const static unsigned SMALL_KNN[3] = {3, 6, 7};
+        return SMALL_KNN[DIM - 1];
+    }
+
+    // Factor by which the new search expands the local spacing to get the
+    // search radius of a parent.
+    static double spacingExpansion() { return 5.1; }
+
     // Given a parent center local id get the ids of the child centers within
     // the given radius.
     Teuchos::ArrayView<const unsigned>
@@ -97,6 +119,14 @@ class SplineInterpolationPairing
     inline const Teuchos::Array<double> &hs() const { return d_hs; }
     // added QC
 
+  private:
+    // Search the tree for the children of each parent.
+    void pair( const NanoflannTree<DIM> &child_tree,
+               const Teuchos::ArrayView<const double> &child_centers,
+               const Teuchos::ArrayView<const double> &parent_centers,
+               const bool use_knn, const unsigned num_neighbors,
+               const double radius, const bool use_new_search );
+
   private:
     // Pairings.
     Teuchos::Array<Teuchos::Array<unsigned>> d_pairings;
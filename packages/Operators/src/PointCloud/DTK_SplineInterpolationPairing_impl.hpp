@@ -66,13 +66,48 @@ SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
     DTK_REQUIRE( 0 == parent_centers.size() % DIM );
 
     // Setup the kD-tree
-    unsigned leaf_size = 30;
+    unsigned leaf_size = NanoflannTree<DIM>::default_leaf_size;
     if ( leaf > 0 )
     {
         leaf_size = (unsigned)leaf;
     }
     NanoflannTree<DIM> tree( child_centers, leaf_size );
 
+    pair( tree, child_centers, parent_centers, use_knn, num_neighbors, radius,
+          use_new_search );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Constructor with a kD-tree already built over the child centers.
+ */
+template <int DIM>
+SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
+    const NanoflannTree<DIM> &child_tree,
+    const Teuchos::ArrayView<const double> &child_centers,
+    const Teuchos::ArrayView<const double> &parent_centers, const bool use_knn,
+    const unsigned num_neighbors, const double radius,
+    const bool use_new_search )
+{
+    DTK_REQUIRE( 0 == child_centers.size() % DIM );
+    DTK_REQUIRE( 0 == parent_centers.size() % DIM );
+
+    pair( child_tree, child_centers, parent_centers, use_knn, num_neighbors,
+          radius, use_new_search );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Search the tree for the children of each parent.
+ */
+template <int DIM>
+void SplineInterpolationPairing<DIM>::pair(
+    const NanoflannTree<DIM> &tree,
+    const Teuchos::ArrayView<const double> &child_centers,
+    const Teuchos::ArrayView<const double> &parent_centers, const bool use_knn,
+    const unsigned num_neighbors, const double radius,
+    const bool use_new_search )
+{
     // Allocate arrays
     unsigned num_parents = parent_centers.size() / DIM;
     d_pairings.resize( num_parents );
@@ -84,8 +119,7 @@ SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
     // TODO this part should be moved in the kd-tree
     // we first search for a small neighborhood by KNN, the following defines
     // the table that estimate the one-ring neighbor
-    const static int SMALL_KNN[3] = {3, 6, 7};
-    const static int small_knn = SMALL_KNN[DIM - 1];
+    const unsigned small_knn = spacingNeighbors();
     // then we use the maximal length to define radius that expand by 5 times
     // to query the mesh
     // NOTE that this still complete resolves issues with stretched grids...
@@ -104,7 +138,8 @@ SplineInterpolationPairing<DIM>::SplineInterpolationPairing(
                     h, EuclideanDistance<DIM>::distance(
                            parent_centers( DIM * i, DIM ).getRawPtr(),
                            child_centers( DIM * *itr, DIM ).getRawPtr() ) );
-            d_radii[i] = 5.1 * h; // expand 5times+10%, might be too large!
+            // expand 5times+10%, might be too large!
+            d_radii[i] = spacingExpansion() * h;
             d_pairings[i] =
                 tree.radiusSearch( parent_centers( DIM * i, DIM ), d_radii[i] );
 
@@ -85,6 +85,13 @@ class RadialBasisPolicy<WuBasis<ORDER>>
         return basis.evaluateValue( radius, x );
     }
 
+    static inline void evaluateValues( const WuBasis<ORDER> &basis,
+                                       const double radius, const double *x,
+                                       const int num, double *values )
+    {
+        evaluateRadialBasisValues( basis, radius, x, num, values );
+    }
+
     static inline double evaluateGradient( const WuBasis<ORDER> &basis,
                                            const double radius, const double x )
     {
@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_CachedDistributor.cpp
+ * \author Stuart R. Slattery
+ * \brief CachedDistributor definition.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <iterator>
+
+#include "DTK_CachedDistributor.hpp"
+#include "DTK_DBC.hpp"
+
+#include <Teuchos_CommHelpers.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+// Constructor.
+CachedDistributor::CachedDistributor(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
+    : d_comm( comm )
+    , d_num_imports( 0 )
+    , d_plan_reused( false )
+    , d_pattern_reused( false )
+{
+    DTK_REQUIRE( Teuchos::nonnull( d_comm ) );
+}
+
+//---------------------------------------------------------------------------//
+// Create the plan from the destination rank of each export.
+std::size_t CachedDistributor::createFromSends(
+    const Teuchos::ArrayView<const int> &export_ranks )
+{
+    // Get the destination ranks and the number of exports to each.
+    Teuchos::Array<int> sorted_ranks( export_ranks.begin(),
+                                      export_ranks.end() );
+    std::sort( sorted_ranks.begin(), sorted_ranks.end() );
+    Teuchos::Array<int> dest_ranks;
+    Teuchos::Array<int> dest_counts;
+    for ( auto rank : sorted_ranks )
+    {
+        if ( dest_ranks.empty() || dest_ranks.back() != rank )
+        {
+            dest_ranks.push_back( rank );
+            dest_counts.push_back( 0 );
+        }
+        ++dest_counts.back();
+    }
+
+    // Check if the local destinations and the local export ranks are
+    // unchanged. Both are checked on every process with a single reduction.
+    int local_same[2];
+    local_same[0] =
+        Teuchos::nonnull( d_distributor ) && ( dest_ranks == d_dest_ranks );
+    local_same[1] = local_same[0] &&
+                    ( export_ranks.size() == d_export_ranks.size() ) &&
+                    std::equal( export_ranks.begin(), export_ranks.end(),
+                                d_export_ranks.begin() );
+    int global_same[2] = {0, 0};
+    Teuchos::reduceAll<int, int>( *d_comm, Teuchos::REDUCE_MIN, 2, local_same,
+                                  global_same );
+    d_pattern_reused = ( 1 == global_same[0] );
+    d_plan_reused = ( 1 == global_same[1] );
+
+    // Reuse the plan if nothing changed.
+    if ( d_plan_reused )
+    {
+        Profiler::recordCount( "Distributor: Plans Reused", 1 );
+        return d_num_imports;
+    }
+
+    // If only the number of exports to each destination changed then the
+    // neighbors are known. Exchange the new counts with them and build the
+    // plan without the handshake.
+    d_distributor = Teuchos::rcp( new Tpetra::Distributor( d_comm ) );
+    if ( d_pattern_reused )
+    {
+        int comm_rank = d_comm->getRank();
+        int num_sources = d_source_ranks.size();
+        Teuchos::Array<int> source_counts( num_sources, 0 );
+        Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<int>>> requests;
+        for ( int i = 0; i < num_sources; ++i )
+        {
+            if ( comm_rank == d_source_ranks[i] )
+            {
+                auto self = std::lower_bound( dest_ranks.begin(),
+                                              dest_ranks.end(), comm_rank );
+                DTK_CHECK( self != dest_ranks.end() && *self == comm_rank );
+                source_counts[i] =
+                    dest_counts[std::distance( dest_ranks.begin(), self )];
+            }
+            else
+            {
+                requests.push_back( Teuchos::ireceive<int, int>(
+                    *d_comm,
+                    Teuchos::arcp( source_counts.getRawPtr() + i, 0, 1,
+                                   false ),
+                    d_source_ranks[i] ) );
+            }
+        }
+        int num_dests = dest_ranks.size();
+        for ( int j = 0; j < num_dests; ++j )
+        {
+            if ( comm_rank != dest_ranks[j] )
+            {
+                requests.push_back( Teuchos::isend<int, int>(
+                    *d_comm,
+                    Teuchos::arcp<const int>( dest_counts.getRawPtr() + j, 0,
+                                              1, false ),
+                    dest_ranks[j] ) );
+            }
+        }
+        Teuchos::waitAll( *d_comm, requests() );
+
+        Teuchos::Array<int> remote_ranks;
+        for ( int i = 0; i < num_sources; ++i )
+        {
+            remote_ranks.insert( remote_ranks.end(), source_counts[i],
+                                 d_source_ranks[i] );
+        }
+        d_distributor->createFromSendsAndRecvs( export_ranks,
+                                                remote_ranks() );
+        d_num_imports = remote_ranks.size();
+        Profiler::recordCount( "Distributor: Plans Updated", 1 );
+    }
+
+    // Otherwise build a new plan with the handshake.
+    else
+    {
+        d_num_imports = d_distributor->createFromSends( export_ranks );
+        d_dest_ranks = dest_ranks;
+        Teuchos::ArrayView<const int> procs_from =
+            d_distributor->getProcsFrom();
+        d_source_ranks.assign( procs_from.begin(), procs_from.end() );
+        std::sort( d_source_ranks.begin(), d_source_ranks.end() );
+        Profiler::recordCount( "Distributor: Plans Created", 1 );
+    }
+
+    d_export_ranks.assign( export_ranks.begin(), export_ranks.end() );
+    return d_num_imports;
+}
+
+//---------------------------------------------------------------------------//
+// Get the current plan.
+Tpetra::Distributor &CachedDistributor::distributor() const
+{
+    DTK_REQUIRE( Teuchos::nonnull( d_distributor ) );
+    return *d_distributor;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_CachedDistributor.cpp
+//---------------------------------------------------------------------------//
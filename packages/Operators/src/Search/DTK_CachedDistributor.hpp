@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_CachedDistributor.hpp
+ * \author Stuart R. Slattery
+ * \brief CachedDistributor declaration.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_CACHEDDISTRIBUTOR_HPP
+#define DTK_CACHEDDISTRIBUTOR_HPP
+
+#include "DTK_Profiler.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Tpetra_Distributor.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class CachedDistributor
+ * \brief A Tpetra::Distributor plan that is kept between communications.
+ *
+ * Creating a distributor plan from a list of export ranks requires a
+ * collective handshake to determine the number of imports from each
+ * process. When the same pair of parallel decompositions is communicated
+ * repeatedly the neighbor pattern of the plan is often unchanged. This class
+ * keys the plan on the set of destination ranks and the number of exports
+ * to each. A single reduction decides if the destination sets and the
+ * export ranks are unchanged on every process. If so the plan (and its
+ * lazily-constructed reverse plan) is reused. If only the counts changed the
+ * new counts are exchanged with the known neighbors and the plan is rebuilt
+ * without the handshake.
+ */
+//---------------------------------------------------------------------------//
+class CachedDistributor
+{
+  public:
+    // Constructor.
+    explicit CachedDistributor(
+        const Teuchos::RCP<const Teuchos::Comm<int>> &comm );
+
+    /*!
+     * \brief Create the plan from the destination rank of each export. The
+     * existing plan is reused if the export ranks on every process are
+     * unchanged since the last call and rebuilt from the known neighbors if
+     * only the number of exports to each destination changed. This is a
+     * collective operation.
+     *
+     * \return The number of imports.
+     */
+    std::size_t
+    createFromSends( const Teuchos::ArrayView<const int> &export_ranks );
+
+    /*!
+     * \brief Return true if the last call to createFromSends reused the
+     * existing plan.
+     */
+    bool planReused() const { return d_plan_reused; }
+
+    /*!
+     * \brief Return true if the last call to createFromSends kept the
+     * neighbor pattern of the existing plan.
+     */
+    bool patternReused() const { return d_pattern_reused; }
+
+    /*!
+     * \brief Get the number of imports in the current plan.
+     */
+    std::size_t getNumImports() const { return d_num_imports; }
+
+    /*!
+     * \brief Get the current plan for communication. The reverse plan is
+     * available through the distributor and is kept with it.
+     */
+    Tpetra::Distributor &distributor() const;
+
+    /*!
+     * \brief Execute the current plan. The number of bytes sent and received
+     * are recorded in the active profiler.
+     */
+    template <class Packet>
+    void doPostsAndWaits( const Teuchos::ArrayView<const Packet> &exports,
+                          const std::size_t num_packets,
+                          const Teuchos::ArrayView<Packet> &imports ) const
+    {
+        distributor().doPostsAndWaits( exports, num_packets, imports );
+        Profiler::recordCount( "Distributor: Bytes Sent",
+                               exports.size() * sizeof( Packet ) );
+        Profiler::recordCount( "Distributor: Bytes Received",
+                               imports.size() * sizeof( Packet ) );
+    }
+
+  private:
+    // Communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> d_comm;
+
+    // Current plan.
+    Teuchos::RCP<Tpetra::Distributor> d_distributor;
+
+    // Export ranks of the current plan.
+    Teuchos::Array<int> d_export_ranks;
+
+    // Sorted destination ranks of the current plan.
+    Teuchos::Array<int> d_dest_ranks;
+
+    // Sorted source ranks of the current plan.
+    Teuchos::Array<int> d_source_ranks;
+
+    // Number of imports in the current plan.
+    std::size_t d_num_imports;
+
+    // True if the last plan creation reused the existing plan.
+    bool d_plan_reused;
+
+    // True if the last plan creation kept the existing neighbor pattern.
+    bool d_pattern_reused;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_CACHEDDISTRIBUTOR_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_CachedDistributor.hpp
+//---------------------------------------------------------------------------//
@@ -41,6 +41,7 @@
 #include <limits>
 
 #include "DTK_CoarseGlobalSearch.hpp"
+#include "DTK_Profiler.hpp"
 
 #include <Teuchos_CommHelpers.hpp>
 
@@ -107,6 +108,25 @@ void CoarseGlobalSearch::search(
     Teuchos::Array<int> &range_owner_ranks,
     Teuchos::Array<double> &range_centroids ) const
 {
+    CachedDistributor distributor( d_comm );
+    search( range_iterator, range_local_map, parameters, distributor,
+            range_entity_ids, range_owner_ranks, range_centroids );
+}
+
+//---------------------------------------------------------------------------//
+// Redistribute a set of range entity centroid coordinates with their owner
+// ranks to the owning domain process using a communication plan that is kept
+// by the caller between searches.
+void CoarseGlobalSearch::search(
+    const EntityIterator &range_iterator,
+    const Teuchos::RCP<EntityLocalMap> &range_local_map,
+    const Teuchos::ParameterList &parameters, CachedDistributor &distributor,
+    Teuchos::Array<EntityId> &range_entity_ids,
+    Teuchos::Array<int> &range_owner_ranks,
+    Teuchos::Array<double> &range_centroids ) const
+{
+    ScopedTimer timer( "Coarse Global Search" );
+
     // Assemble the local range bounding box.
     Teuchos::Tuple<double, 6> range_box;
     assembleBoundingBox( range_iterator, range_box );
@@ -124,51 +144,42 @@ void CoarseGlobalSearch::search(
         }
     }
 
-    // For each local range entity, find the neighbors we should send it to.
-    int num_neighbors = neighbor_boxes.size();
-    EntityIterator range_begin = range_iterator.begin();
-    EntityIterator range_end = range_iterator.end();
-    EntityIterator range_it;
+    // For each local range entity, find the neighbors we should send it
+    // to. Dispatch once on the spatial dimension so the per-entity work uses
+    // fixed-size coordinates.
     Teuchos::Array<EntityId> send_ids;
     Teuchos::Array<int> send_ranks;
     Teuchos::Array<double> send_centroids;
-    Teuchos::Array<double> centroid( d_space_dim );
-    bool found_entity = false;
-    for ( range_it = range_begin; range_it != range_end; ++range_it )
+    switch ( d_space_dim )
     {
-        // Get the centroid.
-        range_local_map->centroid( *range_it, centroid() );
-
-        // Check the neighbors.
-        found_entity = false;
-        for ( int n = 0; n < num_neighbors; ++n )
-        {
-            // If the centroid is in the box, add it to the send list.
-            if ( pointInBox( centroid(), neighbor_boxes[n], d_inclusion_tol ) )
-            {
-                found_entity = true;
-                send_ids.push_back( range_it->id() );
-                send_ranks.push_back( neighbor_ranks[n] );
-                for ( int d = 0; d < d_space_dim; ++d )
-                {
-                    send_centroids.push_back( centroid[d] );
-                }
-            }
-        }
-
-        // If we are tracking missed range entities, add the entity to the
-        // list.
-        if ( d_track_missed_range_entities && !found_entity )
-        {
-            d_missed_range_entity_ids.push_back( range_it->id() );
-        }
+    case 1:
+        findDestinations<1>( range_iterator, range_local_map, neighbor_ranks,
+                             neighbor_boxes, send_ids, send_ranks,
+                             send_centroids );
+        break;
+    case 2:
+        findDestinations<2>( range_iterator, range_local_map, neighbor_ranks,
+                             neighbor_boxes, send_ids, send_ranks,
+                             send_centroids );
+        break;
+    case 3:
+        findDestinations<3>( range_iterator, range_local_map, neighbor_ranks,
+                             neighbor_boxes, send_ids, send_ranks,
+                             send_centroids );
+        break;
+    default:
+        DTK_INSIST( false );
     }
     int num_send = send_ranks.size();
     Teuchos::Array<int> range_ranks( num_send, d_comm->getRank() );
 
-    // Create a distributor.
-    Tpetra::Distributor distributor( d_comm );
+    // Create the communication plan. The previous plan is reused if the
+    // send pattern is unchanged.
     int num_range_import = distributor.createFromSends( send_ranks() );
+    Profiler::recordCount( "Coarse Global Search: Range Entities Sent",
+                           num_send );
+    Profiler::recordCount( "Coarse Global Search: Range Entities Received",
+                           num_range_import );
 
     // Redistribute the range entity ids.
     Teuchos::ArrayView<const EntityId> send_ids_view = send_ids();
@@ -185,6 +196,21 @@ void CoarseGlobalSearch::search(
     Teuchos::ArrayView<const double> send_centroids_view = send_centroids();
     distributor.doPostsAndWaits( send_centroids_view, d_space_dim,
                                  range_centroids() );
+
+    // Record the memory of the send buffers and the redistributed range
+    // data.
+    if ( Profiler::trackingMemory() )
+    {
+        Profiler::recordMemory( "Coarse Global Search: Send Buffers",
+                                containerBytes( send_ids ) +
+                                    containerBytes( send_ranks ) +
+                                    containerBytes( send_centroids ) +
+                                    containerBytes( range_ranks ) );
+        Profiler::recordMemory( "Coarse Global Search: Range Centroids",
+                                containerBytes( range_entity_ids ) +
+                                    containerBytes( range_owner_ranks ) +
+                                    containerBytes( range_centroids ) );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -197,6 +223,55 @@ CoarseGlobalSearch::getMissedRangeEntityIds() const
     return d_missed_range_entity_ids();
 }
 
+//---------------------------------------------------------------------------//
+// Find the domains to which each range entity centroid of a fixed spatial
+// dimension should be sent.
+template <int DIM>
+void CoarseGlobalSearch::findDestinations(
+    const EntityIterator &range_iterator,
+    const Teuchos::RCP<EntityLocalMap> &range_local_map,
+    const Teuchos::Array<int> &neighbor_ranks,
+    const Teuchos::Array<Teuchos::Tuple<double, 6>> &neighbor_boxes,
+    Teuchos::Array<EntityId> &send_ids, Teuchos::Array<int> &send_ranks,
+    Teuchos::Array<double> &send_centroids ) const
+{
+    int num_neighbors = neighbor_boxes.size();
+    EntityIterator range_begin = range_iterator.begin();
+    EntityIterator range_end = range_iterator.end();
+    EntityIterator range_it;
+    double centroid[DIM];
+    Teuchos::ArrayView<double> centroid_view( centroid, DIM );
+    bool found_entity = false;
+    for ( range_it = range_begin; range_it != range_end; ++range_it )
+    {
+        // Get the centroid.
+        range_local_map->centroid( *range_it, centroid_view );
+
+        // Check the neighbors.
+        found_entity = false;
+        for ( int n = 0; n < num_neighbors; ++n )
+        {
+            // If the centroid is in the box, add it to the send list.
+            if ( pointInBox<DIM>( centroid, neighbor_boxes[n],
+                                  d_inclusion_tol ) )
+            {
+                found_entity = true;
+                send_ids.push_back( range_it->id() );
+                send_ranks.push_back( neighbor_ranks[n] );
+                send_centroids.insert( send_centroids.end(), centroid,
+                                       centroid + DIM );
+            }
+        }
+
+        // If we are tracking missed range entities, add the entity to the
+        // list.
+        if ( d_track_missed_range_entities && !found_entity )
+        {
+            d_missed_range_entity_ids.push_back( range_it->id() );
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Assemble the local bounding box around an iterator.
 void CoarseGlobalSearch::assembleBoundingBox(
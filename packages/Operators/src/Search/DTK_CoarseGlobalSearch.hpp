@@ -41,6 +41,7 @@
 #ifndef DTK_COARSEGLOBALSEARCH_HPP
 #define DTK_COARSEGLOBALSEARCH_HPP
 
+#include "DTK_CachedDistributor.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
@@ -79,6 +80,17 @@ class CoarseGlobalSearch
                  Teuchos::Array<int> &range_owner_ranks,
                  Teuchos::Array<double> &range_centroids ) const;
 
+    // Redistribute a set of range entity centroid coordinates with their
+    // owner ranks to the owning domain process using a communication plan
+    // that is kept by the caller between searches.
+    void search( const EntityIterator &range_iterator,
+                 const Teuchos::RCP<EntityLocalMap> &range_local_map,
+                 const Teuchos::ParameterList &parameters,
+                 CachedDistributor &distributor,
+                 Teuchos::Array<EntityId> &range_entity_ids,
+                 Teuchos::Array<int> &range_owner_ranks,
+                 Teuchos::Array<double> &range_centroids ) const;
+
     /*!
      * \brief Return the ids of the range entities that were not during the
      * last search (i.e. those that are guaranteed to not receive data from
@@ -89,6 +101,18 @@ class CoarseGlobalSearch
     Teuchos::ArrayView<const EntityId> getMissedRangeEntityIds() const;
 
   private:
+    // Find the domains to which each range entity centroid of a fixed
+    // spatial dimension should be sent.
+    template <int DIM>
+    void findDestinations( const EntityIterator &range_iterator,
+                           const Teuchos::RCP<EntityLocalMap> &range_local_map,
+                           const Teuchos::Array<int> &neighbor_ranks,
+                           const Teuchos::Array<Teuchos::Tuple<double, 6>>
+                               &neighbor_boxes,
+                           Teuchos::Array<EntityId> &send_ids,
+                           Teuchos::Array<int> &send_ranks,
+                           Teuchos::Array<double> &send_centroids ) const;
+
     // Assemble the local bounding box around an iterator.
     void assembleBoundingBox( const EntityIterator &entity_iterator,
                               Teuchos::Tuple<double, 6> &bounding_box ) const;
@@ -98,8 +122,9 @@ class CoarseGlobalSearch
                                 const Teuchos::Tuple<double, 6> &box_B,
                                 const double tolerance ) const;
 
-    // Determine if a point is in a bounding box.
-    inline bool pointInBox( const Teuchos::ArrayView<const double> &point,
+    // Determine if a point of a fixed spatial dimension is in a bounding box.
+    template <int DIM>
+    inline bool pointInBox( const double *point,
                             const Teuchos::Tuple<double, 6> &box,
                             const double tolerance ) const;
 
@@ -149,41 +174,21 @@ bool CoarseGlobalSearch::boxesIntersect( const Teuchos::Tuple<double, 6> &box_A,
 }
 
 //---------------------------------------------------------------------------//
-// Determine if a point is in a bounding box.
-bool CoarseGlobalSearch::pointInBox(
-    const Teuchos::ArrayView<const double> &point,
-    const Teuchos::Tuple<double, 6> &box, const double tolerance ) const
+// Determine if a point of a fixed spatial dimension is in a bounding box.
+template <int DIM>
+bool CoarseGlobalSearch::pointInBox( const double *point,
+                                     const Teuchos::Tuple<double, 6> &box,
+                                     const double tolerance ) const
 {
-    double x_tol = ( box[3] - box[0] ) * tolerance;
-    double y_tol = ( box[4] - box[1] ) * tolerance;
-    double z_tol = ( box[5] - box[2] ) * tolerance;
-
-    if ( 3 == point.size() )
+    for ( int d = 0; d < DIM; ++d )
     {
-        if ( point[0] >= ( box[0] - x_tol ) && point[1] >= ( box[1] - y_tol ) &&
-             point[2] >= ( box[2] - z_tol ) && point[0] <= ( box[3] + x_tol ) &&
-             point[1] <= ( box[4] + y_tol ) && point[2] <= ( box[5] + z_tol ) )
+        double tol = ( box[d + 3] - box[d] ) * tolerance;
+        if ( point[d] < ( box[d] - tol ) || point[d] > ( box[d + 3] + tol ) )
         {
-            return true;
+            return false;
         }
     }
-    else if ( 2 == point.size() )
-    {
-        if ( point[0] >= ( box[0] - x_tol ) && point[1] >= ( box[1] - y_tol ) &&
-             point[0] <= ( box[3] + x_tol ) && point[1] <= ( box[4] + y_tol ) )
-        {
-            return true;
-        }
-    }
-    else if ( 1 == point.size() )
-    {
-        if ( point[0] >= ( box[0] - x_tol ) && point[0] <= ( box[3] + x_tol ) )
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return true;
 }
 
 //---------------------------------------------------------------------------//
@@ -55,15 +55,19 @@ CoarseLocalSearch::CoarseLocalSearch(
     const EntityIterator &entity_iterator,
     const Teuchos::RCP<EntityLocalMap> &local_map,
     const Teuchos::ParameterList &parameters )
+    : d_space_dim( 0 )
+    , d_tree_1( nullptr )
+    , d_tree_2( nullptr )
+    , d_tree_3( nullptr )
 {
     // Setup the centroid array. These will be interleaved.
-    int space_dim = 0;
     int num_entity = entity_iterator.size();
     if ( num_entity > 0 )
     {
-        space_dim = entity_iterator.begin()->physicalDimension();
+        d_space_dim = entity_iterator.begin()->physicalDimension();
     }
-    d_entity_centroids.resize( space_dim * num_entity );
+    d_entity_centroids.resize( d_space_dim * num_entity );
+    d_entities.reserve( num_entity );
 
     // Add the centroids.
     EntityIterator entity_it;
@@ -72,10 +76,10 @@ CoarseLocalSearch::CoarseLocalSearch(
     int entity_local_id = 0;
     for ( entity_it = begin_it; entity_it != end_it; ++entity_it )
     {
-        local_map->centroid(
-            *entity_it,
-            d_entity_centroids( space_dim * entity_local_id, space_dim ) );
-        d_entity_map.emplace( entity_local_id, *entity_it );
+        local_map->centroid( *entity_it,
+                             d_entity_centroids( d_space_dim * entity_local_id,
+                                                 d_space_dim ) );
+        d_entities.push_back( *entity_it );
         ++entity_local_id;
     }
 
@@ -87,8 +91,49 @@ CoarseLocalSearch::CoarseLocalSearch(
     }
     leaf_size = std::min( leaf_size, num_entity );
     d_tree = SearchTreeFactory::createStaticTree(
-        space_dim, d_entity_centroids(), leaf_size );
+        d_space_dim, d_entity_centroids(), leaf_size );
     DTK_ENSURE( Teuchos::nonnull( d_tree ) );
+
+    // The factory builds a NanoflannTree of the spatial dimension. Resolve it
+    // once so the fixed dimension search can call it directly.
+    switch ( d_space_dim )
+    {
+    case 1:
+        d_tree_1 =
+            dynamic_cast<const NanoflannTree<1> *>( d_tree.getRawPtr() );
+        DTK_INSIST( nullptr != d_tree_1 );
+        break;
+    case 2:
+        d_tree_2 =
+            dynamic_cast<const NanoflannTree<2> *>( d_tree.getRawPtr() );
+        DTK_INSIST( nullptr != d_tree_2 );
+        break;
+    case 3:
+        d_tree_3 =
+            dynamic_cast<const NanoflannTree<3> *>( d_tree.getRawPtr() );
+        DTK_INSIST( nullptr != d_tree_3 );
+        break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get the search tree of a fixed spatial dimension.
+template <>
+const NanoflannTree<1> *CoarseLocalSearch::typedTree<1>() const
+{
+    return d_tree_1;
+}
+
+template <>
+const NanoflannTree<2> *CoarseLocalSearch::typedTree<2>() const
+{
+    return d_tree_2;
+}
+
+template <>
+const NanoflannTree<3> *CoarseLocalSearch::typedTree<3>() const
+{
+    return d_tree_3;
 }
 
 //---------------------------------------------------------------------------//
@@ -99,29 +144,103 @@ void CoarseLocalSearch::search( const Teuchos::ArrayView<const double> &point,
                                 const Teuchos::ParameterList &parameters,
                                 Teuchos::Array<Entity> &neighbors ) const
 {
-    // Find the leaf of nearest neighbors.
-    int num_neighbors = 100;
-    if ( parameters.isParameter( "Coarse Local Search kNN" ) )
+    DTK_REQUIRE( d_space_dim == point.size() );
+
+    int num_neighbors = numNeighbors( parameters );
+    Teuchos::Array<unsigned> neighbor_ids;
+    Teuchos::Array<double> neighbor_dists;
+    switch ( d_space_dim )
     {
-        num_neighbors = parameters.get<int>( "Coarse Local Search kNN" );
+    case 1:
+        search<1>( point.getRawPtr(), num_neighbors, neighbors, neighbor_ids,
+                   neighbor_dists );
+        break;
+    case 2:
+        search<2>( point.getRawPtr(), num_neighbors, neighbors, neighbor_ids,
+                   neighbor_dists );
+        break;
+    case 3:
+        search<3>( point.getRawPtr(), num_neighbors, neighbors, neighbor_ids,
+                   neighbor_dists );
+        break;
+    default:
+        DTK_INSIST( false );
     }
-    num_neighbors =
-        std::min( num_neighbors, Teuchos::as<int>( d_entity_map.size() ) );
-    Teuchos::Array<unsigned> local_neighbors =
-        d_tree->nnSearch( point, num_neighbors );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the set of entities a point of a fixed spatial dimension
+ * neighbors.
+ *
+ * \param point The DIM coordinates of the point.
+ *
+ * \param num_neighbors The number of neighbors to find as given by
+ * numNeighbors().
+ *
+ * \param neighbors The nearest entities to the point.
+ *
+ * \param neighbor_ids, neighbor_dists Work buffers for the tree query. They
+ * are resized to num_neighbors so a caller searching many points can pass the
+ * same buffers to every search and only allocate once.
+ */
+template <int DIM>
+void CoarseLocalSearch::search( const double *point, const int num_neighbors,
+                                Teuchos::Array<Entity> &neighbors,
+                                Teuchos::Array<unsigned> &neighbor_ids,
+                                Teuchos::Array<double> &neighbor_dists ) const
+{
+    DTK_REQUIRE( DIM == d_space_dim );
+    DTK_REQUIRE( num_neighbors <= d_entities.size() );
+
+    // Find the leaf of nearest neighbors. The qualified call bypasses the
+    // virtual interface.
+    const NanoflannTree<DIM> *tree = typedTree<DIM>();
+    DTK_CHECK( nullptr != tree );
+    tree->NanoflannTree<DIM>::nnSearch( point, num_neighbors, neighbor_ids,
+                                        neighbor_dists );
 
     // Extract the neighbors.
-    neighbors.resize( local_neighbors.size() );
-    Teuchos::Array<unsigned>::const_iterator local_it;
-    Teuchos::Array<Entity>::iterator entity_it;
-    for ( local_it = local_neighbors.begin(), entity_it = neighbors.begin();
-          local_it != local_neighbors.end(); ++local_it, ++entity_it )
+    neighbors.resize( num_neighbors );
+    for ( int n = 0; n < num_neighbors; ++n )
     {
-        DTK_CHECK( d_entity_map.count( *local_it ) );
-        *entity_it = d_entity_map.find( *local_it )->second;
+        DTK_CHECK( neighbor_ids[n] < d_entities.size() );
+        neighbors[n] = d_entities[neighbor_ids[n]];
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the number of neighbors to search for from the parameters.
+ */
+int CoarseLocalSearch::numNeighbors(
+    const Teuchos::ParameterList &parameters ) const
+{
+    int num_neighbors = 100;
+    if ( parameters.isParameter( "Coarse Local Search kNN" ) )
+    {
+        num_neighbors = parameters.get<int>( "Coarse Local Search kNN" );
+    }
+    return std::min( num_neighbors, Teuchos::as<int>( d_entities.size() ) );
+}
+
+//---------------------------------------------------------------------------//
+// Explicit instantiation.
+//---------------------------------------------------------------------------//
+
+template void CoarseLocalSearch::search<1>( const double *, const int,
+                                            Teuchos::Array<Entity> &,
+                                            Teuchos::Array<unsigned> &,
+                                            Teuchos::Array<double> & ) const;
+template void CoarseLocalSearch::search<2>( const double *, const int,
+                                            Teuchos::Array<Entity> &,
+                                            Teuchos::Array<unsigned> &,
+                                            Teuchos::Array<double> & ) const;
+template void CoarseLocalSearch::search<3>( const double *, const int,
+                                            Teuchos::Array<Entity> &,
+                                            Teuchos::Array<unsigned> &,
+                                            Teuchos::Array<double> & ) const;
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
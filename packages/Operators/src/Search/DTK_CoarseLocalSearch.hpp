@@ -41,8 +41,6 @@
 #ifndef DTK_COARSELOCALSEARCH_HPP
 #define DTK_COARSELOCALSEARCH_HPP
 
-#include <unordered_map>
-
 #include "DTK_EntityIterator.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_StaticSearchTree.hpp"
@@ -59,6 +57,10 @@ namespace DataTransferKit
 /*!
  * \class CoarseLocalSearch
  * \brief A CoarseLocalSearch data structure for local entity coarse search.
+ *
+ * The search may be called with a runtime dimension or, for callers that
+ * have already dispatched on the spatial dimension, with a compile-time
+ * dimension that calls the kD-tree directly.
  */
 //---------------------------------------------------------------------------//
 class CoarseLocalSearch
@@ -74,15 +76,40 @@ class CoarseLocalSearch
                  const Teuchos::ParameterList &parameters,
                  Teuchos::Array<Entity> &neighbors ) const;
 
+    // Find the set of entities a point of a fixed spatial dimension
+    // neighbors using neighbor work buffers owned by the caller.
+    template <int DIM>
+    void search( const double *point, const int num_neighbors,
+                 Teuchos::Array<Entity> &neighbors,
+                 Teuchos::Array<unsigned> &neighbor_ids,
+                 Teuchos::Array<double> &neighbor_dists ) const;
+
+    // Get the number of neighbors to search for from the parameters.
+    int numNeighbors( const Teuchos::ParameterList &parameters ) const;
+
   private:
+    // Get the search tree of a fixed spatial dimension.
+    template <int DIM>
+    const NanoflannTree<DIM> *typedTree() const;
+
+  private:
+    // Spatial dimension of the entity centroids.
+    int d_space_dim;
+
     // Local mesh entity centroids.
     Teuchos::Array<double> d_entity_centroids;
 
-    // Local-id to entity map.
-    std::unordered_map<int, Entity> d_entity_map;
+    // Entities indexed by their local id in the tree.
+    Teuchos::Array<Entity> d_entities;
 
     // Static search tree.
     Teuchos::RCP<StaticSearchTree> d_tree;
+
+    // The static search tree resolved to its spatial dimension. Only the
+    // pointer matching the spatial dimension is set.
+    const NanoflannTree<1> *d_tree_1;
+    const NanoflannTree<2> *d_tree_2;
+    const NanoflannTree<3> *d_tree_3;
 };
 
 //---------------------------------------------------------------------------//
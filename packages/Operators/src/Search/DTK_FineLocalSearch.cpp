@@ -43,7 +43,6 @@
 
 #include "DTK_DBC.hpp"
 #include "DTK_FineLocalSearch.hpp"
-#include "DTK_SearchTreeFactory.hpp"
 
 namespace DataTransferKit
 {
@@ -66,36 +65,109 @@ void FineLocalSearch::search(
     const Teuchos::ArrayView<const double> &point,
     const Teuchos::ParameterList &parameters, Teuchos::Array<Entity> &parents,
     Teuchos::Array<double> &reference_coordinates ) const
+{
+    Teuchos::Array<double> points;
+    Teuchos::Array<double> ref_points;
+    Teuchos::Array<int> found;
+    switch ( point.size() )
+    {
+    case 1:
+        search<1>( neighbors, point.getRawPtr(), parents,
+                   reference_coordinates, points, ref_points, found );
+        break;
+    case 2:
+        search<2>( neighbors, point.getRawPtr(), parents,
+                   reference_coordinates, points, ref_points, found );
+        break;
+    case 3:
+        search<3>( neighbors, point.getRawPtr(), parents,
+                   reference_coordinates, points, ref_points, found );
+        break;
+    default:
+        DTK_INSIST( false );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Find the set of entities to which a point of a fixed spatial
+ * dimension maps.
+ *
+ * \param neighbors The candidate entities.
+ *
+ * \param point The DIM coordinates of the point.
+ *
+ * \param parents The candidates that contain the point.
+ *
+ * \param reference_coordinates The interleaved DIM reference coordinates of
+ * the point in each parent.
+ *
+ * \param points, ref_points, found Work buffers for the candidate pairs. They
+ * are resized as needed so a caller searching many points can pass the same
+ * buffers to every search and only allocate for the largest candidate set.
+ */
+template <int DIM>
+void FineLocalSearch::search(
+    const Teuchos::ArrayView<const Entity> &neighbors, const double *point,
+    Teuchos::Array<Entity> &parents,
+    Teuchos::Array<double> &reference_coordinates,
+    Teuchos::Array<double> &points, Teuchos::Array<double> &ref_points,
+    Teuchos::Array<int> &found ) const
 {
     parents.clear();
     reference_coordinates.clear();
-    int physical_dim = point.size();
-    Teuchos::Array<double> ref_point( physical_dim );
-    Teuchos::ArrayView<const Entity>::const_iterator neighbor_it;
-    for ( neighbor_it = neighbors.begin(); neighbor_it != neighbors.end();
-          ++neighbor_it )
+
+    // Pair the point with every candidate and locate all pairs at once so
+    // the local map can batch them.
+    int num_neighbors = neighbors.size();
+    points.resize( num_neighbors * DIM );
+    ref_points.resize( num_neighbors * DIM );
+    found.resize( num_neighbors );
+    for ( int n = 0; n < num_neighbors; ++n )
     {
-        DTK_ENSURE( neighbor_it->physicalDimension() == point.size() );
+        DTK_ENSURE( neighbors[n].physicalDimension() == DIM );
+        for ( int d = 0; d < DIM; ++d )
+        {
+            points[n * DIM + d] = point[d];
+        }
+    }
+    d_local_map->locatePoints( neighbors, points(), ref_points(),
+                               found() );
 
-        if ( d_local_map->isSafeToMapToReferenceFrame( *neighbor_it, point ) )
+    // Extract the parents.
+    for ( int n = 0; n < num_neighbors; ++n )
+    {
+        if ( found[n] )
         {
-            if ( d_local_map->mapToReferenceFrame( *neighbor_it, point,
-                                                   ref_point() ) )
+            parents.push_back( neighbors[n] );
+            for ( int d = 0; d < DIM; ++d )
             {
-                if ( d_local_map->checkPointInclusion( *neighbor_it,
-                                                       ref_point() ) )
-                {
-                    parents.push_back( *neighbor_it );
-                    for ( int d = 0; d < physical_dim; ++d )
-                    {
-                        reference_coordinates.push_back( ref_point[d] );
-                    }
-                }
+                reference_coordinates.push_back( ref_points[n * DIM + d] );
             }
         }
     }
 }
 
+//---------------------------------------------------------------------------//
+// Explicit instantiation.
+//---------------------------------------------------------------------------//
+
+template void FineLocalSearch::search<1>(
+    const Teuchos::ArrayView<const Entity> &, const double *,
+    Teuchos::Array<Entity> &, Teuchos::Array<double> &,
+    Teuchos::Array<double> &, Teuchos::Array<double> &,
+    Teuchos::Array<int> & ) const;
+template void FineLocalSearch::search<2>(
+    const Teuchos::ArrayView<const Entity> &, const double *,
+    Teuchos::Array<Entity> &, Teuchos::Array<double> &,
+    Teuchos::Array<double> &, Teuchos::Array<double> &,
+    Teuchos::Array<int> & ) const;
+template void FineLocalSearch::search<3>(
+    const Teuchos::ArrayView<const Entity> &, const double *,
+    Teuchos::Array<Entity> &, Teuchos::Array<double> &,
+    Teuchos::Array<double> &, Teuchos::Array<double> &,
+    Teuchos::Array<int> & ) const;
+
 //---------------------------------------------------------------------------//
 
 } // end namespace DataTransferKit
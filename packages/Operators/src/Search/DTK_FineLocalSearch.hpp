@@ -41,8 +41,6 @@
 #ifndef DTK_FINELOCALSEARCH_HPP
 #define DTK_FINELOCALSEARCH_HPP
 
-#include <unordered_map>
-
 #include "DTK_Entity.hpp"
 #include "DTK_EntityLocalMap.hpp"
 #include "DTK_Types.hpp"
@@ -74,6 +72,16 @@ class FineLocalSearch
                  Teuchos::Array<Entity> &parents,
                  Teuchos::Array<double> &reference_coordinates ) const;
 
+    // Find the set of entities to which a point of a fixed spatial dimension
+    // maps using work buffers owned by the caller.
+    template <int DIM>
+    void search( const Teuchos::ArrayView<const Entity> &neighbors,
+                 const double *point, Teuchos::Array<Entity> &parents,
+                 Teuchos::Array<double> &reference_coordinates,
+                 Teuchos::Array<double> &points,
+                 Teuchos::Array<double> &ref_points,
+                 Teuchos::Array<int> &found ) const;
+
   private:
     // Local map for the fine search.
     Teuchos::RCP<EntityLocalMap> d_local_map;
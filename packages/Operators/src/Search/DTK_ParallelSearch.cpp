@@ -38,25 +38,51 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
 #include "DTK_ParallelSearch.hpp"
 #include "DTK_DBC.hpp"
+#include "DTK_Profiler.hpp"
 
 #include <Tpetra_Distributor.hpp>
 
 namespace DataTransferKit
 {
+//---------------------------------------------------------------------------//
+// Communication plans constructor.
+ParallelSearch::CommPlans::CommPlans(
+    const Teuchos::RCP<const Teuchos::Comm<int>> &comm )
+    : range_to_domain( comm )
+    , domain_to_range( comm )
+    , missed_range( comm )
+    , found_range( comm )
+{ /* ... */
+}
+
 //---------------------------------------------------------------------------//
 // Constructor.
 ParallelSearch::ParallelSearch(
     const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
     const int physical_dimension, const EntityIterator &domain_iterator,
     const Teuchos::RCP<EntityLocalMap> &domain_local_map,
-    const Teuchos::ParameterList &parameters )
+    const Teuchos::ParameterList &parameters,
+    const Teuchos::RCP<CommPlans> &plans )
     : d_comm( comm )
     , d_physical_dim( physical_dimension )
+    , d_plans( plans )
     , d_track_missed_range_entities( false )
     , d_missed_range_entity_ids( 0 )
 {
+    ScopedTimer timer( "Parallel Search Construction" );
+
+    // Create the communication plans if the caller does not keep them.
+    if ( Teuchos::is_null( d_plans ) )
+    {
+        d_plans = Teuchos::rcp( new CommPlans( d_comm ) );
+    }
+
     // Set the parameters with the local map.
     domain_local_map->setParameters( parameters );
 
@@ -91,6 +117,8 @@ void ParallelSearch::search(
     const Teuchos::RCP<EntityLocalMap> &range_local_map,
     const Teuchos::ParameterList &parameters )
 {
+    ScopedTimer timer( "Parallel Search" );
+
     // Set the parameters with the local map.
     range_local_map->setParameters( parameters );
 
@@ -101,15 +129,17 @@ void ParallelSearch::search(
     d_range_owner_ranks.clear();
     d_domain_to_range_map.clear();
     d_range_to_domain_map.clear();
-    d_parametric_coords.clear();
+    d_pair_range_ids.clear();
+    d_pair_domain_ids.clear();
+    d_pair_parametric_coords.clear();
 
     // Perform a coarse global search to redistribute the range entities.
     Teuchos::Array<EntityId> range_entity_ids;
     Teuchos::Array<int> range_owner_ranks;
     Teuchos::Array<double> range_centroids;
-    d_coarse_global_search->search( range_iterator, range_local_map, parameters,
-                                    range_entity_ids, range_owner_ranks,
-                                    range_centroids );
+    d_coarse_global_search->search(
+        range_iterator, range_local_map, parameters, d_plans->range_to_domain,
+        range_entity_ids, range_owner_ranks, range_centroids );
 
     // If needed, extract the range entities that were missed during the
     // coarse global search.
@@ -125,89 +155,46 @@ void ParallelSearch::search(
                                    d_comm->getRank() );
     }
 
-    // Only do the local search if there are local domain entities.
+    // Only do the local search if there are local domain entities. Dispatch
+    // once on the spatial dimension so the per-point work uses fixed-size
+    // coordinates and calls the search tree directly.
     Teuchos::Array<int> export_range_ranks;
     Teuchos::Array<EntityId> export_data;
     if ( !d_empty_domain )
     {
-        // For each range centroid, perform a local search.
-        int num_range = range_entity_ids.size();
-        Teuchos::Array<Entity> domain_neighbors;
-        Teuchos::Array<Entity> domain_parents;
-        Teuchos::Array<double> reference_coordinates;
-        Teuchos::Array<double> local_coords( d_physical_dim );
-        int num_parents = 0;
-        for ( int n = 0; n < num_range; ++n )
+        switch ( d_physical_dim )
         {
-            // Perform a coarse local search to get the nearest domain
-            // entities to the point.
-            d_coarse_local_search->search(
-                range_centroids( d_physical_dim * n, d_physical_dim ),
-                parameters, domain_neighbors );
-
-            // Perform a fine local search to get the entities the point maps
-            // to.
-            d_fine_local_search->search(
-                domain_neighbors,
-                range_centroids( d_physical_dim * n, d_physical_dim ),
-                parameters, domain_parents, reference_coordinates );
-
-            // Store the potentially multiple parametric realizations of the
-            // point.
-            std::unordered_map<EntityId, Teuchos::Array<double>> ref_map;
-            num_parents = domain_parents.size();
-            for ( int p = 0; p < num_parents; ++p )
-            {
-                // Store the range data in the domain parallel decomposition.
-                local_coords().assign( reference_coordinates(
-                    d_physical_dim * p, d_physical_dim ) );
-                d_range_owner_ranks.emplace( range_entity_ids[n],
-                                             range_owner_ranks[n] );
-                d_domain_to_range_map.emplace( domain_parents[p].id(),
-                                               range_entity_ids[n] );
-                ref_map.emplace( domain_parents[p].id(), local_coords );
-
-                // Extract the data to communicate back to the range parallel
-                // decomposition.
-                export_range_ranks.push_back( range_owner_ranks[n] );
-                export_data.push_back( range_entity_ids[n] );
-                export_data.push_back( domain_parents[p].id() );
-                export_data.push_back(
-                    Teuchos::as<EntityId>( d_comm->getRank() ) );
-            }
-
-            // If we found parents for the point, store them.
-            if ( num_parents > 0 )
-            {
-                d_parametric_coords.emplace( range_entity_ids[n], ref_map );
-
-                // If we are tracking missed entities, also track those that
-                // we found so we can determine if an entity was found after
-                // being sent to multiple destinations.
-                if ( d_track_missed_range_entities )
-                {
-                    found_range_entity_ids.push_back( range_entity_ids[n] );
-                    found_range_ranks.push_back( range_owner_ranks[n] );
-                }
-            }
-
-            // Otherwise, if we are tracking missed entities report this.
-            else if ( d_track_missed_range_entities )
-            {
-                missed_range_entity_ids.push_back( range_entity_ids[n] );
-                missed_range_ranks.push_back( range_owner_ranks[n] );
-            }
+        case 1:
+            localSearch<1>( parameters, range_entity_ids, range_owner_ranks,
+                            range_centroids, export_range_ranks, export_data,
+                            found_range_entity_ids, found_range_ranks,
+                            missed_range_entity_ids, missed_range_ranks );
+            break;
+        case 2:
+            localSearch<2>( parameters, range_entity_ids, range_owner_ranks,
+                            range_centroids, export_range_ranks, export_data,
+                            found_range_entity_ids, found_range_ranks,
+                            missed_range_entity_ids, missed_range_ranks );
+            break;
+        case 3:
+            localSearch<3>( parameters, range_entity_ids, range_owner_ranks,
+                            range_centroids, export_range_ranks, export_data,
+                            found_range_entity_ids, found_range_ranks,
+                            missed_range_entity_ids, missed_range_ranks );
+            break;
+        default:
+            DTK_INSIST( false );
         }
     }
 
     // Back-communicate the domain entities in which we found each range
     // entity to complete the mapping.
-    Tpetra::Distributor domain_to_range_dist( d_comm );
     int num_import =
-        domain_to_range_dist.createFromSends( export_range_ranks() );
+        d_plans->domain_to_range.createFromSends( export_range_ranks() );
     Teuchos::Array<EntityId> domain_data( 3 * num_import );
     Teuchos::ArrayView<const EntityId> export_data_view = export_data();
-    domain_to_range_dist.doPostsAndWaits( export_data_view, 3, domain_data() );
+    d_plans->domain_to_range.doPostsAndWaits(
+        export_data_view, 3, domain_data() );
 
     // Store the domain data in the range parallel decomposition.
     for ( int i = 0; i < num_import; ++i )
@@ -223,22 +210,21 @@ void ParallelSearch::search(
     if ( d_track_missed_range_entities )
     {
         // Back-communicate the missing entities.
-        Tpetra::Distributor missed_range_dist( d_comm );
         int num_import_missed =
-            missed_range_dist.createFromSends( missed_range_ranks() );
+            d_plans->missed_range.createFromSends( missed_range_ranks() );
         Teuchos::Array<EntityId> import_missed( num_import_missed );
         Teuchos::ArrayView<const EntityId> missed_view =
             missed_range_entity_ids();
-        missed_range_dist.doPostsAndWaits( missed_view, 1, import_missed() );
+        d_plans->missed_range.doPostsAndWaits( missed_view, 1,
+                                               import_missed() );
 
         // Back-communicate the found entities.
-        Tpetra::Distributor found_range_dist( d_comm );
         int num_import_found =
-            found_range_dist.createFromSends( found_range_ranks() );
+            d_plans->found_range.createFromSends( found_range_ranks() );
         Teuchos::Array<EntityId> import_found( num_import_found );
         Teuchos::ArrayView<const EntityId> found_view =
             found_range_entity_ids();
-        found_range_dist.doPostsAndWaits( found_view, 1, import_found() );
+        d_plans->found_range.doPostsAndWaits( found_view, 1, import_found() );
 
         // Create a unique list of missed entities.
         std::sort( import_missed.begin(), import_missed.end() );
@@ -275,9 +261,184 @@ void ParallelSearch::search(
             d_missed_range_entity_ids.size() + import_found.size();
         DTK_REQUIRE( n_entities == range_iterator.size() );
 #endif
+
+        Profiler::recordCount( "Parallel Search: Missed Range Entities",
+                               d_missed_range_entity_ids.size() );
+    }
+
+    // Record the memory of the search results and exchange buffers.
+    if ( Profiler::trackingMemory() )
+    {
+        Profiler::recordMemory(
+            "Parallel Search: Parametric Coordinates",
+            containerBytes( d_pair_range_ids ) +
+                containerBytes( d_pair_domain_ids ) +
+                containerBytes( d_pair_parametric_coords ) );
+        Profiler::recordMemory(
+            "Parallel Search: Entity Maps",
+            hashedContainerBytes( d_domain_to_range_map ) +
+                hashedContainerBytes( d_range_to_domain_map ) );
+        Profiler::recordMemory(
+            "Parallel Search: Owner Ranks",
+            hashedContainerBytes( d_range_owner_ranks ) +
+                hashedContainerBytes( d_domain_owner_ranks ) );
+        Profiler::recordMemory( "Parallel Search: Exchange Buffers",
+                                containerBytes( export_range_ranks ) +
+                                    containerBytes( export_data ) +
+                                    containerBytes( domain_data ) );
     }
 }
 
+//---------------------------------------------------------------------------//
+// Search the local domain with the redistributed range entity centroids of a
+// fixed spatial dimension.
+template <int DIM>
+void ParallelSearch::localSearch(
+    const Teuchos::ParameterList &parameters,
+    const Teuchos::Array<EntityId> &range_entity_ids,
+    const Teuchos::Array<int> &range_owner_ranks,
+    const Teuchos::Array<double> &range_centroids,
+    Teuchos::Array<int> &export_range_ranks,
+    Teuchos::Array<EntityId> &export_data,
+    Teuchos::Array<EntityId> &found_range_entity_ids,
+    Teuchos::Array<int> &found_range_ranks,
+    Teuchos::Array<EntityId> &missed_range_entity_ids,
+    Teuchos::Array<int> &missed_range_ranks )
+{
+    DTK_REQUIRE( DIM == d_physical_dim );
+
+    // The number of coarse neighbors is the same for every point.
+    int num_neighbors = d_coarse_local_search->numNeighbors( parameters );
+
+    // For each range centroid, perform a local search.
+    int num_range = range_entity_ids.size();
+    const double *centroid = range_centroids.getRawPtr();
+    Teuchos::Array<Entity> domain_neighbors;
+    Teuchos::Array<Entity> domain_parents;
+    Teuchos::Array<double> reference_coordinates;
+    int num_parents = 0;
+
+    // Coarse search work buffers shared by all points.
+    Teuchos::Array<unsigned> neighbor_ids;
+    Teuchos::Array<double> neighbor_dists;
+    neighbor_ids.reserve( num_neighbors );
+    neighbor_dists.reserve( num_neighbors );
+
+    // Fine search work buffers shared by all points so they are only grown
+    // for the largest candidate set.
+    Teuchos::Array<double> fine_points;
+    Teuchos::Array<double> fine_ref_points;
+    Teuchos::Array<int> fine_found;
+    fine_points.reserve( num_neighbors * DIM );
+    fine_ref_points.reserve( num_neighbors * DIM );
+    fine_found.reserve( num_neighbors );
+
+    long long num_candidates = 0;
+    long long num_accepted = 0;
+    Stopwatch coarse_watch;
+    Stopwatch fine_watch;
+    for ( int n = 0; n < num_range; ++n, centroid += DIM )
+    {
+        // Perform a coarse local search to get the nearest domain entities to
+        // the point.
+        coarse_watch.start();
+        d_coarse_local_search->search<DIM>( centroid, num_neighbors,
+                                            domain_neighbors, neighbor_ids,
+                                            neighbor_dists );
+        coarse_watch.stop();
+
+        // Perform a fine local search to get the entities the point maps to.
+        fine_watch.start();
+        d_fine_local_search->search<DIM>(
+            domain_neighbors(), centroid, domain_parents,
+            reference_coordinates, fine_points, fine_ref_points, fine_found );
+        fine_watch.stop();
+        num_candidates += domain_neighbors.size();
+        num_accepted += domain_parents.size();
+
+        // Store the potentially multiple parametric realizations of the
+        // point.
+        num_parents = domain_parents.size();
+        for ( int p = 0; p < num_parents; ++p )
+        {
+            // Store the range data in the domain parallel decomposition.
+            d_range_owner_ranks.emplace( range_entity_ids[n],
+                                         range_owner_ranks[n] );
+            d_domain_to_range_map.emplace( domain_parents[p].id(),
+                                           range_entity_ids[n] );
+            const double *ref_point =
+                reference_coordinates.getRawPtr() + DIM * p;
+            d_pair_range_ids.push_back( range_entity_ids[n] );
+            d_pair_domain_ids.push_back( domain_parents[p].id() );
+            d_pair_parametric_coords.insert( d_pair_parametric_coords.end(),
+                                             ref_point, ref_point + DIM );
+
+            // Extract the data to communicate back to the range parallel
+            // decomposition.
+            export_range_ranks.push_back( range_owner_ranks[n] );
+            export_data.push_back( range_entity_ids[n] );
+            export_data.push_back( domain_parents[p].id() );
+            export_data.push_back( Teuchos::as<EntityId>( d_comm->getRank() ) );
+        }
+
+        // If we found parents for the point, store them.
+        if ( num_parents > 0 )
+        {
+            // If we are tracking missed entities, also track those that we
+            // found so we can determine if an entity was found after being
+            // sent to multiple destinations.
+            if ( d_track_missed_range_entities )
+            {
+                found_range_entity_ids.push_back( range_entity_ids[n] );
+                found_range_ranks.push_back( range_owner_ranks[n] );
+            }
+        }
+
+        // Otherwise, if we are tracking missed entities report this.
+        else if ( d_track_missed_range_entities )
+        {
+            missed_range_entity_ids.push_back( range_entity_ids[n] );
+            missed_range_ranks.push_back( range_owner_ranks[n] );
+        }
+    }
+
+    // Sort the pairings by range id and then by domain id so the results can
+    // be looked up and extracted without hashing.
+    int num_pairs = d_pair_range_ids.size();
+    Teuchos::Array<int> pair_order( num_pairs );
+    std::iota( pair_order.begin(), pair_order.end(), 0 );
+    std::sort( pair_order.begin(), pair_order.end(),
+               [this]( const int a, const int b ) {
+                   return ( d_pair_range_ids[a] < d_pair_range_ids[b] ) ||
+                          ( d_pair_range_ids[a] == d_pair_range_ids[b] &&
+                            d_pair_domain_ids[a] < d_pair_domain_ids[b] );
+               } );
+    Teuchos::Array<EntityId> sorted_range_ids( num_pairs );
+    Teuchos::Array<EntityId> sorted_domain_ids( num_pairs );
+    Teuchos::Array<double> sorted_coords( DIM * num_pairs );
+    for ( int i = 0; i < num_pairs; ++i )
+    {
+        int p = pair_order[i];
+        sorted_range_ids[i] = d_pair_range_ids[p];
+        sorted_domain_ids[i] = d_pair_domain_ids[p];
+        for ( int d = 0; d < DIM; ++d )
+        {
+            sorted_coords[DIM * i + d] = d_pair_parametric_coords[DIM * p + d];
+        }
+    }
+    d_pair_range_ids.swap( sorted_range_ids );
+    d_pair_domain_ids.swap( sorted_domain_ids );
+    d_pair_parametric_coords.swap( sorted_coords );
+
+    // Record the local search timings once for the whole loop.
+    coarse_watch.record( "Coarse Local Search" );
+    fine_watch.record( "Fine Local Search" );
+    Profiler::recordCount( "Fine Local Search: Candidates Tested",
+                           num_candidates );
+    Profiler::recordCount( "Fine Local Search: Candidates Accepted",
+                           num_accepted );
+}
+
 //---------------------------------------------------------------------------//
 // Given a domain entity id, get the ids of the range entities that mapped to
 // it.
@@ -337,11 +498,51 @@ void ParallelSearch::rangeParametricCoordinatesInDomain(
     Teuchos::ArrayView<const double> &parametric_coords ) const
 {
     DTK_REQUIRE( !d_empty_domain );
-    DTK_REQUIRE( d_parametric_coords.count( range_id ) );
-    DTK_REQUIRE(
-        d_parametric_coords.find( range_id )->second.count( domain_id ) );
-    parametric_coords =
-        d_parametric_coords.find( range_id )->second.find( domain_id )->second;
+
+    // Find the pairings of the range entity and then the domain entity within
+    // them.
+    auto range_bounds = std::equal_range( d_pair_range_ids.begin(),
+                                          d_pair_range_ids.end(), range_id );
+    auto domain_begin =
+        d_pair_domain_ids.begin() +
+        std::distance( d_pair_range_ids.begin(), range_bounds.first );
+    auto domain_end =
+        d_pair_domain_ids.begin() +
+        std::distance( d_pair_range_ids.begin(), range_bounds.second );
+    auto domain_it = std::lower_bound( domain_begin, domain_end, domain_id );
+    DTK_REQUIRE( domain_it != domain_end && *domain_it == domain_id );
+
+    int pair = std::distance( d_pair_domain_ids.begin(), domain_it );
+    parametric_coords = d_pair_parametric_coords.view(
+        d_physical_dim * pair, d_physical_dim );
+}
+
+//---------------------------------------------------------------------------//
+// Get the search results with one pairing per range entity, sorted by range
+// entity id.
+void ParallelSearch::getUniqueRangePairings(
+    Teuchos::Array<EntityId> &range_ids, Teuchos::Array<EntityId> &domain_ids,
+    Teuchos::Array<double> &parametric_coords ) const
+{
+    range_ids.clear();
+    domain_ids.clear();
+    parametric_coords.clear();
+
+    // The pairings of a range entity are contiguous and sorted by domain id
+    // so the first one has the lowest domain id.
+    int num_pairs = d_pair_range_ids.size();
+    auto coords_begin = d_pair_parametric_coords.begin();
+    for ( int p = 0; p < num_pairs; ++p )
+    {
+        if ( 0 == p || d_pair_range_ids[p] != d_pair_range_ids[p - 1] )
+        {
+            range_ids.push_back( d_pair_range_ids[p] );
+            domain_ids.push_back( d_pair_domain_ids[p] );
+            parametric_coords.insert(
+                parametric_coords.end(), coords_begin + d_physical_dim * p,
+                coords_begin + d_physical_dim * ( p + 1 ) );
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
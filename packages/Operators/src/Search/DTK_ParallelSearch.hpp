@@ -43,6 +43,7 @@
 
 #include <unordered_map>
 
+#include "DTK_CachedDistributor.hpp"
 #include "DTK_CoarseGlobalSearch.hpp"
 #include "DTK_CoarseLocalSearch.hpp"
 #include "DTK_EntityIterator.hpp"
@@ -74,14 +75,41 @@ namespace DataTransferKit
 class ParallelSearch
 {
   public:
+    /*!
+     * \brief Communication plans of the search. Keeping the plans between
+     * searches allows them to be reused when the communication pattern
+     * between the domain and range decompositions is unchanged.
+     */
+    struct CommPlans
+    {
+        CommPlans( const Teuchos::RCP<const Teuchos::Comm<int>> &comm );
+
+        // Range centroids to the domain decomposition.
+        CachedDistributor range_to_domain;
+
+        // Found domain entities back to the range decomposition.
+        CachedDistributor domain_to_range;
+
+        // Missed range entities back to the range decomposition.
+        CachedDistributor missed_range;
+
+        // Found range entities back to the range decomposition.
+        CachedDistributor found_range;
+    };
+
     /*!
      * \brief Constructor.
+     *
+     * \param plans Optional communication plans kept by the caller. If null,
+     * the search creates its own plans which are reused between calls to
+     * search().
      */
     ParallelSearch( const Teuchos::RCP<const Teuchos::Comm<int>> &comm,
                     const int physical_dimension,
                     const EntityIterator &domain_iterator,
                     const Teuchos::RCP<EntityLocalMap> &domain_local_map,
-                    const Teuchos::ParameterList &parameters );
+                    const Teuchos::ParameterList &parameters,
+                    const Teuchos::RCP<CommPlans> &plans = Teuchos::null );
 
     /*
      * \brief Search the domain with the range entity centroids and construct
@@ -125,6 +153,29 @@ class ParallelSearch
         const EntityId domain_id, const EntityId range_id,
         Teuchos::ArrayView<const double> &parametric_coords ) const;
 
+    /*!
+     * \brief Get the search results on a domain process with one pairing per
+     * range entity, sorted by range entity id.
+     *
+     * If a range entity was found in more than one local domain entity the
+     * domain entity with the lowest id is chosen. This is a linear copy of
+     * the stored results.
+     *
+     * \param range_ids The sorted, unique ids of the range entities found on
+     * this process.
+     *
+     * \param domain_ids The id of the domain entity each range entity was
+     * found in.
+     *
+     * \param parametric_coords The parametric coordinates of each range
+     * entity in its domain entity. There are physical dimension coordinates
+     * for each range entity, blocked by entity.
+     */
+    void
+    getUniqueRangePairings( Teuchos::Array<EntityId> &range_ids,
+                            Teuchos::Array<EntityId> &domain_ids,
+                            Teuchos::Array<double> &parametric_coords ) const;
+
     /*!
      * \brief Return the ids of the range entities that were not during the
      * last search (i.e. those that are guaranteed to not receive data from
@@ -134,6 +185,21 @@ class ParallelSearch
      */
     Teuchos::ArrayView<const EntityId> getMissedRangeEntityIds() const;
 
+  private:
+    // Search the local domain with the redistributed range entity centroids
+    // of a fixed spatial dimension.
+    template <int DIM>
+    void localSearch( const Teuchos::ParameterList &parameters,
+                      const Teuchos::Array<EntityId> &range_entity_ids,
+                      const Teuchos::Array<int> &range_owner_ranks,
+                      const Teuchos::Array<double> &range_centroids,
+                      Teuchos::Array<int> &export_range_ranks,
+                      Teuchos::Array<EntityId> &export_data,
+                      Teuchos::Array<EntityId> &found_range_entity_ids,
+                      Teuchos::Array<int> &found_range_ranks,
+                      Teuchos::Array<EntityId> &missed_range_entity_ids,
+                      Teuchos::Array<int> &missed_range_ranks );
+
   private:
     // Parallel communicator.
     Teuchos::RCP<const Teuchos::Comm<int>> d_comm;
@@ -147,6 +213,9 @@ class ParallelSearch
     // Empty range flag.
     bool d_empty_range;
 
+    // Communication plans.
+    Teuchos::RCP<CommPlans> d_plans;
+
     // Coarse global search.
     Teuchos::RCP<CoarseGlobalSearch> d_coarse_global_search;
 
@@ -168,12 +237,14 @@ class ParallelSearch
     // Range-to-domain entity map.
     std::unordered_multimap<EntityId, EntityId> d_range_to_domain_map;
 
-    // Parametric coordinates of the range entities in the domain
-    // entities. The first key is the range id, the second key is the domain
-    // id.
-    std::unordered_map<EntityId,
-                       std::unordered_map<EntityId, Teuchos::Array<double>>>
-        d_parametric_coords;
+    // Range-domain pairings found on this domain process sorted by range id
+    // and then by domain id.
+    Teuchos::Array<EntityId> d_pair_range_ids;
+    Teuchos::Array<EntityId> d_pair_domain_ids;
+
+    // Parametric coordinates of the range entities in the domain entities for
+    // each pairing, blocked by pairing.
+    Teuchos::Array<double> d_pair_parametric_coords;
 
     // Boolean for tracking missed range entities.
     bool d_track_missed_range_entities;
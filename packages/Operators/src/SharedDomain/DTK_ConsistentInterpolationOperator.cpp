@@ -43,6 +43,7 @@
 
 #include "DTK_BasicEntityPredicates.hpp"
 #include "DTK_ConsistentInterpolationOperator.hpp"
+#include "DTK_CouplingMatrixBuilder.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_ParallelSearch.hpp"
 #include "DTK_PredicateComposition.hpp"
@@ -133,9 +134,18 @@ void ConsistentInterpolationOperator::setupImpl(
             domain_space->entitySet()->physicalDimension(), domain_predicate );
     }
 
-    // Build a parallel search over the domain.
+    // Build a parallel search over the domain. The communication plans are
+    // kept between setups so they are reused if the decompositions are
+    // unchanged.
+    if ( Teuchos::is_null( d_search_plans ) )
+    {
+        d_search_plans =
+            Teuchos::rcp( new ParallelSearch::CommPlans( comm ) );
+        d_range_to_domain_dist = Teuchos::rcp( new CachedDistributor( comm ) );
+    }
     ParallelSearch psearch( comm, physical_dimension, domain_iterator,
-                            domain_space->localMap(), d_search_list );
+                            domain_space->localMap(), d_search_list,
+                            d_search_plans );
 
     // Get an iterator over the range entities.
     EntityIterator range_iterator;
@@ -205,12 +215,12 @@ void ConsistentInterpolationOperator::setupImpl(
 
         // Communicate the range entity Support data back to the domain parallel
         // decomposition.
-        Tpetra::Distributor range_to_domain_dist( comm );
-        int num_import = range_to_domain_dist.createFromSends( export_ranks() );
+        int num_import =
+            d_range_to_domain_dist->createFromSends( export_ranks() );
         Teuchos::Array<GO> import_data( 2 * num_import );
         Teuchos::ArrayView<const GO> export_data_view = export_data();
-        range_to_domain_dist.doPostsAndWaits( export_data_view, 2,
-                                              import_data() );
+        d_range_to_domain_dist->doPostsAndWaits(
+            export_data_view, 2, import_data() );
 
         // Map the range entities to their support ids.
         for ( int i = 0; i < num_import; ++i )
@@ -221,8 +231,9 @@ void ConsistentInterpolationOperator::setupImpl(
         }
     }
 
-    // Allocate the coupling matrix.
-    d_coupling_matrix = Tpetra::createCrsMatrix<double, LO, GO>( range_map );
+    // Collect the coupling matrix entries. The rows may be owned by other
+    // processes.
+    CouplingMatrixBuilder matrix_builder( domain_map, range_map );
 
     // Construct the entries of the coupling matrix.
     Teuchos::Array<EntityId> range_entity_ids;
@@ -263,14 +274,14 @@ void ConsistentInterpolationOperator::setupImpl(
             // range entity. Load the row for this range support location into
             // the matrix.
             DTK_CHECK( range_support_id_map.count( *range_entity_id_it ) );
-            d_coupling_matrix->insertGlobalValues(
+            matrix_builder.addRow(
                 range_support_id_map.find( *range_entity_id_it )->second,
                 domain_support_ids(), domain_shape_values() );
         }
     }
 
-    // Finalize the coupling matrix.
-    d_coupling_matrix->fillComplete( domain_map, range_map );
+    // Build the coupling matrix.
+    d_coupling_matrix = matrix_builder.build();
 
     // Left-scale the matrix with the number of domain entities in which each
     // range entity was found.
@@ -326,6 +337,13 @@ bool ConsistentInterpolationOperator::hasTransposeApplyImpl() const
     return true;
 }
 
+//---------------------------------------------------------------------------//
+// Range data option.
+bool ConsistentInterpolationOperator::applyUsesRangeDataImpl() const
+{
+    return d_keep_missed_sol;
+}
+
 //---------------------------------------------------------------------------//
 // Return the ids of the range entities that were not mapped during the last
 // setup phase (i.e. those that are guaranteed to not receive data from the
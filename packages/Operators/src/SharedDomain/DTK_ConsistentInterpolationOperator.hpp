@@ -41,7 +41,9 @@
 #ifndef DTK_CONSISTENTINTERPOLATIONOPERATOR_HPP
 #define DTK_CONSISTENTINTERPOLATIONOPERATOR_HPP
 
+#include "DTK_CachedDistributor.hpp"
 #include "DTK_MapOperator.hpp"
+#include "DTK_ParallelSearch.hpp"
 #include "DTK_Types.hpp"
 
 #include <Teuchos_Array.hpp>
@@ -129,6 +131,12 @@ class ConsistentInterpolationOperator : virtual public MapOperator
      */
     bool hasTransposeApplyImpl() const override;
 
+    /*
+     * \brief Range data option. The range data is read when missed range
+     * data is kept.
+     */
+    bool applyUsesRangeDataImpl() const override;
+
   private:
     // Range entity topological dimension. Default is 0 (vertex).
     int d_range_entity_dim;
@@ -140,6 +148,12 @@ class ConsistentInterpolationOperator : virtual public MapOperator
     // Search sublist.
     Teuchos::ParameterList d_search_list;
 
+    // Parallel search communication plans kept between setups.
+    Teuchos::RCP<ParallelSearch::CommPlans> d_search_plans;
+
+    // Range-to-domain communication plan kept between setups.
+    Teuchos::RCP<CachedDistributor> d_range_to_domain_dist;
+
     // The coupling matrix.
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> d_coupling_matrix;
 
@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_CouplingMatrixBuilder.cpp
+ * \author Stuart R. Slattery
+ * \brief Coupling matrix assembly with a precomputed static graph.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <iterator>
+
+#include "DTK_CouplingMatrixBuilder.hpp"
+#include "DTK_DBC.hpp"
+#include "DTK_Profiler.hpp"
+
+#include <Teuchos_ArrayRCP.hpp>
+#include <Teuchos_OrdinalTraits.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+// Constructor.
+CouplingMatrixBuilder::CouplingMatrixBuilder(
+    const Teuchos::RCP<const TpetraMap> &domain_map,
+    const Teuchos::RCP<const TpetraMap> &range_map )
+    : d_domain_map( domain_map )
+    , d_range_map( range_map )
+    , d_segment_offsets( 1, 0 )
+{
+    DTK_REQUIRE( Teuchos::nonnull( d_domain_map ) );
+    DTK_REQUIRE( Teuchos::nonnull( d_range_map ) );
+}
+
+//---------------------------------------------------------------------------//
+// Add a dense block of entries.
+void CouplingMatrixBuilder::addBlock(
+    const Teuchos::ArrayView<const GO> &rows,
+    const Teuchos::ArrayView<const GO> &columns,
+    const Teuchos::ArrayView<const Scalar> &values )
+{
+    DTK_REQUIRE( values.size() == rows.size() * columns.size() );
+
+    int num_rows = rows.size();
+    int num_columns = columns.size();
+    for ( int i = 0; i < num_rows; ++i )
+    {
+        addRow( rows[i], columns, values( i * num_columns, num_columns ) );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Add the entries of a single row.
+void CouplingMatrixBuilder::addRow(
+    const GO row, const Teuchos::ArrayView<const GO> &columns,
+    const Teuchos::ArrayView<const Scalar> &values )
+{
+    DTK_REQUIRE( values.size() == columns.size() );
+
+    d_segment_rows.push_back( row );
+    std::copy( columns.begin(), columns.end(),
+               std::back_inserter( d_columns ) );
+    std::copy( values.begin(), values.end(), std::back_inserter( d_values ) );
+    d_segment_offsets.push_back( d_columns.size() );
+}
+
+//---------------------------------------------------------------------------//
+// Build the fill-complete matrix from the collected entries.
+Teuchos::RCP<CouplingMatrixBuilder::TpetraCrsMatrix>
+CouplingMatrixBuilder::build()
+{
+    ScopedTimer timer( "Coupling Matrix Build" );
+
+    // Record the memory of the collected entries.
+    Profiler::recordMemory( "Coupling Matrix Builder: Insert Buffers",
+                            containerBytes( d_segment_rows ) +
+                                containerBytes( d_segment_offsets ) +
+                                containerBytes( d_columns ) +
+                                containerBytes( d_values ) );
+
+    // Build the row and column maps from the collected ids.
+    Teuchos::RCP<const TpetraMap> row_map =
+        buildLocalMap( d_range_map, d_segment_rows );
+    Teuchos::RCP<const TpetraMap> col_map =
+        buildLocalMap( d_domain_map, d_columns );
+
+    // Convert the collected columns to local indices.
+    int num_entries = d_columns.size();
+    Teuchos::Array<LO> column_lids( num_entries );
+    for ( int n = 0; n < num_entries; ++n )
+    {
+        column_lids[n] = col_map->getLocalElement( d_columns[n] );
+        DTK_CHECK( Teuchos::OrdinalTraits<LO>::invalid() != column_lids[n] );
+    }
+    d_columns.clear();
+
+    // Group the row segments by local row.
+    int num_rows = row_map->getNodeNumElements();
+    int num_segments = d_segment_rows.size();
+    Teuchos::Array<LO> segment_lids( num_segments );
+    Teuchos::Array<int> row_segment_offsets( num_rows + 1, 0 );
+    for ( int s = 0; s < num_segments; ++s )
+    {
+        segment_lids[s] = row_map->getLocalElement( d_segment_rows[s] );
+        DTK_CHECK( Teuchos::OrdinalTraits<LO>::invalid() != segment_lids[s] );
+        ++row_segment_offsets[segment_lids[s] + 1];
+    }
+    d_segment_rows.clear();
+    for ( int r = 0; r < num_rows; ++r )
+    {
+        row_segment_offsets[r + 1] += row_segment_offsets[r];
+    }
+    Teuchos::Array<int> row_segments( num_segments );
+    Teuchos::Array<int> row_fill( row_segment_offsets.begin(),
+                                  row_segment_offsets.end() - 1 );
+    for ( int s = 0; s < num_segments; ++s )
+    {
+        row_segments[row_fill[segment_lids[s]]++] = s;
+    }
+    row_fill.clear();
+
+    // Compute the unique column indices of each row.
+    Teuchos::ArrayRCP<std::size_t> row_entries( num_rows, 0 );
+    Teuchos::Array<int> graph_offsets( num_rows + 1, 0 );
+    Teuchos::Array<LO> graph_indices;
+    graph_indices.reserve( num_entries );
+    int row_begin = 0;
+    Teuchos::Array<LO>::iterator unique_end;
+    for ( int r = 0; r < num_rows; ++r )
+    {
+        row_begin = graph_indices.size();
+        for ( int s = row_segment_offsets[r]; s < row_segment_offsets[r + 1];
+              ++s )
+        {
+            std::copy( column_lids.begin() +
+                           d_segment_offsets[row_segments[s]],
+                       column_lids.begin() +
+                           d_segment_offsets[row_segments[s] + 1],
+                       std::back_inserter( graph_indices ) );
+        }
+        std::sort( graph_indices.begin() + row_begin, graph_indices.end() );
+        unique_end = std::unique( graph_indices.begin() + row_begin,
+                                  graph_indices.end() );
+        graph_indices.resize(
+            std::distance( graph_indices.begin(), unique_end ) );
+        row_entries[r] = graph_indices.size() - row_begin;
+        graph_offsets[r + 1] = graph_indices.size();
+    }
+
+    // Record the memory of the local graph construction.
+    Profiler::recordMemory( "Coupling Matrix Builder: Graph Buffers",
+                            containerBytes( column_lids ) +
+                                containerBytes( segment_lids ) +
+                                containerBytes( row_segment_offsets ) +
+                                containerBytes( row_segments ) +
+                                containerBytes( graph_offsets ) +
+                                containerBytes( graph_indices ) +
+                                row_entries.size() * sizeof( std::size_t ) );
+
+    // Build the static graph. The column map is given so no global index
+    // lookups or column map construction occur at fill time.
+    Teuchos::RCP<TpetraCrsGraph> graph = Teuchos::rcp( new TpetraCrsGraph(
+        row_map, col_map, row_entries, Tpetra::StaticProfile ) );
+    for ( int r = 0; r < num_rows; ++r )
+    {
+        graph->insertLocalIndices(
+            r, graph_indices( graph_offsets[r], row_entries[r] ) );
+    }
+    {
+        ScopedTimer fill_timer( "Coupling Matrix Fill Complete" );
+        graph->fillComplete( d_domain_map, d_range_map );
+    }
+    graph_indices.clear();
+
+    // Sum the collected values into the matrix.
+    Teuchos::RCP<TpetraCrsMatrix> matrix =
+        Teuchos::rcp( new TpetraCrsMatrix( graph ) );
+    int offset = 0;
+    int length = 0;
+    for ( int s = 0; s < num_segments; ++s )
+    {
+        offset = d_segment_offsets[s];
+        length = d_segment_offsets[s + 1] - offset;
+        matrix->sumIntoLocalValues( segment_lids[s],
+                                    column_lids( offset, length ),
+                                    d_values( offset, length ) );
+    }
+    d_values.clear();
+    d_segment_offsets.assign( 1, 0 );
+
+    // The graph is fill complete so this only finalizes the values.
+    {
+        ScopedTimer fill_timer( "Coupling Matrix Fill Complete" );
+        matrix->fillComplete( d_domain_map, d_range_map );
+    }
+    DTK_ENSURE( matrix->isFillComplete() );
+    return matrix;
+}
+
+//---------------------------------------------------------------------------//
+// Build a map of the locally-owned ids of the given map followed by the
+// sorted unique off-process ids in the given list.
+Teuchos::RCP<const CouplingMatrixBuilder::TpetraMap>
+CouplingMatrixBuilder::buildLocalMap(
+    const Teuchos::RCP<const TpetraMap> &map,
+    const Teuchos::Array<GO> &ids ) const
+{
+    // Start with the owned ids so the import from the given map is a local
+    // copy for those entries.
+    Teuchos::ArrayView<const GO> owned_ids = map->getNodeElementList();
+    Teuchos::Array<GO> local_ids( owned_ids.begin(), owned_ids.end() );
+    int num_owned = local_ids.size();
+
+    // Append the unique off-process ids.
+    for ( auto id : ids )
+    {
+        if ( !map->isNodeGlobalElement( id ) )
+        {
+            local_ids.push_back( id );
+        }
+    }
+    std::sort( local_ids.begin() + num_owned, local_ids.end() );
+    auto local_ids_end =
+        std::unique( local_ids.begin() + num_owned, local_ids.end() );
+    local_ids.resize( std::distance( local_ids.begin(), local_ids_end ) );
+
+    return Teuchos::rcp(
+        new TpetraMap( Teuchos::OrdinalTraits<GO>::invalid(), local_ids(),
+                       map->getIndexBase(), map->getComm() ) );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_CouplingMatrixBuilder.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \brief DTK_CouplingMatrixBuilder.hpp
+ * \author Stuart R. Slattery
+ * \brief Coupling matrix assembly with a precomputed static graph.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_COUPLINGMATRIXBUILDER_HPP
+#define DTK_COUPLINGMATRIXBUILDER_HPP
+
+#include "DTK_MapOperator.hpp"
+#include "DTK_Types.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_ArrayView.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Tpetra_CrsGraph.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+  \class CouplingMatrixBuilder
+  \brief Coupling matrix builder.
+
+  Collects the entries of a coupling matrix produced from search results and
+  builds the matrix in one pass. Rows may be range support ids owned by any
+  process and columns may be any domain support ids. The row and column maps
+  are computed from the collected entries, a StaticProfile graph is built with
+  exact per-row counts, and the values are summed in with local indices so no
+  nonlocal insertions or graph reallocations occur.
+
+  The row map of the resulting matrix contains the locally-owned rows of the
+  range map followed by any off-process rows that were touched on this
+  process. When off-process rows exist the matrix applies with an export that
+  sums the row contributions into the range map and so is equivalent to the
+  globally-assembled matrix without requiring a global assembly at fill time.
+*/
+//---------------------------------------------------------------------------//
+class CouplingMatrixBuilder
+{
+  public:
+    //@{
+    //! Type aliases.
+    typedef MapOperator::Root Root;
+    typedef typename Root::scalar_type Scalar;
+    typedef typename Root::local_ordinal_type LO;
+    typedef typename Root::global_ordinal_type GO;
+    typedef MapOperator::TpetraMap TpetraMap;
+    typedef Tpetra::CrsGraph<LO, GO> TpetraCrsGraph;
+    typedef Tpetra::CrsMatrix<Scalar, LO, GO> TpetraCrsMatrix;
+    //@}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param domain_map Parallel map of the matrix columns.
+     *
+     * \param range_map Parallel map of the matrix rows.
+     */
+    CouplingMatrixBuilder( const Teuchos::RCP<const TpetraMap> &domain_map,
+                           const Teuchos::RCP<const TpetraMap> &range_map );
+
+    /*!
+     * \brief Add a dense block of entries.
+     *
+     * \param rows The range support ids of the block rows.
+     *
+     * \param columns The domain support ids of the block columns.
+     *
+     * \param values The block values ordered row-major, i.e. the value of row
+     * i and column j is values[i*columns.size() + j].
+     */
+    void addBlock( const Teuchos::ArrayView<const GO> &rows,
+                   const Teuchos::ArrayView<const GO> &columns,
+                   const Teuchos::ArrayView<const Scalar> &values );
+
+    /*!
+     * \brief Add the entries of a single row.
+     *
+     * \param row The range support id of the row.
+     *
+     * \param columns The domain support ids of the entries.
+     *
+     * \param values The entry values.
+     */
+    void addRow( const GO row, const Teuchos::ArrayView<const GO> &columns,
+                 const Teuchos::ArrayView<const Scalar> &values );
+
+    /*!
+     * \brief Build the fill-complete matrix from the collected entries. Entries
+     * added more than once are summed. This is a collective operation. The
+     * collected entries are released.
+     *
+     * \return The coupling matrix with the given domain and range maps.
+     */
+    Teuchos::RCP<TpetraCrsMatrix> build();
+
+  private:
+    // Build a map of the locally-owned ids of the given map followed by the
+    // sorted unique off-process ids in the given list.
+    Teuchos::RCP<const TpetraMap>
+    buildLocalMap( const Teuchos::RCP<const TpetraMap> &map,
+                   const Teuchos::Array<GO> &ids ) const;
+
+  private:
+    // Domain map.
+    Teuchos::RCP<const TpetraMap> d_domain_map;
+
+    // Range map.
+    Teuchos::RCP<const TpetraMap> d_range_map;
+
+    // Row id of each collected row segment.
+    Teuchos::Array<GO> d_segment_rows;
+
+    // Offsets of each row segment into the column and value arrays.
+    Teuchos::Array<std::size_t> d_segment_offsets;
+
+    // Column ids of the collected entries.
+    Teuchos::Array<GO> d_columns;
+
+    // Values of the collected entries.
+    Teuchos::Array<Scalar> d_values;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_COUPLINGMATRIXBUILDER_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_CouplingMatrixBuilder.hpp
+//---------------------------------------------------------------------------//
@@ -39,31 +39,67 @@
 //---------------------------------------------------------------------------//
 
 #include <algorithm>
-#include <map>
+#include <cstring>
+#include <iterator>
+#include <tuple>
 
 #include "DTK_BasicEntityPredicates.hpp"
+#include "DTK_CouplingMatrixBuilder.hpp"
 #include "DTK_DBC.hpp"
 #include "DTK_IntegrationPoint.hpp"
 #include "DTK_L2ProjectionOperator.hpp"
 #include "DTK_ParallelSearch.hpp"
 #include "DTK_PredicateComposition.hpp"
+#include "DTK_Profiler.hpp"
 
 #include <Teuchos_OrdinalTraits.hpp>
 
 #include <Teuchos_XMLParameterListCoreHelpers.hpp>
 
+#include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_Distributor.hpp>
+#include <Tpetra_Export.hpp>
 
+#include <BelosBlockCGSolMgr.hpp>
 #include <BelosPseudoBlockCGSolMgr.hpp>
 
+#include <Thyra_DefaultDiagonalLinearOp.hpp>
+#include <Thyra_DefaultLinearOpSource.hpp>
 #include <Thyra_DefaultMultipliedLinearOp.hpp>
+#include <Thyra_DefaultPreconditioner.hpp>
 #include <Thyra_LinearOpWithSolveFactoryHelpers.hpp>
+#include <Thyra_MultiVectorStdOps.hpp>
 #include <Thyra_TpetraThyraWrappers.hpp>
 
 #include <Stratimikos_DefaultLinearSolverBuilder.hpp>
 
 namespace DataTransferKit
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Pack an id into a word of a communication record without loss of
+// precision.
+double packId( const EntityId id )
+{
+    static_assert( sizeof( EntityId ) == sizeof( double ),
+                   "Ids must pack into a single word" );
+    double word = 0.0;
+    std::memcpy( &word, &id, sizeof( double ) );
+    return word;
+}
+
+//---------------------------------------------------------------------------//
+// Unpack an id from a word of a communication record.
+EntityId unpackId( const double word )
+{
+    EntityId id = 0;
+    std::memcpy( &id, &word, sizeof( double ) );
+    return id;
+}
+
+} // end anonymous namespace
+
 //---------------------------------------------------------------------------//
 // Constructor.
 L2ProjectionOperator::L2ProjectionOperator(
@@ -71,6 +107,11 @@ L2ProjectionOperator::L2ProjectionOperator(
     const Teuchos::RCP<const TpetraMap> &range_map,
     const Teuchos::ParameterList &parameters )
     : Base( domain_map, range_map )
+    , d_solver_type( "Pseudo Block CG" )
+    , d_prec_type( "None" )
+    , d_solver_tol( 1.0e-10 )
+    , d_solver_max_iters( 1000 )
+    , d_solver_verbose( false )
 {
     // Get the integration order.
     const Teuchos::ParameterList &l2_list =
@@ -78,6 +119,37 @@ L2ProjectionOperator::L2ProjectionOperator(
     DTK_REQUIRE( l2_list.isParameter( "Integration Order" ) );
     d_int_order = l2_list.get<int>( "Integration Order" );
 
+    // Get the mass matrix solver type.
+    if ( l2_list.isParameter( "Solver Type" ) )
+    {
+        d_solver_type = l2_list.get<std::string>( "Solver Type" );
+        DTK_INSIST( "Pseudo Block CG" == d_solver_type ||
+                    "Block CG" == d_solver_type ||
+                    "Lumped Mass" == d_solver_type );
+    }
+
+    // Get the mass matrix preconditioner type.
+    if ( l2_list.isParameter( "Preconditioner Type" ) )
+    {
+        d_prec_type = l2_list.get<std::string>( "Preconditioner Type" );
+        DTK_INSIST( "None" == d_prec_type || "Diagonal" == d_prec_type ||
+                    "Lumped Mass" == d_prec_type );
+    }
+
+    // Get the mass matrix solver controls.
+    if ( l2_list.isParameter( "Convergence Tolerance" ) )
+    {
+        d_solver_tol = l2_list.get<double>( "Convergence Tolerance" );
+    }
+    if ( l2_list.isParameter( "Maximum Iterations" ) )
+    {
+        d_solver_max_iters = l2_list.get<int>( "Maximum Iterations" );
+    }
+    if ( l2_list.isParameter( "Verbose Solver" ) )
+    {
+        d_solver_verbose = l2_list.get<bool>( "Verbose Solver" );
+    }
+
     // Get the search list.
     d_search_list = parameters.sublist( "Search" );
 }
@@ -128,6 +200,8 @@ void L2ProjectionOperator::setupImpl(
     Teuchos::RCP<IntegrationPointSet> range_ip_set;
     assembleMassMatrix( range_space, range_iterator, mass_matrix,
                         range_ip_set );
+    Profiler::recordMemory( "L2 Projection: Integration Point Set",
+                            range_ip_set->memoryBytes() );
 
     // Assemble the coupling matrix.
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> coupling_matrix;
@@ -160,36 +234,86 @@ void L2ProjectionOperator::setupImpl(
         ->constInitialize( thyra_range_vector_space_A,
                            thyra_domain_vector_space_A, coupling_matrix );
 
-    // Create the inverse of the mass matrix. Use the conjugate gradient
-    // method to invert the SPD mass matrix.
-    Teuchos::RCP<Teuchos::ParameterList> builder_params =
-        Teuchos::parameterList( "Stratimikos" );
-
-    builder_params->set( "Linear Solver Type", "Belos" );
-    builder_params->set( "Preconditioner Type", "None" );
-
-    auto &linear_solver_types_list =
-        builder_params->sublist( "Linear Solver Types" );
-    auto &belos_list = linear_solver_types_list.sublist( "Belos" );
-    belos_list.set( "Solver Type", "Pseudo Block CG" );
-    auto &solver_types_list = belos_list.sublist( "Solver Types" );
-    auto &cg_list = solver_types_list.sublist( "Pseudo Block CG" );
-    cg_list.set( "Convergence Tolerance", 1.0e-10 );
-    cg_list.set( "Verbosity", Belos::Errors + Belos::Warnings +
-                                  Belos::TimingDetails + Belos::FinalSummary +
-                                  Belos::StatusTestDetails );
-    cg_list.set( "Output Frequency", 1 );
-
-    Stratimikos::DefaultLinearSolverBuilder builder;
-    builder.setParameterList( builder_params );
-    Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<double>> factory =
-        Thyra::createLinearSolveStrategy( builder );
-    Teuchos::RCP<const Thyra::LinearOpBase<double>> thyra_M_inv =
-        Thyra::inverse<double>( *factory, thyra_M );
-
-    // Create the projection operator: Op = M^-1 * A.
-    d_l2_operator = Thyra::multiply<double>( thyra_M_inv, thyra_A );
-    DTK_ENSURE( Teuchos::nonnull( d_l2_operator ) );
+    d_coupling_matrix = thyra_A;
+
+    // If the mass matrix is lumped its inverse is a diagonal scaling and no
+    // solve is needed. Create the projection operator: Op = M^-1 * A.
+    if ( "Lumped Mass" == d_solver_type )
+    {
+        Teuchos::RCP<const Thyra::LinearOpBase<double>> thyra_M_inv =
+            Thyra::diagonal<double>( Thyra::createConstVector<double>(
+                buildInverseDiagonal( *mass_matrix, true ) ) );
+        d_l2_operator = Thyra::multiply<double>( thyra_M_inv, thyra_A );
+        d_mass_solver = Teuchos::null;
+        DTK_ENSURE( Teuchos::nonnull( d_l2_operator ) );
+    }
+
+    // Otherwise create a solver for the mass matrix. Use the conjugate
+    // gradient method to invert the SPD mass matrix. The solve is done
+    // explicitly on apply so the iteration count can be recorded.
+    else
+    {
+        ScopedTimer timer( "Mass Matrix Solver Setup" );
+
+        Teuchos::RCP<Teuchos::ParameterList> builder_params =
+            Teuchos::parameterList( "Stratimikos" );
+
+        builder_params->set( "Linear Solver Type", "Belos" );
+        builder_params->set( "Preconditioner Type", "None" );
+
+        auto &linear_solver_types_list =
+            builder_params->sublist( "Linear Solver Types" );
+        auto &belos_list = linear_solver_types_list.sublist( "Belos" );
+        belos_list.set( "Solver Type", d_solver_type );
+        auto &solver_types_list = belos_list.sublist( "Solver Types" );
+        auto &cg_list = solver_types_list.sublist( d_solver_type );
+        cg_list.set( "Convergence Tolerance", d_solver_tol );
+        cg_list.set( "Maximum Iterations", d_solver_max_iters );
+        if ( d_solver_verbose )
+        {
+            cg_list.set( "Verbosity",
+                         Belos::Errors + Belos::Warnings +
+                             Belos::TimingDetails + Belos::FinalSummary +
+                             Belos::StatusTestDetails );
+            cg_list.set( "Output Frequency", 1 );
+        }
+        else
+        {
+            cg_list.set( "Verbosity", Belos::Errors + Belos::Warnings );
+        }
+
+        Stratimikos::DefaultLinearSolverBuilder builder;
+        builder.setParameterList( builder_params );
+        Teuchos::RCP<Thyra::LinearOpWithSolveFactoryBase<double>> factory =
+            Thyra::createLinearSolveStrategy( builder );
+
+        // Without a preconditioner solve with the mass matrix directly.
+        if ( "None" == d_prec_type )
+        {
+            d_mass_solver =
+                Thyra::linearOpWithSolve<double>( *factory, thyra_M );
+        }
+
+        // Otherwise precondition the solve with the inverse of the mass
+        // matrix diagonal or lumped mass matrix.
+        else
+        {
+            Teuchos::RCP<const Thyra::LinearOpBase<double>> thyra_D_inv =
+                Thyra::diagonal<double>( Thyra::createConstVector<double>(
+                    buildInverseDiagonal( *mass_matrix,
+                                          "Lumped Mass" == d_prec_type ) ) );
+            Teuchos::RCP<Thyra::LinearOpWithSolveBase<double>> M_lows =
+                factory->createOp();
+            factory->initializePreconditionedOp(
+                Thyra::defaultLinearOpSource<double>( thyra_M ),
+                Thyra::unspecifiedPrec<double>( thyra_D_inv ), M_lows.ptr(),
+                Thyra::SUPPORT_SOLVE_FORWARD_ONLY );
+            d_mass_solver = M_lows;
+        }
+
+        d_l2_operator = Teuchos::null;
+        DTK_ENSURE( Teuchos::nonnull( d_mass_solver ) );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -204,8 +328,39 @@ void L2ProjectionOperator::applyImpl( const TpetraMultiVector &X,
         Thyra::createConstMultiVector<double>( Teuchos::rcpFromRef( X ) );
     Teuchos::RCP<Thyra::MultiVectorBase<double>> thyra_Y =
         Thyra::createMultiVector<double>( Teuchos::rcpFromRef( Y ) );
-    d_l2_operator->apply( Thyra::NOTRANS, *thyra_X, thyra_Y.ptr(), alpha,
-                          beta );
+
+    // With a lumped mass matrix apply the projection operator directly.
+    if ( Teuchos::nonnull( d_l2_operator ) )
+    {
+        d_l2_operator->apply( Thyra::NOTRANS, *thyra_X, thyra_Y.ptr(), alpha,
+                              beta );
+        return;
+    }
+
+    // Otherwise apply the coupling matrix: AX = A * X.
+    int num_vecs = thyra_X->domain()->dim();
+    Teuchos::RCP<Thyra::MultiVectorBase<double>> thyra_AX =
+        Thyra::createMembers( d_coupling_matrix->range(), num_vecs );
+    d_coupling_matrix->apply( Thyra::NOTRANS, *thyra_X, thyra_AX.ptr(), 1.0,
+                              0.0 );
+
+    // Solve the mass matrix problem: M * Z = AX.
+    Teuchos::RCP<Thyra::MultiVectorBase<double>> thyra_Z =
+        Thyra::createMembers( d_mass_solver->domain(), num_vecs );
+    Thyra::assign( thyra_Z.ptr(), 0.0 );
+    Thyra::SolveStatus<double> status =
+        d_mass_solver->solve( Thyra::NOTRANS, *thyra_AX, thyra_Z.ptr() );
+    if ( Teuchos::nonnull( status.extraParameters ) &&
+         status.extraParameters->isType<int>( "Belos/Iteration Count" ) )
+    {
+        Profiler::recordCount(
+            "L2 Projection: Krylov Iterations",
+            status.extraParameters->get<int>( "Belos/Iteration Count" ) );
+    }
+
+    // Update the range: Y = alpha * Z + beta * Y.
+    Thyra::scale( beta, thyra_Y.ptr() );
+    Thyra::Vp_StV( thyra_Y.ptr(), alpha, *thyra_Z );
 }
 
 //---------------------------------------------------------------------------//
@@ -220,11 +375,11 @@ void L2ProjectionOperator::assembleMassMatrix(
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> &mass_matrix,
     Teuchos::RCP<IntegrationPointSet> &range_ip_set )
 {
+    ScopedTimer timer( "Mass Matrix Assembly" );
+
     // Initialize output variables.
     Teuchos::RCP<const Teuchos::Comm<int>> range_comm =
         range_space->entitySet()->communicator();
-    mass_matrix =
-        Tpetra::createCrsMatrix<Scalar, LO, GO>( this->getRangeMap() );
     range_ip_set = Teuchos::rcp( new IntegrationPointSet( range_comm ) );
 
     // Get function space objects.
@@ -234,21 +389,18 @@ void L2ProjectionOperator::assembleMassMatrix(
     Teuchos::RCP<EntityIntegrationRule> range_integration_rule =
         range_space->integrationRule();
 
-    // Initialize data for assembly loop.
+    // Initialize data for the integration point loop.
+    int space_dim = range_space->entitySet()->physicalDimension();
     double range_entity_measure = 0.0;
-    IntegrationPoint range_ip;
-    range_ip.d_physical_coordinates.resize(
-        range_space->entitySet()->physicalDimension() );
     Teuchos::Array<Teuchos::Array<double>> int_points;
     Teuchos::Array<double> int_weights;
-    Teuchos::Array<Teuchos::Array<double>> shape_evals;
+    Teuchos::Array<double> shape_evals;
+    Teuchos::Array<double> physical_coords;
     Teuchos::Array<SupportId> range_support_ids;
-    Teuchos::Array<double> mm_values;
-    int range_cardinality = 0;
     int num_ip = 0;
-    double temp = 0;
 
-    // Assemble the mass matrix and integration point set.
+    // Build the integration point set. The shape functions of each entity
+    // are evaluated at all of its integration points at once.
     EntityIterator range_it;
     EntityIterator range_begin = range_iterator.begin();
     EntityIterator range_end = range_iterator.end();
@@ -264,55 +416,138 @@ void L2ProjectionOperator::assembleMassMatrix(
         range_integration_rule->getIntegrationRule( *range_it, d_int_order,
                                                     int_points, int_weights );
 
-        // Create new integration points.
+        // Evaluate the shape function at all integration points.
+        range_shape_function->evaluateValues( *range_it, int_points,
+                                              shape_evals );
+
+        // Map the integration points to the physical frame of the range
+        // entity.
         num_ip = int_weights.size();
-        shape_evals.resize( num_ip );
+        physical_coords.resize( num_ip * space_dim );
         for ( int p = 0; p < num_ip; ++p )
         {
-            // Add owner data.
-            range_ip.d_owner_measure = range_entity_measure;
-            range_ip.d_owner_support_ids = range_support_ids;
-            range_ip.d_integration_weight = int_weights[p];
-
-            // Evaluate the shape function.
-            range_shape_function->evaluateValue( *range_it, int_points[p](),
-                                                 shape_evals[p] );
-            range_ip.d_owner_shape_evals = shape_evals[p];
-
-            // Map the integration point to the physical frame of the range
-            // entity.
             range_local_map->mapToPhysicalFrame(
-                *range_it, int_points[p](), range_ip.d_physical_coordinates() );
+                *range_it, int_points[p](),
+                physical_coords( p * space_dim, space_dim ) );
+        }
+
+        // Add the integration points to the set.
+        range_ip_set->addEntity( range_entity_measure, range_support_ids(),
+                                 int_weights(), physical_coords(),
+                                 shape_evals() );
+    }
+
+    // Finalize the integration point set.
+    range_ip_set->finalize();
 
-            // Add the integration point to the set.
-            range_ip_set->addPoint( range_ip );
+    // Build an overlapping map of all the range support ids touched by local
+    // entities.
+    Teuchos::ArrayView<const SupportId> all_support_ids =
+        range_ip_set->allOwnerSupportIds();
+    Teuchos::Array<GO> overlap_ids( all_support_ids.begin(),
+                                    all_support_ids.end() );
+    std::sort( overlap_ids.begin(), overlap_ids.end() );
+    auto overlap_ids_end =
+        std::unique( overlap_ids.begin(), overlap_ids.end() );
+    overlap_ids.resize( std::distance( overlap_ids.begin(), overlap_ids_end ) );
+    Teuchos::RCP<const TpetraMap> overlap_map = Teuchos::rcp( new TpetraMap(
+        Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid(),
+        overlap_ids(), this->getRangeMap()->getIndexBase(), range_comm ) );
+
+    // Compute the local ids of the support ids of each entity and bound the
+    // number of entries in each row of the overlapping graph.
+    int num_owners = range_ip_set->numOwners();
+    Teuchos::Array<LO> owner_lids( all_support_ids.size() );
+    Teuchos::ArrayRCP<std::size_t> row_entries( overlap_ids.size(), 0 );
+    int range_cardinality = 0;
+    int first_ip = 0;
+    int lid_offset = 0;
+    for ( int o = 0; o < num_owners; ++o )
+    {
+        first_ip = range_ip_set->ownerFirstPoint( o );
+        range_cardinality = range_ip_set->ownerSupportIds( first_ip ).size();
+        for ( int n = 0; n < range_cardinality; ++n )
+        {
+            owner_lids[lid_offset + n] =
+                overlap_map->getLocalElement( all_support_ids[lid_offset + n] );
+            row_entries[owner_lids[lid_offset + n]] += range_cardinality;
         }
+        lid_offset += range_cardinality;
+    }
 
-        // Fill the mass matrix.
-        range_cardinality = range_support_ids.size();
-        for ( int ni = 0; ni < range_cardinality; ++ni )
+    // Build the overlapping mass matrix graph from the entity connectivity.
+    Teuchos::RCP<Tpetra::CrsGraph<LO, GO>> overlap_graph =
+        Teuchos::rcp( new Tpetra::CrsGraph<LO, GO>(
+            overlap_map, overlap_map, row_entries, Tpetra::StaticProfile ) );
+    lid_offset = 0;
+    for ( int o = 0; o < num_owners; ++o )
+    {
+        first_ip = range_ip_set->ownerFirstPoint( o );
+        range_cardinality = range_ip_set->ownerSupportIds( first_ip ).size();
+        Teuchos::ArrayView<const LO> entity_lids =
+            owner_lids( lid_offset, range_cardinality );
+        for ( int n = 0; n < range_cardinality; ++n )
         {
-            mm_values.assign( range_cardinality, 0.0 );
-            for ( int p = 0; p < num_ip; ++p )
+            overlap_graph->insertLocalIndices( entity_lids[n], entity_lids );
+        }
+        lid_offset += range_cardinality;
+    }
+    overlap_graph->fillComplete( this->getRangeMap(), this->getRangeMap() );
+    row_entries.clear();
+
+    // Sum the entity mass matrices into the overlapping matrix.
+    Tpetra::CrsMatrix<Scalar, LO, GO> overlap_matrix( overlap_graph );
+    Teuchos::Array<double> mm_values;
+    Teuchos::ArrayView<const double> ip_shape_evals;
+    double temp = 0.0;
+    lid_offset = 0;
+    for ( int o = 0; o < num_owners; ++o )
+    {
+        first_ip = range_ip_set->ownerFirstPoint( o );
+        num_ip = range_ip_set->ownerNumPoints( o );
+        range_cardinality = range_ip_set->ownerSupportIds( first_ip ).size();
+        range_entity_measure = range_ip_set->ownerMeasure( first_ip );
+
+        // Compute the dense entity mass matrix.
+        mm_values.assign( range_cardinality * range_cardinality, 0.0 );
+        for ( int p = first_ip; p < first_ip + num_ip; ++p )
+        {
+            ip_shape_evals = range_ip_set->ownerShapeEvals( p );
+            for ( int ni = 0; ni < range_cardinality; ++ni )
             {
-                temp =
-                    range_entity_measure * int_weights[p] * shape_evals[p][ni];
+                temp = range_entity_measure *
+                       range_ip_set->integrationWeight( p ) *
+                       ip_shape_evals[ni];
                 for ( int nj = 0; nj < range_cardinality; ++nj )
                 {
-                    mm_values[nj] += temp * shape_evals[p][nj];
+                    mm_values[ni * range_cardinality + nj] +=
+                        temp * ip_shape_evals[nj];
                 }
             }
-            mass_matrix->insertGlobalValues( range_support_ids[ni],
-                                             range_support_ids(), mm_values() );
         }
+
+        // Sum into the local rows.
+        Teuchos::ArrayView<const LO> entity_lids =
+            owner_lids( lid_offset, range_cardinality );
+        for ( int ni = 0; ni < range_cardinality; ++ni )
+        {
+            overlap_matrix.sumIntoLocalValues(
+                entity_lids[ni], entity_lids,
+                mm_values( ni * range_cardinality, range_cardinality ) );
+        }
+        lid_offset += range_cardinality;
     }
+    overlap_matrix.fillComplete( this->getRangeMap(), this->getRangeMap() );
+
+    // Export the overlapping matrix to the uniquely-owned mass matrix.
+    mass_matrix =
+        Tpetra::createCrsMatrix<Scalar, LO, GO>( this->getRangeMap() );
+    Tpetra::Export<LO, GO> overlap_exporter( overlap_map, this->getRangeMap() );
+    mass_matrix->doExport( overlap_matrix, overlap_exporter, Tpetra::ADD );
 
     // Finalize the mass matrix.
     mass_matrix->fillComplete( this->getRangeMap(), this->getRangeMap() );
     DTK_CHECK( mass_matrix->isFillComplete() );
-
-    // Finalize the integration point set.
-    range_ip_set->finalize();
 }
 
 //---------------------------------------------------------------------------//
@@ -322,6 +557,8 @@ void L2ProjectionOperator::assembleCouplingMatrix(
     const Teuchos::RCP<IntegrationPointSet> &range_ip_set,
     Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> &coupling_matrix )
 {
+    ScopedTimer timer( "Coupling Matrix Assembly" );
+
     // Get the parallel communicator.
     Teuchos::RCP<const Teuchos::Comm<int>> comm =
         domain_space->entitySet()->communicator();
@@ -329,184 +566,278 @@ void L2ProjectionOperator::assembleCouplingMatrix(
     // Get the physical dimension.
     int physical_dimension = domain_space->entitySet()->physicalDimension();
 
-    // Build a parallel search over the domain.
+    // Build a parallel search over the domain. The communication plans are
+    // kept between setups so they are reused if the decompositions are
+    // unchanged.
+    if ( Teuchos::is_null( d_search_plans ) )
+    {
+        d_search_plans =
+            Teuchos::rcp( new ParallelSearch::CommPlans( comm ) );
+        d_range_to_domain_dist = Teuchos::rcp( new CachedDistributor( comm ) );
+    }
     ParallelSearch psearch( comm, physical_dimension, domain_iterator,
-                            domain_space->localMap(), d_search_list );
+                            domain_space->localMap(), d_search_list,
+                            d_search_plans );
 
     // Search the domain with the range integration point set.
     EntityIterator ip_iterator = range_ip_set->entityIterator();
     psearch.search( ip_iterator, range_ip_set, d_search_list );
 
     // Extract the set of local range entities that were found in domain
-    // entities.
-    int global_max_support = range_ip_set->globalMaxSupportSize();
-    int ip_stride = global_max_support + 1;
+    // entities. Each integration point-domain pair is packed into a
+    // variable-length record of words:
+    //   [ip id, domain id, measure * weight, n, n shape evals, n support ids]
+    // with one destination rank per word so the whole record set moves in a
+    // single exchange.
     Teuchos::Array<int> export_ranks;
-    Teuchos::Array<EntityId> export_ip_domain_ids;
-    Teuchos::Array<double> export_measures_weights;
-    Teuchos::Array<double> export_shape_evals;
-    Teuchos::Array<SupportId> export_support_ids;
+    Teuchos::Array<double> export_words;
     Teuchos::Array<EntityId> domain_ids;
     Teuchos::Array<EntityId>::const_iterator domain_id_it;
     EntityIterator ip_it;
     EntityIterator ip_begin = ip_iterator.begin();
     EntityIterator ip_end = ip_iterator.end();
     int num_support = 0;
+    int domain_rank = 0;
+    int record_size = 0;
     for ( ip_it = ip_begin; ip_it != ip_end; ++ip_it )
     {
         // Get the domain entities in which the integration point was found.
         psearch.getDomainEntitiesFromRange( ip_it->id(), domain_ids );
 
         // Get the current integration point.
-        const IntegrationPoint &current_ip =
-            range_ip_set->getPoint( ip_it->id() );
-
-        // For each supporting domain entity, pair the integration point id
-        // and its support id.
+        int ip_lid = range_ip_set->localId( ip_it->id() );
+        Teuchos::ArrayView<const SupportId> ip_support_ids =
+            range_ip_set->ownerSupportIds( ip_lid );
+        Teuchos::ArrayView<const double> ip_shape_evals =
+            range_ip_set->ownerShapeEvals( ip_lid );
+        num_support = ip_support_ids.size();
+        record_size = 4 + 2 * num_support;
+
+        // For each supporting domain entity, pack a record for the
+        // integration point.
         for ( domain_id_it = domain_ids.begin();
               domain_id_it != domain_ids.end(); ++domain_id_it )
         {
-            // Add the domain rank.
-            export_ranks.push_back(
-                psearch.domainEntityOwnerRank( *domain_id_it ) );
+            // Add the domain rank for each word in the record.
+            domain_rank = psearch.domainEntityOwnerRank( *domain_id_it );
+            export_ranks.resize( export_ranks.size() + record_size,
+                                 domain_rank );
 
             // Add the ip-domain id pair.
-            export_ip_domain_ids.push_back( ip_it->id() );
-            export_ip_domain_ids.push_back( *domain_id_it );
+            export_words.push_back( packId( ip_it->id() ) );
+            export_words.push_back( packId( *domain_id_it ) );
 
             // Add the ip weights times measures scaled by the number of
             // domains in which ip was found.
-            export_measures_weights.push_back( current_ip.d_owner_measure *
-                                               current_ip.d_integration_weight /
-                                               domain_ids.size() );
-
-            // Add the ip shape function evals and support ids with padding.
-            num_support = current_ip.d_owner_support_ids.size();
-            export_shape_evals.push_back( num_support );
-            export_support_ids.push_back( num_support );
+            export_words.push_back( range_ip_set->ownerMeasure( ip_lid ) *
+                                    range_ip_set->integrationWeight( ip_lid ) /
+                                    domain_ids.size() );
+
+            // Add the ip shape function evals and support ids.
+            export_words.push_back( num_support );
             for ( int i = 0; i < num_support; ++i )
             {
-                export_shape_evals.push_back(
-                    current_ip.d_owner_shape_evals[i] );
-                export_support_ids.push_back(
-                    current_ip.d_owner_support_ids[i] );
+                export_words.push_back( ip_shape_evals[i] );
             }
-            for ( int i = num_support; i < global_max_support; ++i )
+            for ( int i = 0; i < num_support; ++i )
             {
-                export_shape_evals.push_back( 0.0 );
-                export_support_ids.push_back( 0 );
+                export_words.push_back( packId( ip_support_ids[i] ) );
             }
         }
     }
 
     // Communicate the integration points to the domain parallel
     // decomposition.
-    Tpetra::Distributor range_to_domain_dist( comm );
-    int num_import = range_to_domain_dist.createFromSends( export_ranks() );
-    Teuchos::Array<EntityId> import_ip_domain_ids( 2 * num_import );
-    range_to_domain_dist.doPostsAndWaits( export_ip_domain_ids().getConst(), 2,
-                                          import_ip_domain_ids() );
-    Teuchos::Array<double> import_measures_weights( num_import );
-    range_to_domain_dist.doPostsAndWaits( export_measures_weights().getConst(),
-                                          1, import_measures_weights() );
-    Teuchos::Array<double> import_shape_evals( ip_stride * num_import );
-    range_to_domain_dist.doPostsAndWaits( export_shape_evals().getConst(),
-                                          ip_stride, import_shape_evals() );
-    Teuchos::Array<SupportId> import_support_ids( ip_stride * num_import );
-    range_to_domain_dist.doPostsAndWaits( export_support_ids().getConst(),
-                                          ip_stride, import_support_ids() );
-
-    // Map the ip-domain pairs to a local id.
-    std::map<std::pair<EntityId, EntityId>, int> ip_domain_lid_map;
-    std::pair<EntityId, EntityId> lid_pair;
-    for ( int n = 0; n < num_import; ++n )
-    {
-        lid_pair.first = import_ip_domain_ids[2 * n];
-        lid_pair.second = import_ip_domain_ids[2 * n + 1];
-        ip_domain_lid_map[lid_pair] = n;
-    }
+    int num_import_words =
+        d_range_to_domain_dist->createFromSends( export_ranks() );
+    Teuchos::Array<double> import_words( num_import_words );
+    d_range_to_domain_dist->doPostsAndWaits(
+        export_words().getConst(), 1, import_words() );
+    Profiler::recordMemory( "L2 Projection: Integration Point Exchange",
+                            containerBytes( export_ranks ) +
+                                containerBytes( export_words ) +
+                                containerBytes( import_words ) );
 
     // Cleanup before filling the matrix.
-    import_ip_domain_ids.clear();
     export_ranks.clear();
-    export_ip_domain_ids.clear();
-    export_measures_weights.clear();
-    export_shape_evals.clear();
-    export_support_ids.clear();
+    export_words.clear();
 
-    // Allocate the coupling matrix.
-    coupling_matrix =
-        Tpetra::createCrsMatrix<Scalar, LO, GO>( this->getRangeMap() );
+    // Find the start of each imported record and the domain entity it was
+    // found in.
+    Teuchos::Array<int> import_offsets;
+    Teuchos::Array<EntityId> import_domain_ids;
+    for ( int offset = 0; offset < num_import_words; offset += record_size )
+    {
+        import_offsets.push_back( offset );
+        import_domain_ids.push_back( unpackId( import_words[offset + 1] ) );
+        record_size = 4 + 2 * static_cast<int>( import_words[offset + 3] );
+    }
+    int num_import = import_offsets.size();
 
-    // Construct the entries of the coupling matrix.
-    Teuchos::Array<EntityId> ip_entity_ids;
-    Teuchos::Array<EntityId>::const_iterator ip_entity_id_it;
+    // Sort the records by domain entity so the integration points in each
+    // domain entity are found with a binary search.
+    Teuchos::Array<int> import_order( num_import );
+    for ( int n = 0; n < num_import; ++n )
+    {
+        import_order[n] = n;
+    }
+    std::sort( import_order.begin(), import_order.end(),
+               [&]( const int a, const int b ) {
+                   return import_domain_ids[a] < import_domain_ids[b];
+               } );
+    Teuchos::Array<EntityId> sorted_domain_ids( num_import );
+    for ( int n = 0; n < num_import; ++n )
+    {
+        sorted_domain_ids[n] = import_domain_ids[import_order[n]];
+    }
+    import_domain_ids.clear();
+
+    // Collect the coupling matrix entries.
+    CouplingMatrixBuilder matrix_builder( this->getDomainMap(),
+                                          this->getRangeMap() );
+
+    // Construct the entries of the coupling matrix. All integration points
+    // found in a domain entity are processed together and each coupling
+    // matrix row touched by the entity is inserted once.
     Teuchos::ArrayView<const double> ip_parametric_coords;
+    Teuchos::Array<Teuchos::Array<double>> ip_entity_coords;
     Teuchos::Array<double> domain_shape_values;
     Teuchos::Array<double> cm_values;
-    Teuchos::Array<double>::iterator domain_shape_it;
+    Teuchos::Array<GO> cm_rows;
+    Teuchos::Array<GO>::iterator cm_row_it;
     Teuchos::Array<GO> domain_support_ids;
+    Teuchos::Array<EntityId>::iterator sorted_begin;
+    Teuchos::Array<EntityId>::iterator sorted_end;
     EntityIterator domain_it;
     EntityIterator domain_begin = domain_iterator.begin();
     EntityIterator domain_end = domain_iterator.end();
-    int local_id = 0;
+    int first_record = 0;
+    int offset = 0;
+    int num_entity_ip = 0;
     int range_cardinality = 0;
     int domain_cardinality = 0;
+    int row_index = 0;
+    GO range_support_id = 0;
     double temp = 0.0;
-    int ip_index;
     for ( domain_it = domain_begin; domain_it != domain_end; ++domain_it )
     {
+        // Get the integration point records that mapped into this domain
+        // entity.
+        std::tie( sorted_begin, sorted_end ) =
+            std::equal_range( sorted_domain_ids.begin(),
+                              sorted_domain_ids.end(), domain_it->id() );
+        num_entity_ip = std::distance( sorted_begin, sorted_end );
+        if ( 0 == num_entity_ip )
+        {
+            continue;
+        }
+        first_record = std::distance( sorted_domain_ids.begin(), sorted_begin );
+
         // Get the domain Support ids supporting the domain entity.
         domain_space->shapeFunction()->entitySupportIds( *domain_it,
                                                          domain_support_ids );
+        domain_cardinality = domain_support_ids.size();
 
-        // Get the integration points that mapped into this domain entity.
-        psearch.getRangeEntitiesFromDomain( domain_it->id(), ip_entity_ids );
-
-        // Sum into the global coupling matrix row at each integration point.
-        for ( ip_entity_id_it = ip_entity_ids.begin();
-              ip_entity_id_it != ip_entity_ids.end(); ++ip_entity_id_it )
+        // Get the parametric coordinates of the integration points in the
+        // domain entity.
+        ip_entity_coords.resize( num_entity_ip );
+        for ( int i = 0; i < num_entity_ip; ++i )
         {
-            // Get the local data id.
-            lid_pair.first = *ip_entity_id_it;
-            lid_pair.second = domain_it->id();
-            DTK_CHECK( ip_domain_lid_map.count( lid_pair ) );
-            local_id = ip_domain_lid_map.find( lid_pair )->second;
-
-            // Get the parametric coordinates of the integration point in the
-            // domain entity.
+            offset = import_offsets[import_order[first_record + i]];
             psearch.rangeParametricCoordinatesInDomain(
-                domain_it->id(), *ip_entity_id_it, ip_parametric_coords );
-
-            // Evaluate the shape function at the integration point
-            // parametric coordinates.
-            domain_space->shapeFunction()->evaluateValue(
-                *domain_it, ip_parametric_coords, domain_shape_values );
-            DTK_CHECK( domain_shape_values.size() ==
-                       domain_support_ids.size() );
-
-            // Fill the coupling matrix.
-            range_cardinality = import_shape_evals[ip_stride * local_id];
-            domain_cardinality = domain_shape_values.size();
-            cm_values.assign( domain_cardinality, 0.0 );
-            for ( int i = 0; i < range_cardinality; ++i )
+                domain_it->id(), unpackId( import_words[offset] ),
+                ip_parametric_coords );
+            ip_entity_coords[i].assign( ip_parametric_coords.begin(),
+                                        ip_parametric_coords.end() );
+        }
+
+        // Evaluate the shape function at all of the integration point
+        // parametric coordinates.
+        domain_space->shapeFunction()->evaluateValues(
+            *domain_it, ip_entity_coords, domain_shape_values );
+        DTK_CHECK( domain_shape_values.size() ==
+                   num_entity_ip * domain_support_ids.size() );
+
+        // Sum the contributions of each integration point into the rows of
+        // the entity block.
+        cm_rows.clear();
+        cm_values.clear();
+        for ( int i = 0; i < num_entity_ip; ++i )
+        {
+            offset = import_offsets[import_order[first_record + i]];
+            range_cardinality = static_cast<int>( import_words[offset + 3] );
+            for ( int r = 0; r < range_cardinality; ++r )
             {
-                ip_index = ip_stride * local_id + i + 1;
-                temp = import_measures_weights[local_id] *
-                       import_shape_evals[ip_index];
+                // Find the block row for this range support id.
+                range_support_id = unpackId(
+                    import_words[offset + 4 + range_cardinality + r] );
+                cm_row_it = std::find( cm_rows.begin(), cm_rows.end(),
+                                       range_support_id );
+                row_index = std::distance( cm_rows.begin(), cm_row_it );
+                if ( cm_row_it == cm_rows.end() )
+                {
+                    cm_rows.push_back( range_support_id );
+                    cm_values.resize( cm_values.size() + domain_cardinality,
+                                      0.0 );
+                }
+
+                temp = import_words[offset + 2] * import_words[offset + 4 + r];
                 for ( int j = 0; j < domain_cardinality; ++j )
                 {
-                    cm_values[j] = temp * domain_shape_values[j];
+                    cm_values[row_index * domain_cardinality + j] +=
+                        temp *
+                        domain_shape_values[i * domain_cardinality + j];
                 }
-                coupling_matrix->insertGlobalValues(
-                    import_support_ids[ip_index], domain_support_ids(),
-                    cm_values() );
             }
         }
+
+        // Add the entity block to the coupling matrix.
+        matrix_builder.addBlock( cm_rows(), domain_support_ids(),
+                                 cm_values() );
+    }
+
+    // Build the coupling matrix.
+    coupling_matrix = matrix_builder.build();
+}
+
+//---------------------------------------------------------------------------//
+// Build the inverse of the diagonal or lumped mass matrix.
+Teuchos::RCP<const Tpetra::Vector<double, L2ProjectionOperator::LO,
+                                  L2ProjectionOperator::GO>>
+L2ProjectionOperator::buildInverseDiagonal(
+    const Tpetra::CrsMatrix<Scalar, LO, GO> &mass_matrix,
+    const bool lumped ) const
+{
+    DTK_REQUIRE( mass_matrix.isFillComplete() );
+
+    Teuchos::RCP<Tpetra::Vector<Scalar, LO, GO>> inv_diag =
+        Tpetra::createVector<Scalar, LO, GO>( mass_matrix.getRangeMap() );
+
+    // The lumped mass matrix is the row sum of the consistent mass matrix.
+    if ( lumped )
+    {
+        Tpetra::Vector<Scalar, LO, GO> ones( mass_matrix.getDomainMap() );
+        ones.putScalar( 1.0 );
+        mass_matrix.apply( ones, *inv_diag );
+    }
+
+    // Otherwise extract the diagonal of the consistent mass matrix.
+    else
+    {
+        mass_matrix.getLocalDiagCopy( *inv_diag );
+    }
+
+    // Invert the diagonal. A row with no support from any range entity has
+    // a zero diagonal and row sum so it is left at zero instead of being
+    // inverted.
+    Teuchos::ArrayRCP<Scalar> inv_diag_data = inv_diag->getDataNonConst();
+    for ( auto &value : inv_diag_data )
+    {
+        DTK_CHECK( value >= 0.0 );
+        value = ( value > 0.0 ) ? 1.0 / value : 0.0;
     }
 
-    // Finalize the coupling matrix.
-    coupling_matrix->fillComplete( this->getDomainMap(), this->getRangeMap() );
+    return inv_diag;
 }
 
 //---------------------------------------------------------------------------//
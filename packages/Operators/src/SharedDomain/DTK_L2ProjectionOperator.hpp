@@ -41,9 +41,11 @@
 #ifndef DTK_L2PROJECTIONOPERATOR_HPP
 #define DTK_L2PROJECTIONOPERATOR_HPP
 
+#include "DTK_CachedDistributor.hpp"
 #include "DTK_EntityIterator.hpp"
 #include "DTK_IntegrationPointSet.hpp"
 #include "DTK_MapOperator.hpp"
+#include "DTK_ParallelSearch.hpp"
 #include "DTK_Types.hpp"
 
 #include <Teuchos_Array.hpp>
@@ -51,8 +53,10 @@
 #include <Teuchos_RCP.hpp>
 
 #include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Vector.hpp>
 
 #include <Thyra_LinearOpBase.hpp>
+#include <Thyra_LinearOpWithSolveBase.hpp>
 
 namespace DataTransferKit
 {
@@ -63,6 +67,12 @@ namespace DataTransferKit
 
   Constructs and solves the L2 projection problem on a shared domain. The
   Galerkin problem is assembled over the range (target) entity set.
+
+  The mass matrix inverse is applied with a Belos CG solver ("Pseudo Block
+  CG" or "Block CG") with an optional diagonal or lumped-mass
+  preconditioner. Alternatively, "Lumped Mass" replaces the mass matrix by
+  its row-sum diagonal so that an apply is a single coupling matrix
+  multiply followed by a diagonal scaling.
 */
 //---------------------------------------------------------------------------//
 class L2ProjectionOperator : virtual public MapOperator
@@ -137,14 +147,47 @@ class L2ProjectionOperator : virtual public MapOperator
         const Teuchos::RCP<IntegrationPointSet> &range_ip_set,
         Teuchos::RCP<Tpetra::CrsMatrix<double, LO, GO>> &coupling_matrix );
 
+    // Build the inverse of the diagonal or lumped mass matrix.
+    Teuchos::RCP<const Tpetra::Vector<double, LO, GO>> buildInverseDiagonal(
+        const Tpetra::CrsMatrix<double, LO, GO> &mass_matrix,
+        const bool lumped ) const;
+
   private:
     // Order of numerical integration for assembly of the Galerkin problem.
     int d_int_order;
 
+    // Mass matrix solver type: "Pseudo Block CG", "Block CG", or "Lumped
+    // Mass".
+    std::string d_solver_type;
+
+    // Mass matrix preconditioner type: "None", "Diagonal", or "Lumped Mass".
+    std::string d_prec_type;
+
+    // Mass matrix solver convergence tolerance.
+    double d_solver_tol;
+
+    // Mass matrix solver maximum number of iterations.
+    int d_solver_max_iters;
+
+    // Mass matrix solver verbosity.
+    bool d_solver_verbose;
+
     // Search sublist.
     Teuchos::ParameterList d_search_list;
 
+    // Parallel search communication plans kept between setups.
+    Teuchos::RCP<ParallelSearch::CommPlans> d_search_plans;
+
+    // Range-to-domain communication plan kept between setups.
+    Teuchos::RCP<CachedDistributor> d_range_to_domain_dist;
+
     // Coupling matrix.
+    Teuchos::RCP<const Thyra::LinearOpBase<double>> d_coupling_matrix;
+
+    // Mass matrix solver. Null if the mass matrix is lumped.
+    Teuchos::RCP<const Thyra::LinearOpWithSolveBase<double>> d_mass_solver;
+
+    // Lumped mass projection operator. Null if the mass matrix is solved.
     Teuchos::RCP<const Thyra::LinearOpBase<double>> d_l2_operator;
 };
 
@@ -99,6 +99,18 @@ void ReferenceHexShapeFunction::evaluateValue(
     d_intrepid_shape.evaluateValue( d_topo, reference_point, values );
 }
 
+//---------------------------------------------------------------------------//
+// Given an entity and a set of reference points, evaluate the shape function
+// of the entity at all of the points at once.
+void ReferenceHexShapeFunction::evaluateValues(
+    const DataTransferKit::Entity &entity,
+    const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+    Teuchos::Array<double> &values ) const
+{
+    DTK_REQUIRE( 3 == entity.topologicalDimension() );
+    d_intrepid_shape.evaluateValues( d_topo, reference_points, values );
+}
+
 //---------------------------------------------------------------------------//
 // Given an entity and a reference point, evaluate the gradient of the shape
 // function of the entity at that point.
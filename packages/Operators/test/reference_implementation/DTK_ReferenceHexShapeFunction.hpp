@@ -90,6 +90,20 @@ class ReferenceHexShapeFunction : public DataTransferKit::EntityShapeFunction
                         const Teuchos::ArrayView<const double> &reference_point,
                         Teuchos::Array<double> &values ) const override;
 
+    /*!
+     * \brief Given an entity and a set of reference points, evaluate the
+     * shape function of the entity at all of the points at once.
+     * \param entity Evaluate the shape function of this entity.
+     * \param reference_points Evaluate the shape function at these points
+     * given in reference coordinates.
+     * \param values Entity shape function evaluated at the reference
+     * points.
+     */
+    void evaluateValues(
+        const DataTransferKit::Entity &entity,
+        const Teuchos::Array<Teuchos::Array<double>> &reference_points,
+        Teuchos::Array<double> &values ) const override;
+
     /*!
      * \brief Given an entity and a reference point, evaluate the gradient of
      * the shape function of the entity at that point.
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file tstCachedDistributor.cpp
+ * \author Stuart R. Slattery
+ * \brief CachedDistributor unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <DTK_CachedDistributor.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CachedDistributor, plan_reuse )
+{
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // Send 3 values to the next rank.
+    int num_send = 3;
+    int next_rank = ( comm_rank + 1 ) % comm_size;
+    int prev_rank = ( comm_rank + comm_size - 1 ) % comm_size;
+    Teuchos::Array<int> export_ranks( num_send, next_rank );
+    Teuchos::Array<int> exports( num_send, comm_rank );
+    Teuchos::Array<int> imports;
+
+    // The first plan is always created.
+    DataTransferKit::CachedDistributor distributor( comm );
+    int num_import = distributor.createFromSends( export_ranks() );
+    TEST_ASSERT( !distributor.planReused() );
+    TEST_EQUALITY( num_import, num_send );
+    imports.resize( num_import );
+    distributor.doPostsAndWaits( exports().getConst(), 1, imports() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( imports[i], prev_rank );
+    }
+
+    // The same export ranks reuse the plan. Send different data.
+    num_import = distributor.createFromSends( export_ranks() );
+    TEST_ASSERT( distributor.planReused() );
+    TEST_EQUALITY( num_import, num_send );
+    exports.assign( num_send, 2 * comm_rank );
+    distributor.doPostsAndWaits( exports().getConst(), 1, imports() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( imports[i], 2 * prev_rank );
+    }
+
+    // The reverse plan is kept with the plan.
+    Teuchos::Array<int> reverse_imports( num_send );
+    distributor.distributor().doReversePostsAndWaits(
+        imports().getConst(), 1, reverse_imports() );
+    for ( int i = 0; i < num_send; ++i )
+    {
+        TEST_EQUALITY( reverse_imports[i], 2 * comm_rank );
+    }
+
+    // Changing only the number of exports keeps the neighbor pattern. The
+    // plan is rebuilt from the known neighbors.
+    num_send += 2;
+    export_ranks.assign( num_send, next_rank );
+    exports.assign( num_send, 3 * comm_rank );
+    num_import = distributor.createFromSends( export_ranks() );
+    TEST_ASSERT( !distributor.planReused() );
+    TEST_ASSERT( distributor.patternReused() );
+    TEST_EQUALITY( num_import, num_send );
+    imports.resize( num_import );
+    distributor.doPostsAndWaits( exports().getConst(), 1, imports() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( imports[i], 3 * prev_rank );
+    }
+
+    // Changing the export ranks on only one process requires a new plan on
+    // all processes.
+    if ( 0 == comm_rank )
+    {
+        export_ranks.push_back( comm_rank );
+        exports.push_back( -1 );
+    }
+    num_import = distributor.createFromSends( export_ranks() );
+    TEST_ASSERT( !distributor.planReused() );
+    int expected_import = ( 0 == comm_rank ) ? num_send + 1 : num_send;
+    TEST_EQUALITY( num_import, expected_import );
+    TEST_EQUALITY( distributor.getNumImports(),
+                   Teuchos::as<std::size_t>( expected_import ) );
+}
+
+//---------------------------------------------------------------------------//
+// end tstCachedDistributor.cpp
+//---------------------------------------------------------------------------//
@@ -188,6 +188,168 @@ TEUCHOS_UNIT_TEST( CenterDistributor, dim_3_test )
     }
 }
 
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CenterDistributor, union_test )
+{
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm();
+    int rank = comm->getRank();
+    int size = comm->getSize();
+    int inverse_rank = size - rank - 1;
+
+    int dim = 2;
+    int num_src_points = 10;
+    int num_src_coords = dim * num_src_points;
+
+    Teuchos::Array<double> src_coords( num_src_coords );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_coords[dim * i] = 1.0 * i;
+        src_coords[dim * i + 1] = 2.0 * rank;
+    }
+
+    // The first set of targets neighbors the sources 4 through 9.
+    Teuchos::Array<double> tgt_coords_1( 4 );
+    tgt_coords_1[0] = 4.9;
+    tgt_coords_1[1] = 2.0 * inverse_rank;
+    tgt_coords_1[2] = 11.4;
+    tgt_coords_1[3] = 2.0 * inverse_rank;
+    double radius_1 = 1.5;
+
+    // The second set of targets neighbors the sources 0 through 4.
+    Teuchos::Array<double> tgt_coords_2( 4 );
+    tgt_coords_2[0] = 0.2;
+    tgt_coords_2[1] = 2.0 * inverse_rank;
+    tgt_coords_2[2] = 4.2;
+    tgt_coords_2[3] = 2.0 * inverse_rank;
+    double radius_2 = 0.5;
+
+    Teuchos::Array<double> tgt_decomp_src;
+
+    DataTransferKit::CenterDistributor<2> distributor(
+        comm, src_coords(), tgt_coords_1(), radius_1, tgt_coords_2(),
+        radius_2, tgt_decomp_src );
+
+    // Source 4 is in both neighborhoods but is only received once.
+    int num_import = 10;
+    TEST_EQUALITY( num_import, distributor.getNumImports() );
+    TEST_EQUALITY( dim * distributor.getNumImports(), tgt_decomp_src.size() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( tgt_decomp_src[dim * i], 1.0 * i );
+        TEST_EQUALITY( tgt_decomp_src[dim * i + 1], 2.0 * inverse_rank );
+    }
+
+    Teuchos::Array<double> src_data( num_src_points );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_data[i] = i * inverse_rank;
+    }
+    Teuchos::Array<double> tgt_data( distributor.getNumImports() );
+    Teuchos::ArrayView<const double> src_view = src_data();
+    distributor.distribute( src_view, tgt_data() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( tgt_data[i], 1.0 * i * rank );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CenterDistributor, knn_test )
+{
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm();
+    int rank = comm->getRank();
+
+    int dim = 2;
+    int num_src_points = 10;
+    int num_src_coords = dim * num_src_points;
+
+    Teuchos::Array<double> src_coords( num_src_coords );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_coords[dim * i] = 1.0 * i;
+        src_coords[dim * i + 1] = 2.0 * rank;
+    }
+
+    // The 3 nearest sources to the target are 3 through 5.
+    Teuchos::Array<double> tgt_coords( 2 );
+    tgt_coords[0] = 4.2;
+    tgt_coords[1] = 2.0 * rank;
+
+    Teuchos::Array<DataTransferKit::CloudDomain<2>> domains(
+        1, DataTransferKit::CenterDistributor<2>::nearestNeighborDomain(
+               comm, src_coords(), tgt_coords(), 3 ) );
+    double radius = 1.2 * ( 1.0 + 1.0e-2 );
+    Teuchos::ArrayView<const double> bounds = domains[0].bounds();
+    TEST_FLOATING_EQUALITY( bounds[0], 4.2 - radius, 1.0e-12 );
+    TEST_FLOATING_EQUALITY( bounds[1], 4.2 + radius, 1.0e-12 );
+
+    Teuchos::Array<double> tgt_decomp_src;
+    DataTransferKit::CenterDistributor<2> distributor(
+        comm, src_coords(), domains(), tgt_decomp_src );
+
+    // Only the neighbors on this proc's row are received.
+    int num_import = 3;
+    TEST_EQUALITY( num_import, distributor.getNumImports() );
+    TEST_EQUALITY( dim * distributor.getNumImports(), tgt_decomp_src.size() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( tgt_decomp_src[dim * i], 3.0 + i );
+        TEST_EQUALITY( tgt_decomp_src[dim * i + 1], 2.0 * rank );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CenterDistributor, knn_target_only_test )
+{
+    Teuchos::RCP<const Teuchos::Comm<int>> comm = getDefaultComm();
+    int rank = comm->getRank();
+
+    // Only the first proc has sources. The other procs only have targets so
+    // they bound the neighbor distance with the gathered source domains.
+    int dim = 2;
+    int num_src_points = ( 0 == rank ) ? 10 : 0;
+    int num_src_coords = dim * num_src_points;
+
+    Teuchos::Array<double> src_coords( num_src_coords );
+    for ( int i = 0; i < num_src_points; ++i )
+    {
+        src_coords[dim * i] = 1.0 * i;
+        src_coords[dim * i + 1] = 0.0;
+    }
+
+    Teuchos::Array<double> tgt_coords( 2 );
+    tgt_coords[0] = 4.2;
+    tgt_coords[1] = 0.0;
+
+    Teuchos::Array<DataTransferKit::CloudDomain<2>> domains(
+        1, DataTransferKit::CenterDistributor<2>::nearestNeighborDomain(
+               comm, src_coords(), tgt_coords(), 3 ) );
+
+    // The first proc is bounded by its 3 nearest sources. The other procs
+    // are bounded by the farthest corner of the first proc's domain.
+    double radius = ( ( 0 == rank ) ? 1.2 : 4.8 ) * ( 1.0 + 1.0e-2 );
+    Teuchos::ArrayView<const double> bounds = domains[0].bounds();
+    TEST_FLOATING_EQUALITY( bounds[0], 4.2 - radius, 1.0e-12 );
+    TEST_FLOATING_EQUALITY( bounds[1], 4.2 + radius, 1.0e-12 );
+    TEST_FLOATING_EQUALITY( bounds[2], -radius, 1.0e-12 );
+    TEST_FLOATING_EQUALITY( bounds[3], radius, 1.0e-12 );
+
+    Teuchos::Array<double> tgt_decomp_src;
+    DataTransferKit::CenterDistributor<2> distributor(
+        comm, src_coords(), domains(), tgt_decomp_src );
+
+    // The target-only procs receive all of the sources.
+    int num_import = ( 0 == rank ) ? 3 : 10;
+    double first_import = ( 0 == rank ) ? 3.0 : 0.0;
+    TEST_EQUALITY( num_import, distributor.getNumImports() );
+    TEST_EQUALITY( dim * distributor.getNumImports(), tgt_decomp_src.size() );
+    for ( int i = 0; i < num_import; ++i )
+    {
+        TEST_EQUALITY( tgt_decomp_src[dim * i], first_import + i );
+        TEST_EQUALITY( tgt_decomp_src[dim * i + 1], 0.0 );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // end tstCenterDistributor.cpp
 //---------------------------------------------------------------------------//
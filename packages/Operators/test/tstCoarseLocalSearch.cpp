@@ -128,6 +128,24 @@ TEUCHOS_UNIT_TEST( CoarseLocalSearch, coarse_local_search_test )
     TEST_EQUALITY( num_neighbors, neighbors.size() );
     TEST_EQUALITY( 4, neighbors[0].id() );
     TEST_EQUALITY( 3, neighbors[1].id() );
+
+    // Search with the fixed dimension interface.
+    TEST_EQUALITY( num_neighbors, coarse_local_search.numNeighbors( plist ) );
+    Teuchos::Array<Entity> dim_neighbors;
+    Teuchos::Array<unsigned> neighbor_ids;
+    Teuchos::Array<double> neighbor_dists;
+    coarse_local_search.search<3>(
+        point.getRawPtr(), coarse_local_search.numNeighbors( plist ),
+        dim_neighbors, neighbor_ids, neighbor_dists );
+    TEST_EQUALITY( num_neighbors, dim_neighbors.size() );
+    TEST_EQUALITY( 4, dim_neighbors[0].id() );
+    TEST_EQUALITY( 3, dim_neighbors[1].id() );
+
+    // Reuse the work buffers for a second search.
+    coarse_local_search.search<3>( point.getRawPtr(), 1, dim_neighbors,
+                                   neighbor_ids, neighbor_dists );
+    TEST_EQUALITY( 1, dim_neighbors.size() );
+    TEST_EQUALITY( 4, dim_neighbors[0].id() );
 }
 
 //---------------------------------------------------------------------------//
@@ -53,6 +53,7 @@
 #include <DTK_BoxGeometry.hpp>
 #include <DTK_ConsistentInterpolationOperator.hpp>
 #include <DTK_EntityCenteredField.hpp>
+#include <DTK_Field.hpp>
 #include <DTK_FieldMultiVector.hpp>
 #include <DTK_Point.hpp>
 
@@ -82,108 +83,254 @@ double testFunction( const Teuchos::ArrayView<double> &coords )
 }
 
 //---------------------------------------------------------------------------//
-// Tests
+// TEST FIELD
 //---------------------------------------------------------------------------//
-TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, reference_hex_mesh )
+// Field wrapper that counts the reads of the application data so tests can
+// see when a vector is pulled from the application.
+class CountingField : public DataTransferKit::Field
 {
-    // Get the communicator.
-    Teuchos::RCP<const Teuchos::Comm<int>> comm =
-        Teuchos::DefaultComm<int>::getComm();
-    DataTransferKit::LocalEntityPredicate local_pred( comm->getRank() );
-
-    // Set the global problem bounds.
-    double x_min = 0.0;
-    double y_min = 0.0;
-    double z_min = 0.0;
-    double x_max = 3.1;
-    double y_max = 5.2;
-    double z_max = 8.3;
-
-    // Create a target mesh and field.
-    int num_sx = 8;
-    int num_sy = 8;
-    int num_sz = 8;
-
-    DataTransferKit::UnitTest::ReferenceHexMesh source_mesh(
-        comm, x_min, x_max, num_sx, y_min, y_max, num_sy, z_min, z_max,
-        num_sz );
-    auto source_field = source_mesh.nodalField( 1 );
-    Teuchos::RCP<DataTransferKit::FieldMultiVector> source_vector =
-        Teuchos::rcp(
-            new DataTransferKit::FieldMultiVector( comm, source_field ) );
+  public:
+    CountingField( const Teuchos::RCP<DataTransferKit::Field> &field )
+        : d_field( field )
+        , d_num_reads( 0 )
+    { /* ... */
+    }
 
-    // Put some data on the source field.
-    auto source_local_map = source_mesh.functionSpace()->localMap();
-    auto source_nodes =
-        source_mesh.functionSpace()->entitySet()->entityIterator(
-            0, local_pred.getFunction() );
-    auto source_nodes_begin = source_nodes.begin();
-    auto source_nodes_end = source_nodes.end();
-    Teuchos::Array<double> source_coords( 3 );
-    for ( source_nodes = source_nodes.begin();
-          source_nodes != source_nodes.end(); ++source_nodes )
+    int dimension() const override { return d_field->dimension(); }
+
+    Teuchos::ArrayView<const DataTransferKit::SupportId>
+    getLocalSupportIds() const override
     {
-        unsigned k = source_nodes->id() / ( num_sx * num_sy );
-        unsigned j = ( source_nodes->id() - k * num_sx * num_sy ) / num_sx;
-        unsigned i = source_nodes->id() - j * num_sx - k * num_sx * num_sy;
+        return d_field->getLocalSupportIds();
+    }
 
-        source_local_map->centroid( *source_nodes, source_coords() );
+    double readFieldData( const DataTransferKit::SupportId support_id,
+                          const int dimension ) const override
+    {
+        ++d_num_reads;
+        return d_field->readFieldData( support_id, dimension );
+    }
 
-        source_field->writeFieldData( source_nodes->id(), 0,
-                                      testFunction( source_coords() ) );
+    void writeFieldData( const DataTransferKit::SupportId support_id,
+                         const int dimension, const double data ) override
+    {
+        d_field->writeFieldData( support_id, dimension, data );
     }
 
-    // Create a source mesh and field.
-    int num_tx = 9;
-    int num_ty = 7;
-    int num_tz = 7;
-    DataTransferKit::UnitTest::ReferenceHexMesh target_mesh(
-        comm, x_min, x_max, num_tx, y_min, y_max, num_ty, z_min, z_max,
-        num_tz );
-    auto target_field = target_mesh.nodalField( 1 );
-    Teuchos::RCP<DataTransferKit::FieldMultiVector> target_vector =
-        Teuchos::rcp(
+    void finalizeAfterWrite() override { d_field->finalizeAfterWrite(); }
+
+    int numReads() const { return d_num_reads; }
+
+    void resetReads() { d_num_reads = 0; }
+
+  private:
+    Teuchos::RCP<DataTransferKit::Field> d_field;
+    mutable int d_num_reads;
+};
+
+//---------------------------------------------------------------------------//
+// TEST PROBLEM
+//---------------------------------------------------------------------------//
+// Interpolation of the linear test function between two reference hex meshes
+// of the same domain.
+struct ReferenceHexProblem
+{
+    Teuchos::RCP<const Teuchos::Comm<int>> comm;
+    DataTransferKit::LocalEntityPredicate local_pred;
+    int num_tx;
+    int num_ty;
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> source_mesh;
+    Teuchos::RCP<DataTransferKit::Field> source_field;
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> source_vector;
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> target_mesh;
+    Teuchos::RCP<CountingField> target_field;
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> target_vector;
+    Teuchos::RCP<DataTransferKit::ConsistentInterpolationOperator> map_op;
+
+    // Create the meshes and fields, put the data on the source field, and
+    // set up the map.
+    ReferenceHexProblem()
+        : comm( Teuchos::DefaultComm<int>::getComm() )
+        , local_pred( comm->getRank() )
+        , num_tx( 9 )
+        , num_ty( 7 )
+    {
+        // Set the global problem bounds.
+        double x_min = 0.0;
+        double y_min = 0.0;
+        double z_min = 0.0;
+        double x_max = 3.1;
+        double y_max = 5.2;
+        double z_max = 8.3;
+
+        // Create a source mesh and field.
+        int num_sx = 8;
+        int num_sy = 8;
+        int num_sz = 8;
+        source_mesh =
+            Teuchos::rcp( new DataTransferKit::UnitTest::ReferenceHexMesh(
+                comm, x_min, x_max, num_sx, y_min, y_max, num_sy, z_min,
+                z_max, num_sz ) );
+        source_field = source_mesh->nodalField( 1 );
+        source_vector = Teuchos::rcp(
+            new DataTransferKit::FieldMultiVector( comm, source_field ) );
+
+        // Put some data on the source field.
+        auto source_local_map = source_mesh->functionSpace()->localMap();
+        auto source_nodes =
+            source_mesh->functionSpace()->entitySet()->entityIterator(
+                0, local_pred.getFunction() );
+        Teuchos::Array<double> source_coords( 3 );
+        for ( source_nodes = source_nodes.begin();
+              source_nodes != source_nodes.end(); ++source_nodes )
+        {
+            source_local_map->centroid( *source_nodes, source_coords() );
+            source_field->writeFieldData( source_nodes->id(), 0,
+                                          testFunction( source_coords() ) );
+        }
+
+        // Create a target mesh and field.
+        int num_tz = 7;
+        target_mesh =
+            Teuchos::rcp( new DataTransferKit::UnitTest::ReferenceHexMesh(
+                comm, x_min, x_max, num_tx, y_min, y_max, num_ty, z_min,
+                z_max, num_tz ) );
+        target_field =
+            Teuchos::rcp( new CountingField( target_mesh->nodalField( 1 ) ) );
+        target_vector = Teuchos::rcp(
             new DataTransferKit::FieldMultiVector( comm, target_field ) );
 
-    // MAPPING
-    // Create a map.
-    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
-    parameters->sublist( "Consistent Interpolation" );
-    Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
-    search_list.set( "Point Inclusion Tolerance", 1.0e-6 );
+        // Create the map and set it up.
+        Teuchos::RCP<Teuchos::ParameterList> parameters =
+            Teuchos::parameterList();
+        parameters->sublist( "Consistent Interpolation" );
+        Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+        search_list.set( "Point Inclusion Tolerance", 1.0e-6 );
+        map_op = Teuchos::rcp(
+            new DataTransferKit::ConsistentInterpolationOperator(
+                source_vector->getMap(), target_vector->getMap(),
+                *parameters ) );
+        map_op->setup( source_mesh->functionSpace(),
+                       target_mesh->functionSpace() );
+    }
 
-    Teuchos::RCP<DataTransferKit::ConsistentInterpolationOperator> map_op =
-        Teuchos::rcp( new DataTransferKit::ConsistentInterpolationOperator(
-            source_vector->getMap(), target_vector->getMap(), *parameters ) );
+    // Write a value to every local target node.
+    void fillTargetField( const double value )
+    {
+        auto target_nodes =
+            target_mesh->functionSpace()->entitySet()->entityIterator(
+                0, local_pred.getFunction() );
+        for ( target_nodes = target_nodes.begin();
+              target_nodes != target_nodes.end(); ++target_nodes )
+        {
+            target_field->writeFieldData( target_nodes->id(), 0, value );
+        }
+    }
 
-    // Setup the map.
-    map_op->setup( source_mesh.functionSpace(), target_mesh.functionSpace() );
+    // Check that the target field is the given multiple of the test function.
+    void checkTargetField( Teuchos::FancyOStream &out, bool &success,
+                           const double scale ) const
+    {
+        auto target_nodes =
+            target_mesh->functionSpace()->entitySet()->entityIterator(
+                0, local_pred.getFunction() );
+        auto target_local_map = target_mesh->functionSpace()->localMap();
+        Teuchos::Array<double> target_coords( 3 );
+        for ( target_nodes = target_nodes.begin();
+              target_nodes != target_nodes.end(); ++target_nodes )
+        {
+            unsigned k = target_nodes->id() / ( num_tx * num_ty );
+            unsigned j =
+                ( target_nodes->id() - k * num_tx * num_ty ) / num_tx;
+            unsigned i =
+                target_nodes->id() - j * num_tx - k * num_tx * num_ty;
+            TEST_EQUALITY( target_nodes->id(),
+                           i + j * num_tx + k * num_tx * num_ty );
+
+            target_local_map->centroid( *target_nodes, target_coords() );
+            double gold_data = scale * testFunction( target_coords() );
+            double target_data =
+                target_field->readFieldData( target_nodes->id(), 0 );
+            TEST_FLOATING_EQUALITY( target_data, gold_data, epsilon );
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator, reference_hex_mesh )
+{
+    ReferenceHexProblem problem;
 
     // Apply the map.
-    map_op->apply( *source_vector, *target_vector );
+    problem.map_op->apply( *problem.source_vector, *problem.target_vector );
 
     // Check the results of the mapping.
+    problem.checkTargetField( out, success, 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( ConsistentInterpolationOperator,
+                   reference_hex_mesh_tpetra_vectors )
+{
+    ReferenceHexProblem problem;
+
+    // Apply the map to plain Tpetra vectors holding the source data.
+    problem.source_vector->pullDataFromApplication();
+    DataTransferKit::FieldMultiVector::Base tpetra_source(
+        *problem.source_vector, Teuchos::Copy );
+    DataTransferKit::FieldMultiVector::Base tpetra_target(
+        problem.target_vector->getMap(), 1 );
+    problem.map_op->apply( tpetra_source, tpetra_target );
+
+    // Declare the source vector current and then zero the application source
+    // data. The apply should use the values already in the source vector.
+    problem.map_op->setDomainDataIsCurrent( true );
+    auto source_nodes =
+        problem.source_mesh->functionSpace()->entitySet()->entityIterator(
+            0, problem.local_pred.getFunction() );
+    for ( source_nodes = source_nodes.begin();
+          source_nodes != source_nodes.end(); ++source_nodes )
+    {
+        problem.source_field->writeFieldData( source_nodes->id(), 0, 0.0 );
+    }
+
+    // Seed the application target data with a sentinel. With beta zero the
+    // range vector must not be pulled and the sentinel must be overwritten.
+    double sentinel = 1.0e6;
+    problem.fillTargetField( sentinel );
+    problem.target_field->resetReads();
+    problem.map_op->apply( *problem.source_vector, *problem.target_vector );
+    TEST_EQUALITY( problem.target_field->numReads(), 0 );
+    problem.checkTargetField( out, success, 1.0 );
+
+    // With beta nonzero the range vector is pulled and accumulated into.
+    problem.target_field->resetReads();
+    problem.map_op->apply( *problem.source_vector, *problem.target_vector,
+                           Teuchos::NO_TRANS, 1.0, 1.0 );
+    TEST_ASSERT( problem.target_field->numReads() > 0 ||
+                 problem.target_field->getLocalSupportIds().size() == 0 );
+    problem.checkTargetField( out, success, 2.0 );
+
+    // Check the results of the mapping in the Tpetra target vector.
+    Teuchos::ArrayRCP<const double> tpetra_target_data =
+        tpetra_target.getData( 0 );
+    auto target_map = tpetra_target.getMap();
     auto target_nodes =
-        target_mesh.functionSpace()->entitySet()->entityIterator(
-            0, local_pred.getFunction() );
-    auto target_nodes_begin = target_nodes.begin();
-    auto target_nodes_end = target_nodes.end();
-    auto target_local_map = target_mesh.functionSpace()->localMap();
+        problem.target_mesh->functionSpace()->entitySet()->entityIterator(
+            0, problem.local_pred.getFunction() );
+    auto target_local_map =
+        problem.target_mesh->functionSpace()->localMap();
     Teuchos::Array<double> target_coords( 3 );
     for ( target_nodes = target_nodes.begin();
           target_nodes != target_nodes.end(); ++target_nodes )
     {
-        unsigned k = target_nodes->id() / ( num_tx * num_ty );
-        unsigned j = ( target_nodes->id() - k * num_tx * num_ty ) / num_tx;
-        unsigned i = target_nodes->id() - j * num_tx - k * num_tx * num_ty;
-        TEST_EQUALITY( target_nodes->id(),
-                       i + j * num_tx + k * num_tx * num_ty );
-
         target_local_map->centroid( *target_nodes, target_coords() );
         double gold_data = testFunction( target_coords() );
-        double target_data =
-            target_field->readFieldData( target_nodes->id(), 0 );
-        TEST_FLOATING_EQUALITY( target_data, gold_data, epsilon );
+        double tpetra_data = tpetra_target_data[target_map->getLocalElement(
+            target_nodes->id() )];
+        TEST_FLOATING_EQUALITY( tpetra_data, gold_data, epsilon );
     }
 }
 
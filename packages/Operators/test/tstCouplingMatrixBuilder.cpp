@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file tstCouplingMatrixBuilder.cpp
+ * \author Stuart R. Slattery
+ * \brief CouplingMatrixBuilder unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <DTK_CouplingMatrixBuilder.hpp>
+#include <DTK_Types.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+#include <Tpetra_MultiVector.hpp>
+
+//---------------------------------------------------------------------------//
+// Helpers
+//---------------------------------------------------------------------------//
+typedef DataTransferKit::CouplingMatrixBuilder::Scalar Scalar;
+typedef DataTransferKit::CouplingMatrixBuilder::LO LO;
+typedef DataTransferKit::CouplingMatrixBuilder::GO GO;
+typedef DataTransferKit::CouplingMatrixBuilder::TpetraMap TpetraMap;
+typedef Tpetra::MultiVector<Scalar, LO, GO> TpetraMultiVector;
+
+// Make a vector whose entries are their global ids.
+Teuchos::RCP<TpetraMultiVector>
+createIdVector( const Teuchos::RCP<const TpetraMap> &map )
+{
+    Teuchos::RCP<TpetraMultiVector> v =
+        Tpetra::createMultiVector<Scalar, LO, GO>( map, 1 );
+    Teuchos::ArrayView<const GO> gids = map->getNodeElementList();
+    for ( int i = 0; i < gids.size(); ++i )
+    {
+        v->replaceLocalValue( i, 0, gids[i] );
+    }
+    return v;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CouplingMatrixBuilder, LocalFill )
+{
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_size = comm->getSize();
+
+    // Make a map.
+    int num_local_elements = 4;
+    GO num_global_elements = comm_size * num_local_elements;
+    Teuchos::RCP<const TpetraMap> map =
+        Tpetra::createUniformContigMap<LO, GO>( num_global_elements, comm );
+
+    // Fill the diagonal of the locally-owned rows.
+    DataTransferKit::CouplingMatrixBuilder builder( map, map );
+    Teuchos::ArrayView<const GO> gids = map->getNodeElementList();
+    Teuchos::Array<GO> columns( 1 );
+    Teuchos::Array<Scalar> values( 1, 2.0 );
+    for ( auto gid : gids )
+    {
+        columns[0] = gid;
+        builder.addRow( gid, columns(), values() );
+    }
+    Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> A = builder.build();
+    TEST_ASSERT( A->isFillComplete() );
+    TEST_ASSERT( A->getRowMap()->isSameAs( *map ) );
+    TEST_EQUALITY( A->getNodeNumEntries(), map->getNodeNumElements() );
+
+    // Apply the matrix.
+    Teuchos::RCP<TpetraMultiVector> X = createIdVector( map );
+    TpetraMultiVector Y( map, 1 );
+    A->apply( *X, Y );
+    Teuchos::ArrayRCP<const Scalar> y_view = Y.getData( 0 );
+    for ( int i = 0; i < gids.size(); ++i )
+    {
+        TEST_EQUALITY( y_view[i], 2.0 * gids[i] );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CouplingMatrixBuilder, EveryoneFill )
+{
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_size = comm->getSize();
+
+    // Make a map.
+    int num_local_elements = 2;
+    GO num_global_elements = comm_size * num_local_elements;
+    Teuchos::RCP<const TpetraMap> map =
+        Tpetra::createUniformContigMap<LO, GO>( num_global_elements, comm );
+
+    // Everyone will put something in the diagonal of every row.
+    DataTransferKit::CouplingMatrixBuilder builder( map, map );
+    Teuchos::Array<GO> columns( 1 );
+    Teuchos::Array<Scalar> values( 1, 1.0 );
+    for ( GO i = 0; i < num_global_elements; ++i )
+    {
+        columns[0] = i;
+        builder.addRow( i, columns(), values() );
+    }
+    Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> A = builder.build();
+    TEST_ASSERT( A->isFillComplete() );
+    TEST_EQUALITY( A->getNodeNumRows(), num_global_elements );
+    TEST_EQUALITY( A->getColMap()->getNodeNumElements(),
+                   num_global_elements );
+
+    // The contributions of each process to a row are summed.
+    Teuchos::RCP<TpetraMultiVector> X = createIdVector( map );
+    TpetraMultiVector Y( map, 1 );
+    A->apply( *X, Y );
+    Teuchos::ArrayView<const GO> gids = map->getNodeElementList();
+    Teuchos::ArrayRCP<const Scalar> y_view = Y.getData( 0 );
+    for ( int i = 0; i < gids.size(); ++i )
+    {
+        TEST_EQUALITY( y_view[i], 1.0 * comm_size * gids[i] );
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( CouplingMatrixBuilder, NotMyBlockFill )
+{
+    // Get the communicator.
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_size = comm->getSize();
+    int comm_rank = comm->getRank();
+
+    // Make a map.
+    int num_local_elements = 2;
+    GO num_global_elements = comm_size * num_local_elements;
+    Teuchos::RCP<const TpetraMap> map =
+        Tpetra::createUniformContigMap<LO, GO>( num_global_elements, comm );
+
+    // Fill a block into the rows owned by the inverse rank coupled to the
+    // columns owned by the next rank. Add the block twice so the duplicate
+    // entries are summed.
+    GO row_rank = comm_size - comm_rank - 1;
+    GO col_rank = ( comm_rank + 1 ) % comm_size;
+    Teuchos::Array<GO> rows( num_local_elements );
+    Teuchos::Array<GO> columns( num_local_elements );
+    for ( int i = 0; i < num_local_elements; ++i )
+    {
+        rows[i] = row_rank * num_local_elements + i;
+        columns[i] = col_rank * num_local_elements + i;
+    }
+    Teuchos::Array<Scalar> values( num_local_elements * num_local_elements,
+                                   0.5 );
+    DataTransferKit::CouplingMatrixBuilder builder( map, map );
+    builder.addBlock( rows(), columns(), values() );
+    builder.addBlock( rows(), columns(), values() );
+    Teuchos::RCP<Tpetra::CrsMatrix<Scalar, LO, GO>> A = builder.build();
+    TEST_ASSERT( A->isFillComplete() );
+
+    // Each row of the result is the sum of the ids of the columns owned by
+    // the rank after the filling rank.
+    Teuchos::RCP<TpetraMultiVector> X = createIdVector( map );
+    TpetraMultiVector Y( map, 1 );
+    A->apply( *X, Y );
+    GO fill_rank = comm_size - comm_rank - 1;
+    GO source_rank = ( fill_rank + 1 ) % comm_size;
+    Scalar test_val = 0.0;
+    for ( int i = 0; i < num_local_elements; ++i )
+    {
+        test_val += source_rank * num_local_elements + i;
+    }
+    Teuchos::ArrayRCP<const Scalar> y_view = Y.getData( 0 );
+    for ( int i = 0; i < num_local_elements; ++i )
+    {
+        TEST_EQUALITY( y_view[i], test_val );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// end tstCouplingMatrixBuilder.cpp
+//---------------------------------------------------------------------------//
@@ -53,6 +53,7 @@
 #include <DTK_L2ProjectionOperator.hpp>
 
 #include <DTK_BasicEntityPredicates.hpp>
+#include <DTK_Profiler.hpp>
 
 #include <Teuchos_Array.hpp>
 #include <Teuchos_CommHelpers.hpp>
@@ -174,116 +175,199 @@ double integrateField( DataTransferKit::UnitTest::ReferenceHexMesh &mesh,
 }
 
 //---------------------------------------------------------------------------//
-// Tests
+// Project a linear field from a source mesh to a non-matching target mesh.
+// Each component d of the source field is (d+1) times the test function.
 //---------------------------------------------------------------------------//
-TEUCHOS_UNIT_TEST( L2ProjectionOperator, l2_projection )
+struct L2ProjectionProblem
 {
-    // Get the communicator.
-    Teuchos::RCP<const Teuchos::Comm<int>> comm =
-        Teuchos::DefaultComm<int>::getComm();
-    DataTransferKit::LocalEntityPredicate local_pred( comm->getRank() );
-
-    // Set the global problem bounds.
-    double x_min = 0.0;
-    double y_min = 0.0;
-    double z_min = 0.0;
-    double x_max = 3.1;
-    double y_max = 5.2;
-    double z_max = 8.3;
-
-    // Create a target mesh and field.
-    int num_sx = 8;
-    int num_sy = 8;
-    int num_sz = 8;
-
-    DataTransferKit::UnitTest::ReferenceHexMesh source_mesh(
-        comm, x_min, x_max, num_sx, y_min, y_max, num_sy, z_min, z_max,
-        num_sz );
-    auto source_field = source_mesh.nodalField( 1 );
-    Teuchos::RCP<DataTransferKit::FieldMultiVector> source_vector =
-        Teuchos::rcp(
-            new DataTransferKit::FieldMultiVector( comm, source_field ) );
-
-    // Put some data on the source field.
-    auto source_local_map = source_mesh.functionSpace()->localMap();
-    auto source_nodes =
-        source_mesh.functionSpace()->entitySet()->entityIterator(
-            0, local_pred.getFunction() );
-    auto source_nodes_begin = source_nodes.begin();
-    auto source_nodes_end = source_nodes.end();
-    Teuchos::Array<double> source_coords( 3 );
-    for ( source_nodes = source_nodes.begin();
-          source_nodes != source_nodes.end(); ++source_nodes )
+    Teuchos::RCP<const Teuchos::Comm<int>> comm;
+    int field_dim;
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> source_mesh;
+    Teuchos::RCP<DataTransferKit::Field> source_field;
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> source_vector;
+    Teuchos::RCP<DataTransferKit::UnitTest::ReferenceHexMesh> target_mesh;
+    Teuchos::RCP<DataTransferKit::Field> target_field;
+    Teuchos::RCP<DataTransferKit::FieldMultiVector> target_vector;
+    Teuchos::RCP<DataTransferKit::L2ProjectionOperator> map_op;
+    int num_tx;
+    int num_ty;
+
+    // Create the meshes and fields and put the data on the source field.
+    L2ProjectionProblem( const int dim )
+        : comm( Teuchos::DefaultComm<int>::getComm() )
+        , field_dim( dim )
+        , num_tx( 9 )
+        , num_ty( 7 )
     {
-        unsigned k = source_nodes->id() / ( num_sx * num_sy );
-        unsigned j = ( source_nodes->id() - k * num_sx * num_sy ) / num_sx;
-        unsigned i = source_nodes->id() - j * num_sx - k * num_sx * num_sy;
-
-        source_local_map->centroid( *source_nodes, source_coords() );
+        // Set the global problem bounds.
+        double x_min = 0.0;
+        double y_min = 0.0;
+        double z_min = 0.0;
+        double x_max = 3.1;
+        double y_max = 5.2;
+        double z_max = 8.3;
+
+        // Create a source mesh and field.
+        int num_sx = 8;
+        int num_sy = 8;
+        int num_sz = 8;
+        source_mesh =
+            Teuchos::rcp( new DataTransferKit::UnitTest::ReferenceHexMesh(
+                comm, x_min, x_max, num_sx, y_min, y_max, num_sy, z_min,
+                z_max, num_sz ) );
+        source_field = source_mesh->nodalField( field_dim );
+        source_vector = Teuchos::rcp(
+            new DataTransferKit::FieldMultiVector( comm, source_field ) );
 
-        source_field->writeFieldData( source_nodes->id(), 0,
-                                      testFunction( source_coords() ) );
-    }
+        // Put some data on the source field.
+        DataTransferKit::LocalEntityPredicate local_pred( comm->getRank() );
+        auto source_local_map = source_mesh->functionSpace()->localMap();
+        auto source_nodes =
+            source_mesh->functionSpace()->entitySet()->entityIterator(
+                0, local_pred.getFunction() );
+        Teuchos::Array<double> source_coords( 3 );
+        for ( source_nodes = source_nodes.begin();
+              source_nodes != source_nodes.end(); ++source_nodes )
+        {
+            source_local_map->centroid( *source_nodes, source_coords() );
+            for ( int d = 0; d < field_dim; ++d )
+            {
+                source_field->writeFieldData(
+                    source_nodes->id(), d,
+                    ( d + 1.0 ) * testFunction( source_coords() ) );
+            }
+        }
 
-    // Create a source mesh and field.
-    int num_tx = 9;
-    int num_ty = 7;
-    int num_tz = 7;
-    DataTransferKit::UnitTest::ReferenceHexMesh target_mesh(
-        comm, x_min, x_max, num_tx, y_min, y_max, num_ty, z_min, z_max,
-        num_tz );
-    auto target_field = target_mesh.nodalField( 1 );
-    Teuchos::RCP<DataTransferKit::FieldMultiVector> target_vector =
-        Teuchos::rcp(
+        // Create a target mesh and field.
+        int num_tz = 7;
+        target_mesh =
+            Teuchos::rcp( new DataTransferKit::UnitTest::ReferenceHexMesh(
+                comm, x_min, x_max, num_tx, y_min, y_max, num_ty, z_min,
+                z_max, num_tz ) );
+        target_field = target_mesh->nodalField( field_dim );
+        target_vector = Teuchos::rcp(
             new DataTransferKit::FieldMultiVector( comm, target_field ) );
+    }
 
-    // Create a map.
-    Teuchos::RCP<Teuchos::ParameterList> parameters = Teuchos::parameterList();
-    Teuchos::ParameterList &l2_list = parameters->sublist( "L2 Projection" );
-    l2_list.set( "Integration Order", 3 );
-    Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
-    search_list.set( "Point Inclusion Tolerance", 1.0e-6 );
-
-    Teuchos::RCP<DataTransferKit::L2ProjectionOperator> map_op =
-        Teuchos::rcp( new DataTransferKit::L2ProjectionOperator(
+    // Create the map with the given L2 projection parameters and set it up.
+    void setup( const Teuchos::ParameterList &l2_params )
+    {
+        Teuchos::RCP<Teuchos::ParameterList> parameters =
+            Teuchos::parameterList();
+        Teuchos::ParameterList &l2_list =
+            parameters->sublist( "L2 Projection" );
+        l2_list.setParameters( l2_params );
+        l2_list.set( "Integration Order", 3 );
+        Teuchos::ParameterList &search_list = parameters->sublist( "Search" );
+        search_list.set( "Point Inclusion Tolerance", 1.0e-6 );
+
+        map_op = Teuchos::rcp( new DataTransferKit::L2ProjectionOperator(
             source_vector->getMap(), target_vector->getMap(), *parameters ) );
-
-    // Setup the map.
-    map_op->setup( source_mesh.functionSpace(), target_mesh.functionSpace() );
+        map_op->setup( source_mesh->functionSpace(),
+                       target_mesh->functionSpace() );
+    }
 
     // Apply the map.
-    map_op->apply( *source_vector, *target_vector );
+    void apply() { map_op->apply( *source_vector, *target_vector ); }
 
-    // Check the results of the mapping.
-    auto target_nodes =
-        target_mesh.functionSpace()->entitySet()->entityIterator(
-            0, local_pred.getFunction() );
-    auto target_nodes_begin = target_nodes.begin();
-    auto target_nodes_end = target_nodes.end();
-    auto target_local_map = target_mesh.functionSpace()->localMap();
-    Teuchos::Array<double> target_coords( 3 );
-    for ( target_nodes = target_nodes.begin();
-          target_nodes != target_nodes.end(); ++target_nodes )
+    // Check that the target field is the linear field.
+    void checkTargetField( Teuchos::FancyOStream &out, bool &success ) const
     {
-        unsigned k = target_nodes->id() / ( num_tx * num_ty );
-        unsigned j = ( target_nodes->id() - k * num_tx * num_ty ) / num_tx;
-        unsigned i = target_nodes->id() - j * num_tx - k * num_tx * num_ty;
-        TEST_EQUALITY( target_nodes->id(),
-                       i + j * num_tx + k * num_tx * num_ty );
-
-        target_local_map->centroid( *target_nodes, target_coords() );
-        double gold_data = testFunction( target_coords() );
-        double target_data =
-            target_field->readFieldData( target_nodes->id(), 0 );
-        TEST_FLOATING_EQUALITY( target_data, gold_data, field_epsilon );
+        DataTransferKit::LocalEntityPredicate local_pred( comm->getRank() );
+        auto target_nodes =
+            target_mesh->functionSpace()->entitySet()->entityIterator(
+                0, local_pred.getFunction() );
+        auto target_local_map = target_mesh->functionSpace()->localMap();
+        Teuchos::Array<double> target_coords( 3 );
+        for ( target_nodes = target_nodes.begin();
+              target_nodes != target_nodes.end(); ++target_nodes )
+        {
+            unsigned k = target_nodes->id() / ( num_tx * num_ty );
+            unsigned j =
+                ( target_nodes->id() - k * num_tx * num_ty ) / num_tx;
+            unsigned i =
+                target_nodes->id() - j * num_tx - k * num_tx * num_ty;
+            TEST_EQUALITY( target_nodes->id(),
+                           i + j * num_tx + k * num_tx * num_ty );
+
+            target_local_map->centroid( *target_nodes, target_coords() );
+            for ( int d = 0; d < field_dim; ++d )
+            {
+                double gold_data =
+                    ( d + 1.0 ) * testFunction( target_coords() );
+                double target_data =
+                    target_field->readFieldData( target_nodes->id(), d );
+                TEST_FLOATING_EQUALITY( target_data, gold_data,
+                                        field_epsilon );
+            }
+        }
     }
 
     // Check accurate preservation of the global integral. We are using the
     // source mesh quadrature so this should be very accurate.
-    double source_integral = integrateField( source_mesh, *source_field );
-    double target_integral = integrateField( target_mesh, *target_field );
-    TEST_FLOATING_EQUALITY( source_integral, target_integral,
-                            integral_epsilon );
+    void checkIntegral( Teuchos::FancyOStream &out, bool &success ) const
+    {
+        double source_integral = integrateField( *source_mesh, *source_field );
+        double target_integral = integrateField( *target_mesh, *target_field );
+        TEST_FLOATING_EQUALITY( source_integral, target_integral,
+                                integral_epsilon );
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( L2ProjectionOperator, l2_projection )
+{
+    // Use the default CG mass matrix solve.
+    L2ProjectionProblem problem( 1 );
+    problem.setup( Teuchos::ParameterList() );
+
+    // Apply the map with an active profiler.
+    DataTransferKit::Profiler profiler;
+    {
+        DataTransferKit::ProfilerScope scope( profiler );
+        problem.apply();
+    }
+
+    // Check that the mass matrix solve iterations were recorded.
+    TEST_ASSERT( profiler.count( "L2 Projection: Krylov Iterations" ) > 0 );
+
+    // Check the results of the mapping.
+    problem.checkTargetField( out, success );
+    problem.checkIntegral( out, success );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( L2ProjectionOperator, l2_projection_block_cg )
+{
+    // Map a multi-component field with block CG and a diagonal
+    // preconditioner.
+    L2ProjectionProblem problem( 3 );
+    Teuchos::ParameterList l2_params;
+    l2_params.set( "Solver Type", std::string( "Block CG" ) );
+    l2_params.set( "Preconditioner Type", std::string( "Diagonal" ) );
+    l2_params.set( "Convergence Tolerance", 1.0e-12 );
+    problem.setup( l2_params );
+    problem.apply();
+
+    // Check the results of the mapping.
+    problem.checkTargetField( out, success );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( L2ProjectionOperator, l2_projection_lumped_mass )
+{
+    // Use the lumped mass matrix instead of a solve.
+    L2ProjectionProblem problem( 1 );
+    Teuchos::ParameterList l2_params;
+    l2_params.set( "Solver Type", std::string( "Lumped Mass" ) );
+    problem.setup( l2_params );
+    problem.apply();
+
+    // The lumped projection is not exact for a linear field but it still
+    // conserves the global integral.
+    problem.checkIntegral( out, success );
 }
 
 //---------------------------------------------------------------------------//
@@ -168,6 +168,24 @@ TEUCHOS_UNIT_TEST( ParallelSearch, all_to_one_test )
                        parallel_search.rangeEntityOwnerRank( local_range[i] ) );
     }
 
+    // Check the unique pairings are sorted by range id.
+    Teuchos::Array<EntityId> unique_range;
+    Teuchos::Array<EntityId> unique_domain;
+    Teuchos::Array<double> unique_coords;
+    parallel_search.getUniqueRangePairings( unique_range, unique_domain,
+                                            unique_coords );
+    TEST_EQUALITY( unique_range.size(), range_size );
+    TEST_EQUALITY( unique_domain.size(), range_size );
+    TEST_EQUALITY( unique_coords.size(), 3 * range_size );
+    for ( int i = 0; i < range_size; ++i )
+    {
+        TEST_EQUALITY( Teuchos::as<int>( unique_range[i] ), i );
+        TEST_EQUALITY( unique_domain[i], unique_range[i] % num_points );
+        TEST_EQUALITY( unique_coords[3 * i], 0.5 );
+        TEST_EQUALITY( unique_coords[3 * i + 1], 0.5 );
+        TEST_EQUALITY( unique_coords[3 * i + 2], unique_domain[i] + 0.5 );
+    }
+
     // Check that no missed points were found.
     TEST_EQUALITY( parallel_search.getMissedRangeEntityIds().size(), 0 );
 }
@@ -52,6 +52,7 @@
 #include <DTK_FieldMultiVector.hpp>
 #include <DTK_MapOperatorFactory.hpp>
 #include <DTK_Point.hpp>
+#include <DTK_Profiler.hpp>
 
 #include "Teuchos_Array.hpp"
 #include "Teuchos_ArrayRCP.hpp"
@@ -176,11 +177,19 @@ void setupAndRunTest( const std::string &input_file,
 //---------------------------------------------------------------------------//
 TEUCHOS_UNIT_TEST( SplineInterpolationOperator, spline_radius_test )
 {
-    // Run the test.
+    // Run the test with an active profiler.
     Teuchos::Array<double> gold_data;
     Teuchos::Array<double> test_result;
-    setupAndRunTest( "spline_interpolation_test_radius.xml", gold_data,
-                     test_result );
+    DataTransferKit::Profiler profiler;
+    {
+        DataTransferKit::ProfilerScope scope( profiler );
+        setupAndRunTest( "spline_interpolation_test_radius.xml", gold_data,
+                         test_result );
+    }
+
+    // Check that the coefficient solve iterations were recorded.
+    TEST_ASSERT(
+        profiler.count( "Spline Interpolation: Krylov Iterations" ) > 0 );
 
     // Check the results.
     TEST_EQUALITY( gold_data.size(), test_result.size() );
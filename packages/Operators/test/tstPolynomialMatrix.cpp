@@ -255,6 +255,24 @@ TEUCHOS_UNIT_TEST( PolynomialMatrix, polynomial_matrix_transpose_apply )
                           epsilon_abs );
         }
     }
+
+    // Apply again with a new vector. The polynomial matrix reuses its
+    // exporter and work vector.
+    X->randomize();
+    P_crs->apply( *X, *Y_crs, Teuchos::TRANS );
+    P_poly_mat.apply( *X, *Y_poly_mat, Teuchos::TRANS );
+    y_crs_view = Y_crs->get2dView();
+    y_pm_view = Y_poly_mat->get2dView();
+    for ( int i = 0; i < num_vec; ++i )
+    {
+        for ( int j = 0; j < local_size; ++j )
+        {
+            TEST_FLOATING_EQUALITY( y_crs_view[i][j], y_pm_view[i][j],
+                                    epsilon_rel );
+            TEST_COMPARE( std::abs( y_crs_view[i][j] - y_pm_view[i][j] ), <=,
+                          epsilon_abs );
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -471,6 +471,63 @@ TEUCHOS_UNIT_TEST( WuBasis, wu_basis_order_4 )
     TEST_EQUALITY( 0.0, basis_grad );
 }
 
+//---------------------------------------------------------------------------//
+// Check the batch evaluation of a basis against the point evaluation.
+template <class BasisType>
+void checkBatchEvaluation( Teuchos::FancyOStream &out, bool &success )
+{
+    typedef DataTransferKit::RadialBasisPolicy<BasisType> BP;
+    typedef DataTransferKit::EuclideanDistance<3> Distance;
+
+    // Make a set of points some of which are outside of the support.
+    int num_points = 7;
+    Teuchos::Array<double> points( 3 * num_points );
+    for ( int i = 0; i < num_points; ++i )
+    {
+        points[3 * i] = 0.1 * i;
+        points[3 * i + 1] = 0.2 * i - 0.3;
+        points[3 * i + 2] = 0.05 * i;
+    }
+    Teuchos::Array<unsigned> ids( 4 );
+    ids[0] = 5;
+    ids[1] = 0;
+    ids[2] = 6;
+    ids[3] = 2;
+    Teuchos::Array<double> center( 3, 0.1 );
+
+    Teuchos::RCP<BasisType> basis = BP::create();
+    double radius = 0.8;
+    Teuchos::Array<double> dists( ids.size() );
+    Distance::distances( center.getRawPtr(), points.getRawPtr(),
+                         ids.getRawPtr(), ids.size(), dists.getRawPtr() );
+    Teuchos::Array<double> values( ids.size() );
+    BP::evaluateValues( *basis, radius, dists.getRawPtr(), ids.size(),
+                        values.getRawPtr() );
+
+    for ( int i = 0; i < ids.size(); ++i )
+    {
+        double dist = Distance::distance( center.getRawPtr(),
+                                          &points[3 * ids[i]] );
+        TEST_FLOATING_EQUALITY( dist, dists[i], epsilon );
+        TEST_EQUALITY( BP::evaluateValue( *basis, radius, dists[i] ),
+                       values[i] );
+    }
+    TEST_EQUALITY( 0.0, values[2] );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( RadialBasisPolicy, batch_evaluation )
+{
+    checkBatchEvaluation<DataTransferKit::WendlandBasis<0>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WendlandBasis<2>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WendlandBasis<4>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WendlandBasis<6>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WendlandBasis<21>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WuBasis<2>>( out, success );
+    checkBatchEvaluation<DataTransferKit::WuBasis<4>>( out, success );
+    checkBatchEvaluation<DataTransferKit::BuhmannBasis<3>>( out, success );
+}
+
 //---------------------------------------------------------------------------//
 // end tstRadialBasis.cpp
 //---------------------------------------------------------------------------//
@@ -38,6 +38,8 @@
  */
 //---------------------------------------------------------------------------//
 
+#include <algorithm>
+
 #include "reference_implementation/DTK_ReferenceHex.hpp"
 #include "reference_implementation/DTK_ReferenceHexLocalMap.hpp"
 #include "reference_implementation/DTK_ReferenceNode.hpp"
@@ -187,6 +189,25 @@ TEUCHOS_UNIT_TEST( ReferenceHexLocalMap, local_map_test )
     TEST_EQUALITY( bad_point[0], phy_bad_point[0] );
     TEST_EQUALITY( bad_point[1], phy_bad_point[1] );
     TEST_EQUALITY( bad_point[2], phy_bad_point[2] );
+
+    // Test locating the points all at once.
+    Teuchos::Array<DataTransferKit::Entity> batch_entities( 3, hex );
+    Teuchos::Array<double> batch_points( 9 );
+    std::copy( good_point.begin(), good_point.end(), &batch_points[0] );
+    std::copy( fuzzy_point.begin(), fuzzy_point.end(), &batch_points[3] );
+    std::copy( bad_point.begin(), bad_point.end(), &batch_points[6] );
+    Teuchos::Array<double> batch_ref_points( 9 );
+    Teuchos::Array<int> batch_found( 3 );
+    local_map->locatePoints( batch_entities(), batch_points(),
+                             batch_ref_points(), batch_found() );
+    TEST_EQUALITY( batch_found[0], 1 );
+    TEST_EQUALITY( batch_found[1], 1 );
+    TEST_EQUALITY( batch_found[2], 0 );
+    for ( int d = 0; d < 3; ++d )
+    {
+        TEST_EQUALITY( batch_ref_points[d], ref_good_point[d] );
+        TEST_EQUALITY( batch_ref_points[3 + d], ref_fuzzy_point[d] );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,624 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_Profiler.cpp
+ * \author Stuart R. Slattery
+ * \brief Scoped timers, counters, and memory accounting for profiling DTK
+ * operations.
+ */
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "DTK_Profiler.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommHelpers.hpp>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/resource.h>
+#endif
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+namespace
+{
+// The active profiler.
+Profiler *active_profiler = nullptr;
+
+// Get the elapsed time in seconds since a time point.
+double elapsedSeconds( const std::chrono::steady_clock::time_point &start )
+{
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Write a string as a quoted JSON string, escaping quotes, backslashes and
+// control characters.
+void writeJSONString( const std::string &str, std::ostream &os )
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    os << "\"";
+    for ( char c : str )
+    {
+        switch ( c )
+        {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\b':
+            os << "\\b";
+            break;
+        case '\f':
+            os << "\\f";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\r':
+            os << "\\r";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if ( static_cast<unsigned char>( c ) < 0x20 )
+            {
+                os << "\\u00" << hex_digits[( c >> 4 ) & 0xf]
+                   << hex_digits[c & 0xf];
+            }
+            else
+            {
+                os << c;
+            }
+        }
+    }
+    os << "\"";
+}
+
+// Write a parameter list as a JSON object.
+void writeJSONList( const Teuchos::ParameterList &list, std::ostream &os,
+                    const int indent )
+{
+    std::string pad( indent + 2, ' ' );
+    os << "{";
+    bool first = true;
+    for ( auto it = list.begin(); it != list.end(); ++it )
+    {
+        os << ( first ? "\n" : ",\n" ) << pad;
+        writeJSONString( list.name( it ), os );
+        os << ": ";
+        const Teuchos::ParameterEntry &entry = list.entry( it );
+        if ( entry.isList() )
+        {
+            writeJSONList( Teuchos::getValue<Teuchos::ParameterList>( entry ),
+                           os, indent + 2 );
+        }
+        else if ( entry.isType<std::string>() )
+        {
+            writeJSONString( Teuchos::getValue<std::string>( entry ), os );
+        }
+        else
+        {
+            os << entry.getAny( false );
+        }
+        first = false;
+    }
+    if ( !first )
+    {
+        os << "\n" << std::string( indent, ' ' );
+    }
+    os << "}";
+}
+
+// Gather the union of a set of names over a communicator.
+std::set<std::string> gatherNames( const Teuchos::Comm<int> &comm,
+                                   const std::set<std::string> &names )
+{
+    // Pack the local names separated by null characters.
+    std::string local_names;
+    for ( auto &n : names )
+    {
+        local_names += n;
+        local_names.push_back( '\0' );
+    }
+
+    // Pad the packed names to the same size on all processes and gather.
+    int local_size = local_names.size();
+    int max_size = 0;
+    Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, local_size,
+                        Teuchos::ptrFromRef( max_size ) );
+    if ( 0 == max_size )
+    {
+        return names;
+    }
+    Teuchos::Array<char> send( max_size, '\0' );
+    std::copy( local_names.begin(), local_names.end(), send.begin() );
+    Teuchos::Array<char> receive( max_size * comm.getSize() );
+    Teuchos::gatherAll( comm, max_size, send.getRawPtr(),
+                        static_cast<int>( receive.size() ),
+                        receive.getRawPtr() );
+
+    // Unpack the names.
+    std::set<std::string> all_names;
+    auto begin = receive.begin();
+    while ( begin != receive.end() )
+    {
+        auto end = std::find( begin, receive.end(), '\0' );
+        if ( end != begin )
+        {
+            all_names.insert( std::string( begin, end ) );
+        }
+        begin = ( end == receive.end() ) ? end : end + 1;
+    }
+    return all_names;
+}
+} // end anonymous namespace
+
+//---------------------------------------------------------------------------//
+// Profiler
+//---------------------------------------------------------------------------//
+// Constructor.
+Profiler::Profiler()
+    : d_enabled( true )
+    , d_track_memory( false )
+{ /* ... */
+}
+
+//---------------------------------------------------------------------------//
+// Add elapsed time in seconds to a timer.
+void Profiler::addTime( const std::string &name, const double seconds,
+                        const int calls )
+{
+    TimerData &data =
+        d_timers.emplace( name, TimerData{0.0, 0, 0} ).first->second;
+    data.time += seconds;
+    data.calls += calls;
+}
+
+//---------------------------------------------------------------------------//
+// Add a value to a counter.
+void Profiler::addCount( const std::string &name, const long long count )
+{
+    d_counters[name] += count;
+}
+
+//---------------------------------------------------------------------------//
+// Record the bytes allocated by a named container.
+void Profiler::addMemory( const std::string &name, const long long bytes )
+{
+    long long &data = d_memory.emplace( name, 0 ).first->second;
+    data = std::max( data, bytes );
+}
+
+//---------------------------------------------------------------------------//
+// Get the total time of a timer in seconds.
+double Profiler::time( const std::string &name ) const
+{
+    auto it = d_timers.find( name );
+    return ( it != d_timers.end() ) ? it->second.time : 0.0;
+}
+
+//---------------------------------------------------------------------------//
+// Get the number of calls to a timer.
+int Profiler::calls( const std::string &name ) const
+{
+    auto it = d_timers.find( name );
+    return ( it != d_timers.end() ) ? it->second.calls : 0;
+}
+
+//---------------------------------------------------------------------------//
+// Get the value of a counter.
+long long Profiler::count( const std::string &name ) const
+{
+    auto it = d_counters.find( name );
+    return ( it != d_counters.end() ) ? it->second : 0;
+}
+
+//---------------------------------------------------------------------------//
+// Get the largest number of bytes recorded for a container.
+long long Profiler::memory( const std::string &name ) const
+{
+    auto it = d_memory.find( name );
+    return ( it != d_memory.end() ) ? it->second : 0;
+}
+
+//---------------------------------------------------------------------------//
+// Get the largest resident set size high-water mark recorded at the end of a
+// timer.
+long long Profiler::peakResidentBytes( const std::string &name ) const
+{
+    auto it = d_timers.find( name );
+    return ( it != d_timers.end() ) ? it->second.peak_rss : 0;
+}
+
+//---------------------------------------------------------------------------//
+// Clear all timers, counters, and memory records.
+void Profiler::reset()
+{
+    d_timers.clear();
+    d_counters.clear();
+    d_memory.clear();
+}
+
+//---------------------------------------------------------------------------//
+// Get a report of the local timers and counters.
+Teuchos::RCP<Teuchos::ParameterList> Profiler::report() const
+{
+    Teuchos::RCP<Teuchos::ParameterList> report =
+        Teuchos::parameterList( "Profile" );
+    Teuchos::ParameterList &timers = report->sublist( "Timers" );
+    for ( auto &t : d_timers )
+    {
+        Teuchos::ParameterList &timer = timers.sublist( t.first );
+        timer.set( "Time", t.second.time );
+        timer.set( "Calls", t.second.calls );
+        if ( t.second.peak_rss > 0 )
+        {
+            timer.set( "Peak RSS", t.second.peak_rss );
+        }
+    }
+    Teuchos::ParameterList &counters = report->sublist( "Counters" );
+    for ( auto &c : d_counters )
+    {
+        counters.set( c.first, c.second );
+    }
+    if ( !d_memory.empty() )
+    {
+        Teuchos::ParameterList &memory = report->sublist( "Memory" );
+        for ( auto &m : d_memory )
+        {
+            memory.set( m.first, m.second );
+        }
+    }
+    return report;
+}
+
+//---------------------------------------------------------------------------//
+// Get a report of the timers and counters over a communicator.
+Teuchos::RCP<Teuchos::ParameterList>
+Profiler::globalReport( const Teuchos::Comm<int> &comm ) const
+{
+    // Processes may have recorded different timers and counters so first
+    // agree on the union of the names.
+    std::set<std::string> local_timer_names;
+    for ( auto &t : d_timers )
+    {
+        local_timer_names.insert( t.first );
+    }
+    std::set<std::string> local_counter_names;
+    for ( auto &c : d_counters )
+    {
+        local_counter_names.insert( c.first );
+    }
+    std::set<std::string> local_memory_names;
+    for ( auto &m : d_memory )
+    {
+        local_memory_names.insert( m.first );
+    }
+    std::set<std::string> timer_names =
+        gatherNames( comm, local_timer_names );
+    std::set<std::string> counter_names =
+        gatherNames( comm, local_counter_names );
+    std::set<std::string> memory_names =
+        gatherNames( comm, local_memory_names );
+
+    // Reduce the timers.
+    int num_timers = timer_names.size();
+    Teuchos::Array<double> local_times( num_timers );
+    Teuchos::Array<int> local_calls( num_timers );
+    Teuchos::Array<long long> local_rss( num_timers );
+    int n = 0;
+    for ( auto &name : timer_names )
+    {
+        local_times[n] = time( name );
+        local_calls[n] = calls( name );
+        local_rss[n] = peakResidentBytes( name );
+        ++n;
+    }
+    Teuchos::Array<double> max_times( num_timers, 0.0 );
+    Teuchos::Array<double> total_times( num_timers, 0.0 );
+    Teuchos::Array<int> total_calls( num_timers, 0 );
+    Teuchos::Array<long long> max_rss( num_timers, 0 );
+    if ( num_timers > 0 )
+    {
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, num_timers,
+                            local_times.getRawPtr(), max_times.getRawPtr() );
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_SUM, num_timers,
+                            local_times.getRawPtr(),
+                            total_times.getRawPtr() );
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_SUM, num_timers,
+                            local_calls.getRawPtr(),
+                            total_calls.getRawPtr() );
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, num_timers,
+                            local_rss.getRawPtr(), max_rss.getRawPtr() );
+    }
+
+    // Reduce the counters.
+    int num_counters = counter_names.size();
+    Teuchos::Array<long long> local_counts( num_counters );
+    n = 0;
+    for ( auto &name : counter_names )
+    {
+        local_counts[n] = count( name );
+        ++n;
+    }
+    Teuchos::Array<long long> max_counts( num_counters, 0 );
+    Teuchos::Array<long long> total_counts( num_counters, 0 );
+    if ( num_counters > 0 )
+    {
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, num_counters,
+                            local_counts.getRawPtr(), max_counts.getRawPtr() );
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_SUM, num_counters,
+                            local_counts.getRawPtr(),
+                            total_counts.getRawPtr() );
+    }
+
+    // Reduce the container bytes.
+    int num_memory = memory_names.size();
+    Teuchos::Array<long long> local_bytes( num_memory );
+    n = 0;
+    for ( auto &name : memory_names )
+    {
+        local_bytes[n] = memory( name );
+        ++n;
+    }
+    Teuchos::Array<long long> max_bytes( num_memory, 0 );
+    Teuchos::Array<long long> total_bytes( num_memory, 0 );
+    if ( num_memory > 0 )
+    {
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_MAX, num_memory,
+                            local_bytes.getRawPtr(), max_bytes.getRawPtr() );
+        Teuchos::reduceAll( comm, Teuchos::REDUCE_SUM, num_memory,
+                            local_bytes.getRawPtr(),
+                            total_bytes.getRawPtr() );
+    }
+
+    // Build the report.
+    Teuchos::RCP<Teuchos::ParameterList> report =
+        Teuchos::parameterList( "Profile" );
+    Teuchos::ParameterList &timers = report->sublist( "Timers" );
+    n = 0;
+    for ( auto &name : timer_names )
+    {
+        Teuchos::ParameterList &timer = timers.sublist( name );
+        timer.set( "Max Time", max_times[n] );
+        timer.set( "Total Time", total_times[n] );
+        timer.set( "Calls", total_calls[n] );
+        if ( max_rss[n] > 0 )
+        {
+            timer.set( "Max Peak RSS", max_rss[n] );
+        }
+        ++n;
+    }
+    Teuchos::ParameterList &counters = report->sublist( "Counters" );
+    n = 0;
+    for ( auto &name : counter_names )
+    {
+        Teuchos::ParameterList &counter = counters.sublist( name );
+        counter.set( "Max", max_counts[n] );
+        counter.set( "Total", total_counts[n] );
+        ++n;
+    }
+    if ( num_memory > 0 )
+    {
+        Teuchos::ParameterList &memory = report->sublist( "Memory" );
+        n = 0;
+        for ( auto &name : memory_names )
+        {
+            Teuchos::ParameterList &container = memory.sublist( name );
+            container.set( "Max", max_bytes[n] );
+            container.set( "Total", total_bytes[n] );
+            ++n;
+        }
+    }
+    return report;
+}
+
+//---------------------------------------------------------------------------//
+// Write a report in JSON format.
+void Profiler::writeJSON( const Teuchos::ParameterList &report,
+                          std::ostream &os )
+{
+    writeJSONList( report, os, 0 );
+    os << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+// Get the active profiler.
+Profiler *Profiler::active() { return active_profiler; }
+
+//---------------------------------------------------------------------------//
+// Add elapsed time to a timer of the active profiler.
+void Profiler::recordTime( const char *name, const double seconds,
+                           const int calls )
+{
+    if ( nullptr != active_profiler )
+    {
+        active_profiler->addTime( name, seconds, calls );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Add a value to a counter of the active profiler.
+void Profiler::recordCount( const char *name, const long long count )
+{
+    if ( nullptr != active_profiler )
+    {
+        active_profiler->addCount( name, count );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Return true if there is an active profiler that is tracking memory.
+bool Profiler::trackingMemory()
+{
+    return ( nullptr != active_profiler ) && active_profiler->d_track_memory;
+}
+
+//---------------------------------------------------------------------------//
+// Record the bytes of a container in the active profiler.
+void Profiler::recordMemory( const char *name, const long long bytes )
+{
+    if ( trackingMemory() )
+    {
+        active_profiler->addMemory( name, bytes );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Get the resident set size high-water mark of the process in bytes.
+long long Profiler::processPeakResidentBytes()
+{
+#if defined( __unix__ ) || defined( __APPLE__ )
+    struct rusage usage;
+    if ( 0 != getrusage( RUSAGE_SELF, &usage ) )
+    {
+        return 0;
+    }
+#if defined( __APPLE__ )
+    // Reported in bytes.
+    return usage.ru_maxrss;
+#else
+    // Reported in kilobytes.
+    return 1024LL * usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// ProfilerScope
+//---------------------------------------------------------------------------//
+// Constructor.
+ProfilerScope::ProfilerScope( Profiler &profiler )
+    : d_previous( active_profiler )
+{
+    if ( profiler.isEnabled() )
+    {
+        active_profiler = &profiler;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Destructor.
+ProfilerScope::~ProfilerScope() { active_profiler = d_previous; }
+
+//---------------------------------------------------------------------------//
+// ScopedTimer
+//---------------------------------------------------------------------------//
+// Constructor.
+ScopedTimer::ScopedTimer( const char *name )
+    : d_profiler( active_profiler )
+    , d_name( name )
+{
+    if ( nullptr != d_profiler )
+    {
+        d_start = std::chrono::steady_clock::now();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Destructor.
+ScopedTimer::~ScopedTimer()
+{
+    if ( nullptr != d_profiler )
+    {
+        d_profiler->addTime( d_name, elapsedSeconds( d_start ) );
+        if ( d_profiler->d_track_memory )
+        {
+            long long &peak_rss = d_profiler->d_timers[d_name].peak_rss;
+            peak_rss =
+                std::max( peak_rss, Profiler::processPeakResidentBytes() );
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Stopwatch
+//---------------------------------------------------------------------------//
+// Constructor.
+Stopwatch::Stopwatch()
+    : d_active( nullptr != active_profiler )
+    , d_total( 0.0 )
+    , d_intervals( 0 )
+{ /* ... */
+}
+
+//---------------------------------------------------------------------------//
+// Start an interval.
+void Stopwatch::start()
+{
+    if ( d_active )
+    {
+        d_start = std::chrono::steady_clock::now();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Stop an interval and add it to the total.
+void Stopwatch::stop()
+{
+    if ( d_active )
+    {
+        d_total += elapsedSeconds( d_start );
+        ++d_intervals;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Record the total time into a timer of the active profiler.
+void Stopwatch::record( const char *name ) const
+{
+    if ( d_active && d_intervals > 0 )
+    {
+        Profiler::recordTime( name, d_total, d_intervals );
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+// end DTK_Profiler.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file DTK_Profiler.hpp
+ * \author Stuart R. Slattery
+ * \brief Scoped timers, counters, and memory accounting for profiling DTK
+ * operations.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef DTK_PROFILER_HPP
+#define DTK_PROFILER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+namespace DataTransferKit
+{
+//---------------------------------------------------------------------------//
+/*!
+ * \class Profiler
+ * \brief Named timers and counters.
+ *
+ * A profiler accumulates the elapsed time and number of calls of named
+ * timers and the values of named counters. Instrumented code records into
+ * the active profiler, which is set for the lifetime of a ProfilerScope. If
+ * no profiler is active, recording does nothing and the timers do not read
+ * the clock so the instrumentation is essentially free when profiling is
+ * off.
+ *
+ * If memory tracking is on, the profiler also records the bytes allocated by
+ * named containers and each scoped timer records the process resident set
+ * size high-water mark when its scope ends. Memory tracking is off by
+ * default as computing container sizes is not free.
+ */
+//---------------------------------------------------------------------------//
+class Profiler
+{
+  public:
+    // Constructor.
+    Profiler();
+
+    //! Enable or disable recording into this profiler.
+    void setEnabled( const bool enabled ) { d_enabled = enabled; }
+
+    //! Return true if recording into this profiler is enabled.
+    bool isEnabled() const { return d_enabled; }
+
+    // Add elapsed time in seconds to a timer.
+    void addTime( const std::string &name, const double seconds,
+                  const int calls = 1 );
+
+    // Add a value to a counter.
+    void addCount( const std::string &name, const long long count );
+
+    //! Turn on or off memory tracking.
+    void setMemoryTracking( const bool track ) { d_track_memory = track; }
+
+    //! Return true if memory tracking is on.
+    bool isTrackingMemory() const { return d_track_memory; }
+
+    // Record the bytes allocated by a named container. The largest value
+    // recorded is kept.
+    void addMemory( const std::string &name, const long long bytes );
+
+    // Get the total time of a timer in seconds.
+    double time( const std::string &name ) const;
+
+    // Get the number of calls to a timer.
+    int calls( const std::string &name ) const;
+
+    // Get the value of a counter.
+    long long count( const std::string &name ) const;
+
+    // Get the largest number of bytes recorded for a container.
+    long long memory( const std::string &name ) const;
+
+    // Get the largest resident set size high-water mark in bytes recorded
+    // at the end of a timer.
+    long long peakResidentBytes( const std::string &name ) const;
+
+    // Clear all timers, counters, and memory records.
+    void reset();
+
+    /*!
+     * \brief Get a report of the local timers and counters. The report has a
+     * "Timers" sublist with a sublist for each timer containing its "Time"
+     * and "Calls" and a "Counters" sublist with an entry for each counter. If
+     * memory was tracked each timer sublist also contains its "Peak RSS" and
+     * a "Memory" sublist has an entry with the bytes of each container.
+     */
+    Teuchos::RCP<Teuchos::ParameterList> report() const;
+
+    /*!
+     * \brief Get a report of the timers and counters over a communicator. The
+     * report has the same layout as the local report except each timer
+     * sublist contains its "Max Time", "Total Time", and "Calls" over all
+     * processes and each counter sublist contains its "Max" and "Total" over
+     * all processes. If memory was tracked each timer sublist also contains
+     * its "Max Peak RSS" and the "Memory" sublist has a sublist with the
+     * "Max" and "Total" bytes of each container. This is a collective
+     * operation.
+     */
+    Teuchos::RCP<Teuchos::ParameterList>
+    globalReport( const Teuchos::Comm<int> &comm ) const;
+
+    // Write a report in JSON format.
+    static void writeJSON( const Teuchos::ParameterList &report,
+                           std::ostream &os );
+
+    // Get the active profiler. Returns null if there is no active profiler.
+    static Profiler *active();
+
+    // Add elapsed time to a timer of the active profiler.
+    static void recordTime( const char *name, const double seconds,
+                            const int calls = 1 );
+
+    // Add a value to a counter of the active profiler.
+    static void recordCount( const char *name, const long long count );
+
+    // Return true if there is an active profiler that is tracking memory.
+    // Use this to avoid computing container sizes that will not be used.
+    static bool trackingMemory();
+
+    // Record the bytes of a container in the active profiler if it is
+    // tracking memory.
+    static void recordMemory( const char *name, const long long bytes );
+
+    // Get the resident set size high-water mark of the process in bytes.
+    // Returns 0 if this is not available on the platform.
+    static long long processPeakResidentBytes();
+
+  private:
+    friend class ProfilerScope;
+    friend class ScopedTimer;
+
+    // Timer data.
+    struct TimerData
+    {
+        double time;
+        int calls;
+        long long peak_rss;
+    };
+
+    // Enabled flag.
+    bool d_enabled;
+
+    // Memory tracking flag.
+    bool d_track_memory;
+
+    // Timers.
+    std::map<std::string, TimerData> d_timers;
+
+    // Counters.
+    std::map<std::string, long long> d_counters;
+
+    // Container bytes.
+    std::map<std::string, long long> d_memory;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Get the bytes allocated by a contiguous container such as a
+ * std::vector or Teuchos::Array.
+ */
+template <class Container>
+long long containerBytes( const Container &container )
+{
+    return container.capacity() * sizeof( typename Container::value_type );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Estimate the bytes allocated by a node-based hashed container such
+ * as a std::unordered_map. Each element is assumed to cost a node holding the
+ * value, a next pointer, and a cached hash, and each bucket a pointer.
+ */
+template <class Container>
+long long hashedContainerBytes( const Container &container )
+{
+    return container.size() * ( sizeof( typename Container::value_type ) +
+                                sizeof( void * ) + sizeof( std::size_t ) ) +
+           container.bucket_count() * sizeof( void * );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \class ProfilerScope
+ * \brief Make a profiler active for the lifetime of the scope. The previously
+ * active profiler is restored when the scope ends. A disabled profiler does
+ * not become active.
+ */
+//---------------------------------------------------------------------------//
+class ProfilerScope
+{
+  public:
+    // Constructor.
+    explicit ProfilerScope( Profiler &profiler );
+
+    // Destructor.
+    ~ProfilerScope();
+
+  private:
+    // The previously active profiler.
+    Profiler *d_previous;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \class ScopedTimer
+ * \brief Record the lifetime of the scope into a timer of the active
+ * profiler. If the profiler is tracking memory the process resident set size
+ * high-water mark is also recorded with the timer when the scope ends.
+ */
+//---------------------------------------------------------------------------//
+class ScopedTimer
+{
+  public:
+    // Constructor.
+    explicit ScopedTimer( const char *name );
+
+    // Destructor.
+    ~ScopedTimer();
+
+  private:
+    // The profiler that was active at construction.
+    Profiler *d_profiler;
+
+    // Timer name.
+    const char *d_name;
+
+    // Start time.
+    std::chrono::steady_clock::time_point d_start;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * \class Stopwatch
+ * \brief Accumulate time over many short intervals, e.g. within a loop, and
+ * record it once. The clock is only read if a profiler is active.
+ */
+//---------------------------------------------------------------------------//
+class Stopwatch
+{
+  public:
+    // Constructor.
+    Stopwatch();
+
+    // Start an interval.
+    void start();
+
+    // Stop an interval and add it to the total.
+    void stop();
+
+    // Record the total time and number of intervals into a timer of the
+    // active profiler.
+    void record( const char *name ) const;
+
+  private:
+    // True if a profiler was active at construction.
+    bool d_active;
+
+    // Start time of the current interval.
+    std::chrono::steady_clock::time_point d_start;
+
+    // Total time in seconds.
+    double d_total;
+
+    // Number of intervals.
+    int d_intervals;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace DataTransferKit
+
+//---------------------------------------------------------------------------//
+
+#endif // end DTK_PROFILER_HPP
+
+//---------------------------------------------------------------------------//
+// end DTK_Profiler.hpp
+//---------------------------------------------------------------------------//
@@ -132,6 +132,9 @@ class NanoflannTree : public StaticSearchTree
         DIM, unsigned>
         TreeType;
 
+    //! Leaf size used by the point cloud operators when none is given.
+    static const unsigned default_leaf_size = 30;
+
   public:
     // Default constructor.
     NanoflannTree( const Teuchos::ArrayView<const double> &points,
@@ -145,6 +148,13 @@ class NanoflannTree : public StaticSearchTree
     nnSearch( const Teuchos::ArrayView<const double> &point,
               const unsigned num_neighbors ) const;
 
+    // Perform an n-nearest neighbor search into caller-owned buffers. This
+    // overload is not virtual and does not allocate if the buffers already
+    // have enough capacity.
+    void nnSearch( const double *point, const unsigned num_neighbors,
+                   Teuchos::Array<unsigned> &neighbors,
+                   Teuchos::Array<double> &neighbor_dists ) const;
+
     // Perform a nearest neighbor search within a specified radius.
     Teuchos::Array<unsigned>
     radiusSearch( const Teuchos::ArrayView<const double> &point,
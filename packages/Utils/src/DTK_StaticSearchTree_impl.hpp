@@ -174,6 +174,22 @@ NanoflannTree<DIM>::nnSearch( const Teuchos::ArrayView<const double> &point,
     return neighbors;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Perform an n-nearest neighbor search into caller-owned buffers.
+ */
+template <int DIM>
+void NanoflannTree<DIM>::nnSearch(
+    const double *point, const unsigned num_neighbors,
+    Teuchos::Array<unsigned> &neighbors,
+    Teuchos::Array<double> &neighbor_dists ) const
+{
+    neighbors.resize( num_neighbors );
+    neighbor_dists.resize( num_neighbors );
+    d_tree->knnSearch( point, num_neighbors, neighbors.getRawPtr(),
+                       neighbor_dists.getRawPtr() );
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * \brief Perform a nearest neighbor search within a specified radius.
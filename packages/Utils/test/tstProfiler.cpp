@@ -0,0 +1,260 @@
+//---------------------------------------------------------------------------//
+/*
+  Copyright (c) 2012, Stuart R. Slattery
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  *: Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+
+  *: Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+  *: Neither the name of the University of Wisconsin - Madison nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+//---------------------------------------------------------------------------//
+/*!
+ * \file tstProfiler.cpp
+ * \brief Profiler unit tests.
+ */
+//---------------------------------------------------------------------------//
+
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <DTK_Profiler.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( Profiler, scoped_timers_and_counters )
+{
+    using namespace DataTransferKit;
+
+    // Without an active profiler nothing is recorded.
+    TEST_ASSERT( nullptr == Profiler::active() );
+    Profiler profiler;
+    {
+        ScopedTimer timer( "Outside" );
+        Profiler::recordCount( "Outside", 1 );
+    }
+    TEST_EQUALITY( profiler.calls( "Outside" ), 0 );
+    TEST_EQUALITY( profiler.count( "Outside" ), 0 );
+
+    // Record into the active profiler.
+    {
+        ProfilerScope scope( profiler );
+        TEST_EQUALITY( Profiler::active(), &profiler );
+        for ( int i = 0; i < 3; ++i )
+        {
+            ScopedTimer timer( "Loop" );
+            Profiler::recordCount( "Items", 2 );
+        }
+
+        Stopwatch watch;
+        watch.start();
+        watch.stop();
+        watch.start();
+        watch.stop();
+        watch.record( "Intervals" );
+    }
+    TEST_ASSERT( nullptr == Profiler::active() );
+    TEST_EQUALITY( profiler.calls( "Loop" ), 3 );
+    TEST_ASSERT( profiler.time( "Loop" ) >= 0.0 );
+    TEST_EQUALITY( profiler.calls( "Intervals" ), 2 );
+    TEST_EQUALITY( profiler.count( "Items" ), 6 );
+
+    // Reset the profiler.
+    profiler.reset();
+    TEST_EQUALITY( profiler.calls( "Loop" ), 0 );
+    TEST_EQUALITY( profiler.count( "Items" ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( Profiler, disabled_profiler )
+{
+    using namespace DataTransferKit;
+
+    // A disabled profiler does not become active and records nothing.
+    Profiler profiler;
+    profiler.setEnabled( false );
+    TEST_ASSERT( !profiler.isEnabled() );
+    {
+        ProfilerScope scope( profiler );
+        TEST_ASSERT( nullptr == Profiler::active() );
+        ScopedTimer timer( "Disabled" );
+        Profiler::recordCount( "Disabled", 1 );
+    }
+    TEST_EQUALITY( profiler.calls( "Disabled" ), 0 );
+    TEST_EQUALITY( profiler.count( "Disabled" ), 0 );
+
+    // Nested scopes restore the previous profiler.
+    Profiler outer;
+    {
+        ProfilerScope outer_scope( outer );
+        {
+            ProfilerScope inner_scope( profiler );
+            TEST_EQUALITY( Profiler::active(), &outer );
+        }
+        TEST_EQUALITY( Profiler::active(), &outer );
+    }
+    TEST_ASSERT( nullptr == Profiler::active() );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( Profiler, reports )
+{
+    using namespace DataTransferKit;
+
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_rank = comm->getRank();
+    int comm_size = comm->getSize();
+
+    // Record a timer on every rank and a counter only on rank 0.
+    Profiler profiler;
+    profiler.addTime( "Setup", 1.0 + comm_rank, 2 );
+    if ( 0 == comm_rank )
+    {
+        profiler.addCount( "Entities", 10 );
+    }
+
+    // Check the local report.
+    Teuchos::RCP<Teuchos::ParameterList> local = profiler.report();
+    const Teuchos::ParameterList &local_timer =
+        local->sublist( "Timers" ).sublist( "Setup" );
+    TEST_EQUALITY( local_timer.get<double>( "Time" ), 1.0 + comm_rank );
+    TEST_EQUALITY( local_timer.get<int>( "Calls" ), 2 );
+
+    // Check the global report. Names recorded on any rank are reported on
+    // all ranks.
+    Teuchos::RCP<Teuchos::ParameterList> global =
+        profiler.globalReport( *comm );
+    const Teuchos::ParameterList &global_timer =
+        global->sublist( "Timers" ).sublist( "Setup" );
+    double total_time = comm_size + 0.5 * comm_size * ( comm_size - 1 );
+    TEST_EQUALITY( global_timer.get<double>( "Max Time" ),
+                   1.0 * comm_size );
+    TEST_EQUALITY( global_timer.get<double>( "Total Time" ), total_time );
+    TEST_EQUALITY( global_timer.get<int>( "Calls" ), 2 * comm_size );
+    const Teuchos::ParameterList &global_counter =
+        global->sublist( "Counters" ).sublist( "Entities" );
+    TEST_EQUALITY( global_counter.get<long long>( "Max" ), 10 );
+    TEST_EQUALITY( global_counter.get<long long>( "Total" ), 10 );
+
+    // Check the JSON output.
+    std::ostringstream os;
+    Profiler::writeJSON( *global, os );
+    std::string json = os.str();
+    TEST_ASSERT( json.find( "\"Timers\": {" ) != std::string::npos );
+    TEST_ASSERT( json.find( "\"Setup\": {" ) != std::string::npos );
+    TEST_ASSERT( json.find( "\"Entities\": {" ) != std::string::npos );
+    TEST_EQUALITY( json.front(), '{' );
+
+    // Names and string values are escaped.
+    Teuchos::ParameterList escaped;
+    escaped.sublist( "Timers" ).set<std::string>( "Map \"A\\B\"",
+                                                  "line\nnext" );
+    std::ostringstream escaped_os;
+    Profiler::writeJSON( escaped, escaped_os );
+    json = escaped_os.str();
+    TEST_ASSERT( json.find( "\"Map \\\"A\\\\B\\\"\": " ) !=
+                 std::string::npos );
+    TEST_ASSERT( json.find( "\"line\\nnext\"" ) != std::string::npos );
+}
+
+//---------------------------------------------------------------------------//
+TEUCHOS_UNIT_TEST( Profiler, memory_tracking )
+{
+    using namespace DataTransferKit;
+
+    Teuchos::RCP<const Teuchos::Comm<int>> comm =
+        Teuchos::DefaultComm<int>::getComm();
+    int comm_size = comm->getSize();
+
+    // Container sizes.
+    Teuchos::Array<double> values;
+    values.reserve( 10 );
+    TEST_EQUALITY( containerBytes( values ),
+                   static_cast<long long>( 10 * sizeof( double ) ) );
+    std::unordered_map<int, int> map;
+    map.emplace( 1, 2 );
+    long long node_bytes = sizeof( std::pair<const int, int> );
+    TEST_ASSERT( hashedContainerBytes( map ) >= node_bytes );
+
+    // Memory is not recorded unless the active profiler is tracking it.
+    Profiler profiler;
+    TEST_ASSERT( !profiler.isTrackingMemory() );
+    {
+        ProfilerScope scope( profiler );
+        TEST_ASSERT( !Profiler::trackingMemory() );
+        ScopedTimer timer( "Stage" );
+        Profiler::recordMemory( "Buffer", 100 );
+    }
+    TEST_EQUALITY( profiler.memory( "Buffer" ), 0 );
+    TEST_EQUALITY( profiler.peakResidentBytes( "Stage" ), 0 );
+    TEST_ASSERT( !profiler.report()->isSublist( "Memory" ) );
+
+    // Track memory. The largest record of a container is kept and the
+    // high-water mark is recorded with each timer.
+    profiler.setMemoryTracking( true );
+    {
+        ProfilerScope scope( profiler );
+        TEST_ASSERT( Profiler::trackingMemory() );
+        ScopedTimer timer( "Stage" );
+        Profiler::recordMemory( "Buffer", 100 );
+        Profiler::recordMemory( "Buffer", 50 );
+    }
+    TEST_EQUALITY( profiler.memory( "Buffer" ), 100 );
+    if ( Profiler::processPeakResidentBytes() > 0 )
+    {
+        TEST_ASSERT( profiler.peakResidentBytes( "Stage" ) > 0 );
+        TEST_ASSERT( profiler.peakResidentBytes( "Stage" ) <=
+                     Profiler::processPeakResidentBytes() );
+    }
+
+    // Check the reports.
+    Teuchos::RCP<Teuchos::ParameterList> local = profiler.report();
+    TEST_EQUALITY( local->sublist( "Memory" ).get<long long>( "Buffer" ),
+                   100 );
+    Teuchos::RCP<Teuchos::ParameterList> global =
+        profiler.globalReport( *comm );
+    const Teuchos::ParameterList &buffer =
+        global->sublist( "Memory" ).sublist( "Buffer" );
+    TEST_EQUALITY( buffer.get<long long>( "Max" ), 100 );
+    TEST_EQUALITY( buffer.get<long long>( "Total" ), 100 * comm_size );
+
+    // Reset clears the memory records.
+    profiler.reset();
+    TEST_EQUALITY( profiler.memory( "Buffer" ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstProfiler.cpp
+//---------------------------------------------------------------------------//